@@ -3,9 +3,9 @@
 @ stdcall FindVolumeMountPointClose(ptr) kernel32.FindVolumeMountPointClose
 @ stub GetFileAttributesTransactedW
 @ stub GetFirmwareType
-@ stub GetNumaAvailableMemoryNodeEx
+@ stdcall GetNumaAvailableMemoryNodeEx(long ptr) kernel32.GetNumaAvailableMemoryNodeEx
 @ stdcall GetNumaNodeProcessorMask(long ptr) kernel32.GetNumaNodeProcessorMask
-@ stub GetNumaProcessorNodeEx
+@ stdcall GetNumaProcessorNodeEx(ptr ptr) kernel32.GetNumaProcessorNodeEx
 @ stdcall PowerClearRequest(long long) kernel32.PowerClearRequest
 @ stdcall PowerCreateRequest(ptr) kernel32.PowerCreateRequest
 @ stdcall PowerSetRequest(long long) kernel32.PowerSetRequest
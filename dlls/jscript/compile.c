@@ -2226,6 +2226,7 @@ void release_bytecode(bytecode_t *code)
     for(i=0; i < code->str_cnt; i++)
         jsstr_release(code->str_pool[i]);
 
+    jit_free(code->jit_code);
     heap_free(code->source);
     heap_pool_free(&code->heap);
     heap_free(code->bstr_pool);
@@ -2355,6 +2356,7 @@ static HRESULT compile_function(compiler_ctx_t *ctx, source_elements_t *source,
         dump_code(ctx, off);
 
     func->instr_off = off;
+    func->instr_cnt = ctx->code_off - off;
 
     for(iter = ctx->func_head, i=0; iter; iter = iter->next, i++) {
         hres = compile_function(ctx, iter->source_elements, iter, FALSE, func->funcs+i);
@@ -145,6 +145,55 @@ static inline HRESULT resize_props(jsdisp_t *This)
     return S_OK;
 }
 
+/* Returns the array index represented by name, or ~0 if name is not in canonical index form. */
+static unsigned name_to_idx(const WCHAR *name)
+{
+    const WCHAR *ptr;
+    unsigned idx = 0;
+
+    if(*name == '0')
+        return name[1] ? ~0u : 0;
+
+    for(ptr = name; isdigitW(*ptr) && ptr - name < 9; ptr++)
+        idx = idx*10 + (*ptr-'0');
+    return ptr != name && !*ptr ? idx : ~0u;
+}
+
+/*
+ * Index properties are still regular properties, but we keep a dense map from index to
+ * DISPID so that indexed access doesn't need to format and hash the name. Property ids
+ * are never reused, so map entries stay valid for the lifetime of the object. Indexes
+ * that would make the map sparse are only accessible by name.
+ */
+static void set_idx_prop(jsdisp_t *This, dispex_prop_t *prop)
+{
+    unsigned idx, size;
+    DISPID *map;
+
+    idx = name_to_idx(prop->name);
+    if(idx == ~0u)
+        return;
+
+    if(idx >= This->idx_props_size) {
+        if(idx > 2*This->prop_cnt + 16)
+            return;
+
+        size = This->idx_props_size ? This->idx_props_size : 16;
+        while(size <= idx)
+            size *= 2;
+
+        map = heap_realloc(This->idx_props, size*sizeof(*map));
+        if(!map)
+            return;
+
+        memset(map+This->idx_props_size, 0, (size-This->idx_props_size)*sizeof(*map));
+        This->idx_props = map;
+        This->idx_props_size = size;
+    }
+
+    This->idx_props[idx] = prop_to_id(This, prop);
+}
+
 static inline dispex_prop_t* alloc_prop(jsdisp_t *This, const WCHAR *name, prop_type_t type, DWORD flags)
 {
     dispex_prop_t *prop;
@@ -164,6 +213,9 @@ static inline dispex_prop_t* alloc_prop(jsdisp_t *This, const WCHAR *name, prop_
     bucket = get_props_idx(This, prop->hash);
     prop->bucket_next = This->props[bucket].bucket_head;
     This->props[bucket].bucket_head = This->prop_cnt++;
+
+    if(isdigitW(*name))
+        set_idx_prop(This, prop);
     return prop;
 }
 
@@ -235,6 +287,20 @@ static HRESULT find_prop_name(jsdisp_t *This, unsigned hash, const WCHAR *name,
     return S_OK;
 }
 
+static HRESULT find_prop_idx(jsdisp_t *This, DWORD idx, dispex_prop_t **ret)
+{
+    static const WCHAR formatW[] = {'%','u',0};
+    WCHAR name[12];
+
+    if(idx < This->idx_props_size && This->idx_props[idx]) {
+        *ret = This->props + This->idx_props[idx];
+        return S_OK;
+    }
+
+    sprintfW(name, formatW, idx);
+    return find_prop_name(This, string_hash(name), name, ret);
+}
+
 static HRESULT find_prop_name_prot(jsdisp_t *This, unsigned hash, const WCHAR *name, dispex_prop_t **ret)
 {
     dispex_prop_t *prop, *del=NULL;
@@ -894,6 +960,9 @@ HRESULT init_dispex(jsdisp_t *dispex, script_ctx_t *ctx, const builtin_info_t *b
     if(!dispex->props)
         return E_OUTOFMEMORY;
 
+    dispex->idx_props = NULL;
+    dispex->idx_props_size = 0;
+
     dispex->prototype = prototype;
     if(prototype)
         jsdisp_addref(prototype);
@@ -951,6 +1020,7 @@ void jsdisp_free(jsdisp_t *obj)
         heap_free(prop->name);
     }
     heap_free(obj->props);
+    heap_free(obj->idx_props);
     script_release(obj->ctx);
     if(obj->prototype)
         jsdisp_release(obj->prototype);
@@ -1040,6 +1110,48 @@ HRESULT jsdisp_get_id(jsdisp_t *jsdisp, const WCHAR *name, DWORD flags, DISPID *
     return DISP_E_UNKNOWNNAME;
 }
 
+/*
+ * Same as jsdisp_get_id, but first checks the DISPID stored in cache by a previous lookup
+ * of the same name. Objects created the same way share their property layout, so a cache
+ * kept per bytecode instruction usually hits even for different objects.
+ */
+HRESULT jsdisp_get_id_cached(jsdisp_t *jsdisp, const WCHAR *name, DWORD flags, DISPID *cache, DISPID *id)
+{
+    dispex_prop_t *prop;
+    HRESULT hres;
+
+    if(*cache > 0 && *cache < jsdisp->prop_cnt) {
+        prop = jsdisp->props + *cache;
+        if(prop->type != PROP_DELETED && prop->name && !strcmpW(prop->name, name)) {
+            *id = *cache;
+            return S_OK;
+        }
+    }
+
+    hres = jsdisp_get_id(jsdisp, name, flags, id);
+    if(SUCCEEDED(hres))
+        *cache = *id;
+    return hres;
+}
+
+HRESULT jsdisp_get_idx_id(jsdisp_t *jsdisp, DWORD idx, DWORD flags, DISPID *id)
+{
+    static const WCHAR formatW[] = {'%','u',0};
+    WCHAR name[12];
+    dispex_prop_t *prop;
+
+    if(idx < jsdisp->idx_props_size && jsdisp->idx_props[idx]) {
+        prop = jsdisp->props + jsdisp->idx_props[idx];
+        if(prop->type != PROP_DELETED) {
+            *id = prop_to_id(jsdisp, prop);
+            return S_OK;
+        }
+    }
+
+    sprintfW(name, formatW, idx);
+    return jsdisp_get_id(jsdisp, name, flags, id);
+}
+
 HRESULT jsdisp_call_value(jsdisp_t *jsfunc, IDispatch *jsthis, WORD flags, unsigned argc, jsval_t *argv, jsval_t *r)
 {
     HRESULT hres;
@@ -1316,8 +1428,15 @@ HRESULT jsdisp_propput_dontenum(jsdisp_t *obj, const WCHAR *name, jsval_t val)
 HRESULT jsdisp_propput_idx(jsdisp_t *obj, DWORD idx, jsval_t val)
 {
     WCHAR buf[12];
+    dispex_prop_t *prop;
 
-    static const WCHAR formatW[] = {'%','d',0};
+    static const WCHAR formatW[] = {'%','u',0};
+
+    if(idx < obj->idx_props_size && obj->idx_props[idx]) {
+        prop = obj->props + obj->idx_props[idx];
+        if(prop->type != PROP_DELETED)
+            return prop_put(obj, prop, val, NULL);
+    }
 
     sprintfW(buf, formatW, idx);
     return jsdisp_propput_name(obj, buf, val);
@@ -1397,7 +1516,13 @@ HRESULT jsdisp_get_idx(jsdisp_t *obj, DWORD idx, jsval_t *r)
     dispex_prop_t *prop;
     HRESULT hres;
 
-    static const WCHAR formatW[] = {'%','d',0};
+    static const WCHAR formatW[] = {'%','u',0};
+
+    if(idx < obj->idx_props_size && obj->idx_props[idx]) {
+        prop = obj->props + obj->idx_props[idx];
+        if(prop->type != PROP_DELETED)
+            return prop_get(obj, prop, &dp, r, NULL);
+    }
 
     sprintfW(name, formatW, idx);
 
@@ -1463,15 +1588,11 @@ HRESULT disp_propget(script_ctx_t *ctx, IDispatch *disp, DISPID id, jsval_t *val
 
 HRESULT jsdisp_delete_idx(jsdisp_t *obj, DWORD idx)
 {
-    static const WCHAR formatW[] = {'%','d',0};
-    WCHAR buf[12];
     dispex_prop_t *prop;
     BOOL b;
     HRESULT hres;
 
-    sprintfW(buf, formatW, idx);
-
-    hres = find_prop_name(obj, string_hash(buf), buf, &prop);
+    hres = find_prop_idx(obj, idx, &prop);
     if(FAILED(hres) || !prop)
         return hres;
 
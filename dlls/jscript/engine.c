@@ -719,6 +719,13 @@ static inline unsigned get_op_uint(script_ctx_t *ctx, int i)
     return frame->bytecode->instrs[frame->ip].u.arg[i].uint;
 }
 
+/* Property lookup cache of the current instruction, stored in its otherwise unused second argument. */
+static inline DISPID *get_op_id_cache(script_ctx_t *ctx)
+{
+    call_frame_t *frame = ctx->call_ctx;
+    return &frame->bytecode->instrs[frame->ip].u.arg[1].lng;
+}
+
 static inline unsigned get_op_int(script_ctx_t *ctx, int i)
 {
     call_frame_t *frame = ctx->call_ctx;
@@ -986,11 +993,49 @@ static HRESULT interp_func(script_ctx_t *ctx)
     return stack_push(ctx, jsval_obj(dispex));
 }
 
-/* ECMA-262 3rd Edition    11.2.1 */
-static HRESULT interp_array(script_ctx_t *ctx)
+static inline BOOL get_array_idx(jsval_t v, DWORD *ret)
+{
+    double n;
+
+    if(!is_number(v))
+        return FALSE;
+
+    n = get_number(v);
+    if(!(n >= 0 && n < 0xffffffff) || n != (DWORD)n)
+        return FALSE;
+
+    *ret = n;
+    return TRUE;
+}
+
+/* Looks up property id for obj[namev], avoiding string conversion of array indexes on our own objects. */
+static HRESULT disp_get_id_val(script_ctx_t *ctx, IDispatch *obj, jsval_t namev, DWORD flags, DISPID *id)
 {
     jsstr_t *name_str;
     const WCHAR *name;
+    jsdisp_t *jsdisp;
+    DWORD idx;
+    HRESULT hres;
+
+    jsdisp = to_jsdisp(obj);
+    if(jsdisp && get_array_idx(namev, &idx))
+        return jsdisp_get_idx_id(jsdisp, idx, flags, id);
+
+    hres = to_flat_string(ctx, namev, &name_str, &name);
+    if(FAILED(hres))
+        return hres;
+
+    if(jsdisp)
+        hres = jsdisp_get_id_cached(jsdisp, name, flags, get_op_id_cache(ctx), id);
+    else
+        hres = disp_get_id(ctx, obj, name, NULL, flags, id);
+    jsstr_release(name_str);
+    return hres;
+}
+
+/* ECMA-262 3rd Edition    11.2.1 */
+static HRESULT interp_array(script_ctx_t *ctx)
+{
     jsval_t v, namev;
     IDispatch *obj;
     DISPID id;
@@ -1006,15 +1051,8 @@ static HRESULT interp_array(script_ctx_t *ctx)
         return hres;
     }
 
-    hres = to_flat_string(ctx, namev, &name_str, &name);
+    hres = disp_get_id_val(ctx, obj, namev, 0, &id);
     jsval_release(namev);
-    if(FAILED(hres)) {
-        IDispatch_Release(obj);
-        return hres;
-    }
-
-    hres = disp_get_id(ctx, obj, name, NULL, 0, &id);
-    jsstr_release(name_str);
     if(SUCCEEDED(hres)) {
         hres = disp_propget(ctx, obj, id, &v);
     }else if(hres == DISP_E_UNKNOWNNAME) {
@@ -1032,6 +1070,7 @@ static HRESULT interp_array(script_ctx_t *ctx)
 static HRESULT interp_member(script_ctx_t *ctx)
 {
     const BSTR arg = get_op_bstr(ctx, 0);
+    jsdisp_t *jsdisp;
     IDispatch *obj;
     jsval_t v;
     DISPID id;
@@ -1043,7 +1082,11 @@ static HRESULT interp_member(script_ctx_t *ctx)
     if(FAILED(hres))
         return hres;
 
-    hres = disp_get_id(ctx, obj, arg, arg, 0, &id);
+    jsdisp = to_jsdisp(obj);
+    if(jsdisp)
+        hres = jsdisp_get_id_cached(jsdisp, arg, 0, get_op_id_cache(ctx), &id);
+    else
+        hres = disp_get_id(ctx, obj, arg, arg, 0, &id);
     if(SUCCEEDED(hres)) {
         hres = disp_propget(ctx, obj, id, &v);
     }else if(hres == DISP_E_UNKNOWNNAME) {
@@ -1062,8 +1105,6 @@ static HRESULT interp_memberid(script_ctx_t *ctx)
 {
     const unsigned arg = get_op_uint(ctx, 0);
     jsval_t objv, namev;
-    const WCHAR *name;
-    jsstr_t *name_str;
     IDispatch *obj;
     exprval_t ref;
     DISPID id;
@@ -1076,17 +1117,13 @@ static HRESULT interp_memberid(script_ctx_t *ctx)
 
     hres = to_object(ctx, objv, &obj);
     jsval_release(objv);
-    if(SUCCEEDED(hres)) {
-        hres = to_flat_string(ctx, namev, &name_str, &name);
-        if(FAILED(hres))
-            IDispatch_Release(obj);
-    }
-    jsval_release(namev);
-    if(FAILED(hres))
+    if(FAILED(hres)) {
+        jsval_release(namev);
         return hres;
+    }
 
-    hres = disp_get_id(ctx, obj, name, NULL, arg, &id);
-    jsstr_release(name_str);
+    hres = disp_get_id_val(ctx, obj, namev, arg, &id);
+    jsval_release(namev);
     if(SUCCEEDED(hres)) {
         ref.type = EXPRVAL_IDREF;
         ref.u.idref.disp = obj;
@@ -2581,8 +2618,6 @@ static HRESULT interp_push_ret(script_ctx_t *ctx)
     return hres;
 }
 
-typedef HRESULT (*op_func_t)(script_ctx_t*);
-
 static const op_func_t op_funcs[] = {
 #define X(x,a,b,c) interp_##x,
 OP_LIST
@@ -2708,8 +2743,20 @@ static HRESULT enter_bytecode(script_ctx_t *ctx, jsval_t *r)
 
     while(1) {
         frame = ctx->call_ctx;
-        op = frame->bytecode->instrs[frame->ip].op;
-        hres = op_funcs[op](ctx);
+
+        /* Native code returns after leaving the function, on a new call frame or on failure. */
+        if(frame->function->jit && (hres = jit_exec(ctx, frame)) != S_FALSE) {
+            if(SUCCEEDED(hres) && frame->ip != -1)
+                continue;
+        }else {
+            op = frame->bytecode->instrs[frame->ip].op;
+            hres = op_funcs[op](ctx);
+            if(SUCCEEDED(hres) && frame->ip != -1) {
+                frame->ip += op_move[op];
+                continue;
+            }
+        }
+
         if(FAILED(hres)) {
             TRACE("EXCEPTION %08x\n", hres);
 
@@ -2731,8 +2778,6 @@ static HRESULT enter_bytecode(script_ctx_t *ctx, jsval_t *r)
             pop_call_frame(ctx);
             if(!return_to_interp)
                 break;
-        }else {
-            frame->ip += op_move[op];
         }
     }
 
@@ -2935,6 +2980,12 @@ HRESULT exec_source(script_ctx_t *ctx, DWORD flags, bytecode_t *bytecode, functi
         frame->base_scope = frame->scope = scope_addref(scope);
     }
 
+    if(!function->jit && ++function->exec_cnt == JIT_THRESHOLD && ctx->jit_enabled) {
+        hres = jit_compile(bytecode, function, op_funcs, op_move);
+        if(FAILED(hres))
+            WARN("Could not compile %s to native code: %08x\n", debugstr_w(function->name), hres);
+    }
+
     frame->ip = function->instr_off;
     frame->stack_base = ctx->stack_top;
     if(this_obj)
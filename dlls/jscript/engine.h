@@ -132,11 +132,17 @@ typedef struct {
     int ref;
 } local_ref_t;
 
+typedef struct _jit_code_t jit_code_t;
+
 typedef struct _function_code_t {
     BSTR name;
     int local_ref;
     BSTR event_target;
     unsigned instr_off;
+    unsigned instr_cnt;
+
+    unsigned exec_cnt;
+    jit_code_t *jit;
 
     const WCHAR *source;
     unsigned source_len;
@@ -177,6 +183,8 @@ typedef struct _bytecode_t {
     unsigned str_pool_size;
     unsigned str_cnt;
 
+    jit_code_t *jit_code;
+
     struct _bytecode_t *next;
 } bytecode_t;
 
@@ -247,3 +255,12 @@ HRESULT exec_source(script_ctx_t*,DWORD,bytecode_t*,function_code_t*,scope_chain
 HRESULT create_source_function(script_ctx_t*,bytecode_t*,function_code_t*,scope_chain_t*,jsdisp_t**) DECLSPEC_HIDDEN;
 HRESULT setup_arguments_object(script_ctx_t*,call_frame_t*) DECLSPEC_HIDDEN;
 void detach_arguments_object(jsdisp_t*) DECLSPEC_HIDDEN;
+
+typedef HRESULT (*op_func_t)(script_ctx_t*);
+
+#define JIT_THRESHOLD 16
+
+BOOL jit_is_enabled(void) DECLSPEC_HIDDEN;
+HRESULT jit_compile(bytecode_t*,function_code_t*,const op_func_t*,const unsigned*) DECLSPEC_HIDDEN;
+HRESULT jit_exec(script_ctx_t*,call_frame_t*) DECLSPEC_HIDDEN;
+void jit_free(jit_code_t*) DECLSPEC_HIDDEN;
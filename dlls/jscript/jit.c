@@ -0,0 +1,734 @@
+/*
+ * JScript baseline native code compiler
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301, USA
+ */
+
+#include <stddef.h>
+#include <assert.h>
+
+#include "jscript.h"
+#include "engine.h"
+
+#include "winreg.h"
+#include "wine/debug.h"
+
+WINE_DEFAULT_DEBUG_CHANNEL(jscript);
+
+/*
+ * Functions executed JIT_THRESHOLD times are translated into native code. The
+ * translation is a straight mapping of bytecode: each instruction becomes a block that
+ * either executes it inline, guarded by checks of operand types, or calls the interpreter
+ * handler for it. Calling the handlers keeps the interpreter's call frame, stack and
+ * exception handling as the only state, so native code may be left at any instruction
+ * boundary and the interpreter takes over from there.
+ *
+ * The compiler is disabled by default. It may be enabled by setting
+ * HKCU\Software\Wine\JScript\JIT to "enabled". The setting is read each time
+ * a script engine is initialized.
+ */
+#ifdef __x86_64__
+
+BOOL jit_is_enabled(void)
+{
+    static const WCHAR jscript_keyW[] =
+        {'S','o','f','t','w','a','r','e','\\','W','i','n','e','\\','J','S','c','r','i','p','t',0};
+    static const WCHAR jitW[] = {'J','I','T',0};
+    static const WCHAR enabledW[] = {'e','n','a','b','l','e','d',0};
+    WCHAR buf[16] = {0};
+    DWORD size = sizeof(buf) - sizeof(WCHAR), type;
+    BOOL enabled = FALSE;
+    HKEY hkey;
+
+    if(!RegOpenKeyW(HKEY_CURRENT_USER, jscript_keyW, &hkey)) {
+        if(!RegQueryValueExW(hkey, jitW, NULL, &type, (BYTE*)buf, &size) && type == REG_SZ)
+            enabled = !strcmpiW(buf, enabledW);
+        RegCloseKey(hkey);
+    }
+
+    TRACE("JIT %s\n", enabled ? "enabled" : "disabled");
+    return enabled;
+}
+
+/* Native code is entered with the same calling convention the handlers use. */
+typedef HRESULT (*jit_entry_t)(script_ctx_t*,call_frame_t*);
+
+#if defined(__MINGW32__) || defined(_MSC_VER)
+#define REG_ARG1 RCX
+#define REG_ARG2 RDX
+#else
+#define REG_ARG1 RDI
+#define REG_ARG2 RSI
+#endif
+
+struct _jit_code_t {
+    struct _jit_code_t *next;
+    BYTE *code;
+    SIZE_T size;
+    unsigned instr_off;
+    unsigned instr_cnt;
+};
+
+typedef struct {
+    unsigned pos;
+    unsigned instr;
+} jit_fixup_t;
+
+typedef struct {
+    BYTE *buf;
+    unsigned size;
+    unsigned len;
+    BOOL oom;
+
+    const instr_t *instrs;
+    unsigned instr_off;
+    unsigned instr_cnt;
+    const op_func_t *op_funcs;
+    const unsigned *op_move;
+
+    unsigned *block_offs;
+    jit_fixup_t *fixups;
+    unsigned fixup_cnt;
+    unsigned fixup_size;
+
+    unsigned dispatch_off;
+    unsigned exit_ok_off;
+    unsigned exit_off;
+} jit_ctx_t;
+
+/* Register numbers as used in ModRM encoding. */
+enum {
+    RAX = 0, RCX, RDX, RBX, RSP, RBP, RSI, RDI,
+    R8, R9, R10, R11, R12, R13, R14, R15
+};
+
+/* Registers kept across handler calls. They are callee-saved in both Microsoft and System V ABIs. */
+#define REG_CTX   RBX
+#define REG_FRAME R12
+#define REG_TABLE R13
+
+#define CTX_OFF(x)   ((int)offsetof(script_ctx_t, x))
+#define FRAME_OFF(x) ((int)offsetof(call_frame_t, x))
+#define VAL_TYPE     ((int)offsetof(jsval_t, type))
+#define VAL_U        ((int)offsetof(jsval_t, u))
+#define VAL_SIZE     ((int)sizeof(jsval_t))
+
+C_ASSERT(sizeof(jsval_t) == 16);
+
+static void emit_byte(jit_ctx_t *jit, BYTE b)
+{
+    if(jit->len == jit->size) {
+        BYTE *new_buf;
+
+        if(jit->oom)
+            return;
+
+        new_buf = heap_realloc(jit->buf, jit->size*2);
+        if(!new_buf) {
+            jit->oom = TRUE;
+            return;
+        }
+        jit->buf = new_buf;
+        jit->size *= 2;
+    }
+
+    jit->buf[jit->len++] = b;
+}
+
+static void emit_bytes(jit_ctx_t *jit, const BYTE *bytes, unsigned len)
+{
+    while(len--)
+        emit_byte(jit, *bytes++);
+}
+
+static void emit_dword(jit_ctx_t *jit, DWORD d)
+{
+    emit_byte(jit, d);
+    emit_byte(jit, d >> 8);
+    emit_byte(jit, d >> 16);
+    emit_byte(jit, d >> 24);
+}
+
+static void emit_qword(jit_ctx_t *jit, ULONGLONG q)
+{
+    emit_dword(jit, q);
+    emit_dword(jit, q >> 32);
+}
+
+static void patch_dword(jit_ctx_t *jit, unsigned pos, DWORD d)
+{
+    if(jit->oom)
+        return;
+
+    jit->buf[pos]   = d;
+    jit->buf[pos+1] = d >> 8;
+    jit->buf[pos+2] = d >> 16;
+    jit->buf[pos+3] = d >> 24;
+}
+
+static void emit_rex(jit_ctx_t *jit, BOOL w, unsigned reg, unsigned base)
+{
+    BYTE rex = 0x40 | (w ? 8 : 0) | (reg >= R8 ? 4 : 0) | (base >= R8 ? 1 : 0);
+
+    if(rex != 0x40)
+        emit_byte(jit, rex);
+}
+
+/*
+ * Emits [prefix] [REX] opcode ModRM [SIB] disp32 for an instruction with register operand reg
+ * (or opcode extension) and memory operand [base+disp]. Opcodes with 0x0f escape are passed
+ * as 0x0fXX.
+ */
+static void emit_mem(jit_ctx_t *jit, BYTE prefix, BOOL w, unsigned opcode, unsigned reg, unsigned base, int disp)
+{
+    if(prefix)
+        emit_byte(jit, prefix);
+    emit_rex(jit, w, reg, base);
+    if(opcode > 0xff)
+        emit_byte(jit, opcode >> 8);
+    emit_byte(jit, opcode);
+    emit_byte(jit, 0x80 | ((reg & 7) << 3) | (base & 7));
+    if((base & 7) == RSP)
+        emit_byte(jit, 0x24);
+    emit_dword(jit, disp);
+}
+
+/* Register to register operation, op r/m=dst, reg=src. */
+static void emit_reg(jit_ctx_t *jit, BOOL w, unsigned opcode, unsigned src, unsigned dst)
+{
+    emit_rex(jit, w, src, dst);
+    if(opcode > 0xff)
+        emit_byte(jit, opcode >> 8);
+    emit_byte(jit, opcode);
+    emit_byte(jit, 0xc0 | ((src & 7) << 3) | (dst & 7));
+}
+
+static void emit_push(jit_ctx_t *jit, unsigned reg)
+{
+    emit_rex(jit, FALSE, 0, reg);
+    emit_byte(jit, 0x50 | (reg & 7));
+}
+
+static void emit_pop(jit_ctx_t *jit, unsigned reg)
+{
+    emit_rex(jit, FALSE, 0, reg);
+    emit_byte(jit, 0x58 | (reg & 7));
+}
+
+/* mov dword [base+disp], imm32 */
+static void emit_store_imm32(jit_ctx_t *jit, unsigned base, int disp, DWORD imm)
+{
+    emit_mem(jit, 0, FALSE, 0xc7, 0, base, disp);
+    emit_dword(jit, imm);
+}
+
+/* cmp dword [base+disp], imm32 */
+static void emit_cmp_imm32(jit_ctx_t *jit, unsigned base, int disp, DWORD imm)
+{
+    emit_mem(jit, 0, FALSE, 0x81, 7, base, disp);
+    emit_dword(jit, imm);
+}
+
+/* shl reg64, 4 */
+static void emit_shl4(jit_ctx_t *jit, unsigned reg)
+{
+    emit_reg(jit, TRUE, 0xc1, 4, reg);
+    emit_byte(jit, 4);
+}
+
+static void emit_set_ip(jit_ctx_t *jit, unsigned ip)
+{
+    emit_store_imm32(jit, REG_FRAME, FRAME_OFF(ip), ip);
+}
+
+/* Emits conditional jump (0x0f 0x8X) or jmp (cc == 0) with rel32 and returns position of rel32. */
+static unsigned emit_jump(jit_ctx_t *jit, BYTE cc)
+{
+    if(cc) {
+        emit_byte(jit, 0x0f);
+        emit_byte(jit, cc);
+    }else {
+        emit_byte(jit, 0xe9);
+    }
+    emit_dword(jit, 0);
+    return jit->len-4;
+}
+
+#define JCC_JB  0x82
+#define JCC_JAE 0x83
+#define JCC_JE  0x84
+#define JCC_JNE 0x85
+#define JCC_JS  0x88
+
+static void patch_jump(jit_ctx_t *jit, unsigned pos, unsigned target)
+{
+    patch_dword(jit, pos, target - (pos+4));
+}
+
+static void patch_jump_here(jit_ctx_t *jit, unsigned pos)
+{
+    patch_jump(jit, pos, jit->len);
+}
+
+static void emit_jump_to(jit_ctx_t *jit, BYTE cc, unsigned target)
+{
+    patch_jump(jit, emit_jump(jit, cc), target);
+}
+
+/* Jumps to native code of given bytecode instruction. */
+static void emit_jump_instr(jit_ctx_t *jit, BYTE cc, unsigned ip)
+{
+    unsigned pos;
+
+    if(ip - jit->instr_off >= jit->instr_cnt) {
+        emit_jump_to(jit, cc, jit->dispatch_off);
+        return;
+    }
+
+    pos = emit_jump(jit, cc);
+
+    if(jit->fixup_cnt == jit->fixup_size) {
+        jit_fixup_t *new_fixups;
+
+        new_fixups = heap_realloc(jit->fixups, jit->fixup_size*2*sizeof(*new_fixups));
+        if(!new_fixups) {
+            jit->oom = TRUE;
+            return;
+        }
+        jit->fixups = new_fixups;
+        jit->fixup_size *= 2;
+    }
+
+    jit->fixups[jit->fixup_cnt].pos = pos;
+    jit->fixups[jit->fixup_cnt].instr = ip - jit->instr_off;
+    jit->fixup_cnt++;
+}
+
+/* Leaves the block after inline execution of a non-jump instruction. */
+static void emit_next(jit_ctx_t *jit, unsigned ip)
+{
+    emit_set_ip(jit, ip+1);
+    emit_jump_instr(jit, 0, ip+1);
+}
+
+/* Loads address of stack top (one past the last value) into RDX, stack_top into RCX. */
+static void emit_load_stack_top(jit_ctx_t *jit)
+{
+    emit_mem(jit, 0, FALSE, 0x8b, RCX, REG_CTX, CTX_OFF(stack_top));
+    emit_mem(jit, 0, TRUE, 0x8b, RDX, REG_CTX, CTX_OFF(stack));
+    emit_shl4(jit, RCX);
+    emit_reg(jit, TRUE, 0x01, RCX, RDX);
+}
+
+/* Jumps to slow path unless there is room for pushing a value. Loads the same registers as emit_load_stack_top. */
+static unsigned emit_load_stack_push(jit_ctx_t *jit)
+{
+    unsigned slow;
+
+    emit_mem(jit, 0, FALSE, 0x8b, RCX, REG_CTX, CTX_OFF(stack_top));
+    emit_mem(jit, 0, FALSE, 0x3b, RCX, REG_CTX, CTX_OFF(stack_size));
+    slow = emit_jump(jit, JCC_JAE);
+    emit_mem(jit, 0, TRUE, 0x8b, RDX, REG_CTX, CTX_OFF(stack));
+    emit_shl4(jit, RCX);
+    emit_reg(jit, TRUE, 0x01, RCX, RDX);
+    return slow;
+}
+
+static void emit_handler_call(jit_ctx_t *jit, jsop_t op, unsigned ip)
+{
+    static const BYTE call_rax[] = {0xff, 0xd0};
+
+    /* Pass ctx in both RCX and RDI, so that the call works regardless of handlers' ABI. */
+    emit_reg(jit, TRUE, 0x89, REG_CTX, RCX);
+    emit_reg(jit, TRUE, 0x89, REG_CTX, RDI);
+    emit_byte(jit, 0x48);
+    emit_byte(jit, 0xb8);
+    emit_qword(jit, (ULONG_PTR)jit->op_funcs[op]);
+    emit_bytes(jit, call_rax, sizeof(call_rax));
+
+    /* test eax, eax; js exit */
+    emit_reg(jit, FALSE, 0x85, RAX, RAX);
+    emit_jump_to(jit, JCC_JS, jit->exit_off);
+
+    if(jit->op_move[op])
+        emit_set_ip(jit, ip+1);
+
+    /* Leave native code if the handler pushed a new call frame. */
+    emit_mem(jit, 0, TRUE, 0x39, REG_FRAME, REG_CTX, CTX_OFF(call_ctx));
+    emit_jump_to(jit, JCC_JNE, jit->exit_ok_off);
+
+    if(jit->op_move[op])
+        emit_jump_instr(jit, 0, ip+1);
+    else
+        emit_jump_to(jit, 0, jit->dispatch_off);
+}
+
+static void emit_push_number(jit_ctx_t *jit, double n, unsigned ip)
+{
+    unsigned slow;
+    union {
+        double d;
+        ULONGLONG q;
+    } u;
+
+    u.d = n;
+
+    slow = emit_load_stack_push(jit);
+    emit_store_imm32(jit, RDX, VAL_TYPE, JSV_NUMBER);
+    emit_byte(jit, 0x48);
+    emit_byte(jit, 0xb8);
+    emit_qword(jit, u.q);
+    emit_mem(jit, 0, TRUE, 0x89, RAX, RDX, VAL_U);
+    emit_mem(jit, 0, FALSE, 0xff, 0, REG_CTX, CTX_OFF(stack_top));
+    emit_next(jit, ip);
+
+    patch_jump_here(jit, slow);
+}
+
+/* Executes binary arithmetic inline if both operands are numbers. */
+static void emit_arith(jit_ctx_t *jit, unsigned sse_op, unsigned ip)
+{
+    unsigned slow1, slow2;
+
+    emit_load_stack_top(jit);
+    emit_cmp_imm32(jit, RDX, -VAL_SIZE+VAL_TYPE, JSV_NUMBER);
+    slow1 = emit_jump(jit, JCC_JNE);
+    emit_cmp_imm32(jit, RDX, -2*VAL_SIZE+VAL_TYPE, JSV_NUMBER);
+    slow2 = emit_jump(jit, JCC_JNE);
+
+    emit_mem(jit, 0xf2, FALSE, 0x0f10, 0, RDX, -2*VAL_SIZE+VAL_U);
+    emit_mem(jit, 0xf2, FALSE, sse_op, 0, RDX, -VAL_SIZE+VAL_U);
+    emit_mem(jit, 0xf2, FALSE, 0x0f11, 0, RDX, -2*VAL_SIZE+VAL_U);
+    emit_mem(jit, 0, FALSE, 0xff, 1, REG_CTX, CTX_OFF(stack_top));
+    emit_next(jit, ip);
+
+    patch_jump_here(jit, slow1);
+    patch_jump_here(jit, slow2);
+}
+
+/* Executes relational comparison inline if both operands are numbers. NaN operands give false. */
+static void emit_compare(jit_ctx_t *jit, jsop_t op, unsigned ip)
+{
+    unsigned slow1, slow2;
+    BOOL swap = op == OP_lt || op == OP_lteq;
+    BYTE setcc = op == OP_lt || op == OP_gt ? 0x97 /* seta */ : 0x93 /* setae */;
+
+    emit_load_stack_top(jit);
+    emit_cmp_imm32(jit, RDX, -VAL_SIZE+VAL_TYPE, JSV_NUMBER);
+    slow1 = emit_jump(jit, JCC_JNE);
+    emit_cmp_imm32(jit, RDX, -2*VAL_SIZE+VAL_TYPE, JSV_NUMBER);
+    slow2 = emit_jump(jit, JCC_JNE);
+
+    /* l < r is evaluated as r > l, so that unordered (NaN) result clears the condition */
+    emit_mem(jit, 0xf2, FALSE, 0x0f10, 0, RDX, (swap ? -1 : -2)*VAL_SIZE+VAL_U);
+    emit_mem(jit, 0x66, FALSE, 0x0f2e, 0, RDX, (swap ? -2 : -1)*VAL_SIZE+VAL_U);
+    emit_byte(jit, 0x0f);
+    emit_byte(jit, setcc);
+    emit_byte(jit, 0xc0);
+    emit_reg(jit, FALSE, 0x0fb6, RAX, RAX); /* movzx eax, al */
+
+    emit_store_imm32(jit, RDX, -2*VAL_SIZE+VAL_TYPE, JSV_BOOL);
+    emit_mem(jit, 0, FALSE, 0x89, RAX, RDX, -2*VAL_SIZE+VAL_U);
+    emit_mem(jit, 0, FALSE, 0xff, 1, REG_CTX, CTX_OFF(stack_top));
+    emit_next(jit, ip);
+
+    patch_jump_here(jit, slow1);
+    patch_jump_here(jit, slow2);
+}
+
+static void emit_jmp_z(jit_ctx_t *jit, unsigned target, unsigned ip)
+{
+    unsigned slow, is_false;
+
+    emit_load_stack_top(jit);
+    emit_cmp_imm32(jit, RDX, -VAL_SIZE+VAL_TYPE, JSV_BOOL);
+    slow = emit_jump(jit, JCC_JNE);
+    emit_mem(jit, 0, FALSE, 0xff, 1, REG_CTX, CTX_OFF(stack_top));
+    emit_cmp_imm32(jit, RDX, -VAL_SIZE+VAL_U, 0);
+    is_false = emit_jump(jit, JCC_JE);
+    emit_next(jit, ip);
+
+    patch_jump_here(jit, is_false);
+    emit_set_ip(jit, target);
+    emit_jump_instr(jit, 0, target);
+
+    patch_jump_here(jit, slow);
+}
+
+/* Pushes copy of a local variable if it lives on the stack and holds a number or a boolean. */
+static void emit_local(jit_ctx_t *jit, int ref, unsigned ip)
+{
+    unsigned slow1, slow2, slow3, slow4, is_number;
+
+    emit_mem(jit, 0, TRUE, 0x8b, RAX, REG_FRAME, FRAME_OFF(base_scope));
+    emit_reg(jit, TRUE, 0x85, RAX, RAX);
+    slow1 = emit_jump(jit, JCC_JE);
+    emit_mem(jit, 0, TRUE, 0x83, 7, RAX, offsetof(scope_chain_t, frame));
+    emit_byte(jit, 0);
+    slow2 = emit_jump(jit, JCC_JE);
+
+    slow3 = emit_load_stack_push(jit);
+
+    /* mov eax, frame->arguments_off or frame->variables_off; add eax, offset */
+    if(ref < 0) {
+        emit_mem(jit, 0, FALSE, 0x8b, RAX, REG_FRAME, FRAME_OFF(arguments_off));
+        emit_byte(jit, 0x05);
+        emit_dword(jit, -ref-1);
+    }else {
+        emit_mem(jit, 0, FALSE, 0x8b, RAX, REG_FRAME, FRAME_OFF(variables_off));
+        emit_byte(jit, 0x05);
+        emit_dword(jit, ref);
+    }
+    emit_shl4(jit, RAX);
+    emit_mem(jit, 0, TRUE, 0x03, RAX, REG_CTX, CTX_OFF(stack));
+
+    emit_cmp_imm32(jit, RAX, VAL_TYPE, JSV_NUMBER);
+    is_number = emit_jump(jit, JCC_JE);
+    emit_cmp_imm32(jit, RAX, VAL_TYPE, JSV_BOOL);
+    slow4 = emit_jump(jit, JCC_JNE);
+    patch_jump_here(jit, is_number);
+
+    /* movdqu xmm0, [rax]; movdqu [rdx], xmm0 */
+    emit_mem(jit, 0xf3, FALSE, 0x0f6f, 0, RAX, 0);
+    emit_mem(jit, 0xf3, FALSE, 0x0f7f, 0, RDX, 0);
+    emit_mem(jit, 0, FALSE, 0xff, 0, REG_CTX, CTX_OFF(stack_top));
+    emit_next(jit, ip);
+
+    patch_jump_here(jit, slow1);
+    patch_jump_here(jit, slow2);
+    patch_jump_here(jit, slow3);
+    patch_jump_here(jit, slow4);
+}
+
+static void emit_instr(jit_ctx_t *jit, unsigned i)
+{
+    const instr_t *instr = jit->instrs + i;
+    unsigned ip = jit->instr_off + i;
+
+    switch(instr->op) {
+    case OP_int:
+        emit_push_number(jit, instr->u.arg[0].lng, ip);
+        break;
+    case OP_double:
+        emit_push_number(jit, instr->u.dbl, ip);
+        break;
+    case OP_add:
+        emit_arith(jit, 0x0f58, ip);
+        break;
+    case OP_sub:
+        emit_arith(jit, 0x0f5c, ip);
+        break;
+    case OP_mul:
+        emit_arith(jit, 0x0f59, ip);
+        break;
+    case OP_div:
+        emit_arith(jit, 0x0f5e, ip);
+        break;
+    case OP_lt:
+    case OP_lteq:
+    case OP_gt:
+    case OP_gteq:
+        emit_compare(jit, instr->op, ip);
+        break;
+    case OP_local:
+        emit_local(jit, instr->u.arg[0].lng, ip);
+        break;
+    case OP_jmp:
+        emit_set_ip(jit, instr->u.arg[0].uint);
+        emit_jump_instr(jit, 0, instr->u.arg[0].uint);
+        return;
+    case OP_jmp_z:
+        emit_jmp_z(jit, instr->u.arg[0].uint, ip);
+        break;
+    default:
+        break;
+    }
+
+    emit_handler_call(jit, instr->op, ip);
+}
+
+static void emit_prologue(jit_ctx_t *jit, unsigned *table_ref)
+{
+    unsigned exit_ok;
+
+    emit_push(jit, RBX);
+    emit_push(jit, RSI);
+    emit_push(jit, RDI);
+    emit_push(jit, R12);
+    emit_push(jit, R13);
+    emit_byte(jit, 0x48); /* sub rsp, 32 */
+    emit_byte(jit, 0x83);
+    emit_byte(jit, 0xec);
+    emit_byte(jit, 32);
+    emit_reg(jit, TRUE, 0x89, REG_ARG1, REG_CTX);
+    emit_reg(jit, TRUE, 0x89, REG_ARG2, REG_FRAME);
+
+    /* lea r13, [rip+table] */
+    emit_byte(jit, 0x4c);
+    emit_byte(jit, 0x8d);
+    emit_byte(jit, 0x2d);
+    emit_dword(jit, 0);
+    *table_ref = jit->len-4;
+
+    /* Jump to native code of frame->ip, or leave if it's outside of compiled function. */
+    jit->dispatch_off = jit->len;
+    emit_mem(jit, 0, FALSE, 0x8b, RAX, REG_FRAME, FRAME_OFF(ip));
+    emit_byte(jit, 0x2d); /* sub eax, instr_off */
+    emit_dword(jit, jit->instr_off);
+    emit_byte(jit, 0x3d); /* cmp eax, instr_cnt */
+    emit_dword(jit, jit->instr_cnt);
+    exit_ok = emit_jump(jit, JCC_JAE);
+    emit_byte(jit, 0x41); /* jmp [r13+rax*8] */
+    emit_byte(jit, 0xff);
+    emit_byte(jit, 0x64);
+    emit_byte(jit, 0xc5);
+    emit_byte(jit, 0x00);
+
+    jit->exit_ok_off = jit->len;
+    patch_jump_here(jit, exit_ok);
+    emit_reg(jit, FALSE, 0x31, RAX, RAX);
+
+    jit->exit_off = jit->len;
+    emit_byte(jit, 0x48); /* add rsp, 32 */
+    emit_byte(jit, 0x83);
+    emit_byte(jit, 0xc4);
+    emit_byte(jit, 32);
+    emit_pop(jit, R13);
+    emit_pop(jit, R12);
+    emit_pop(jit, RDI);
+    emit_pop(jit, RSI);
+    emit_pop(jit, RBX);
+    emit_byte(jit, 0xc3);
+}
+
+HRESULT jit_compile(bytecode_t *code, function_code_t *func, const op_func_t *op_funcs, const unsigned *op_move)
+{
+    jit_ctx_t jit = {NULL};
+    unsigned table_ref, table_off, i;
+    jit_code_t *ret;
+    ULONG_PTR *table;
+    HRESULT hres = E_OUTOFMEMORY;
+
+    jit.instrs = code->instrs + func->instr_off;
+    jit.instr_off = func->instr_off;
+    jit.instr_cnt = func->instr_cnt;
+    jit.op_funcs = op_funcs;
+    jit.op_move = op_move;
+
+    TRACE("compiling %s (%u instructions)\n", debugstr_w(func->name), jit.instr_cnt);
+
+    jit.buf = heap_alloc(jit.size = 64*jit.instr_cnt + 128);
+    jit.block_offs = heap_alloc(jit.instr_cnt * sizeof(*jit.block_offs));
+    jit.fixups = heap_alloc((jit.fixup_size = 16) * sizeof(*jit.fixups));
+    if(!jit.buf || !jit.block_offs || !jit.fixups)
+        goto done;
+
+    emit_prologue(&jit, &table_ref);
+
+    for(i = 0; i < jit.instr_cnt; i++) {
+        jit.block_offs[i] = jit.len;
+        emit_instr(&jit, i);
+    }
+
+    for(i = 0; i < jit.fixup_cnt; i++)
+        patch_jump(&jit, jit.fixups[i].pos, jit.block_offs[jit.fixups[i].instr]);
+
+    while(jit.len % sizeof(ULONG_PTR))
+        emit_byte(&jit, 0xcc);
+    table_off = jit.len;
+    patch_dword(&jit, table_ref, table_off - (table_ref+4));
+    for(i = 0; i < jit.instr_cnt; i++)
+        emit_qword(&jit, 0);
+    if(jit.oom)
+        goto done;
+
+    ret = heap_alloc(sizeof(*ret));
+    if(!ret)
+        goto done;
+
+    ret->size = jit.len;
+    ret->code = VirtualAlloc(NULL, ret->size, MEM_COMMIT, PAGE_EXECUTE_READWRITE);
+    if(!ret->code) {
+        heap_free(ret);
+        goto done;
+    }
+
+    memcpy(ret->code, jit.buf, jit.len);
+    table = (ULONG_PTR*)(ret->code + table_off);
+    for(i = 0; i < jit.instr_cnt; i++)
+        table[i] = (ULONG_PTR)(ret->code + jit.block_offs[i]);
+
+    ret->instr_off = jit.instr_off;
+    ret->instr_cnt = jit.instr_cnt;
+    ret->next = code->jit_code;
+    code->jit_code = ret;
+    func->jit = ret;
+
+    TRACE("%s compiled to %p (%lu bytes)\n", debugstr_w(func->name), ret->code, ret->size);
+    hres = S_OK;
+
+done:
+    heap_free(jit.buf);
+    heap_free(jit.block_offs);
+    heap_free(jit.fixups);
+    return hres;
+}
+
+/* Returns S_FALSE if frame's current instruction is not covered by the native code. */
+HRESULT jit_exec(script_ctx_t *ctx, call_frame_t *frame)
+{
+    jit_code_t *jit = frame->function->jit;
+
+    if(frame->ip - jit->instr_off >= jit->instr_cnt)
+        return S_FALSE;
+
+    return ((jit_entry_t)jit->code)(ctx, frame);
+}
+
+void jit_free(jit_code_t *jit)
+{
+    jit_code_t *next;
+
+    while(jit) {
+        next = jit->next;
+        VirtualFree(jit->code, 0, MEM_RELEASE);
+        heap_free(jit);
+        jit = next;
+    }
+}
+
+#else
+
+BOOL jit_is_enabled(void)
+{
+    return FALSE;
+}
+
+HRESULT jit_compile(bytecode_t *code, function_code_t *func, const op_func_t *op_funcs, const unsigned *op_move)
+{
+    return E_NOTIMPL;
+}
+
+HRESULT jit_exec(script_ctx_t *ctx, call_frame_t *frame)
+{
+    return S_FALSE;
+}
+
+void jit_free(jit_code_t *jit)
+{
+    assert(!jit);
+}
+
+#endif
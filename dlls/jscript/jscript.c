@@ -712,6 +712,7 @@ static HRESULT WINAPI JScriptParse_InitNew(IActiveScriptParse *iface)
     ctx->active_script = &This->IActiveScript_iface;
     ctx->safeopt = This->safeopt;
     ctx->version = This->version;
+    ctx->jit_enabled = jit_is_enabled();
     ctx->ei.val = jsval_undefined();
     heap_pool_init(&ctx->tmp_heap);
 
@@ -0,0 +1,87 @@
+/*
+ * Array element and object property access benchmark.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301, USA
+ */
+
+function sieve(n) {
+    var flags = new Array(n+1), count = 0, i, j;
+
+    for(i = 2; i <= n; i++)
+        flags[i] = true;
+
+    for(i = 2; i <= n; i++) {
+        if(flags[i]) {
+            for(j = i+i; j <= n; j += i)
+                flags[j] = false;
+            count++;
+        }
+    }
+
+    return count;
+}
+
+function sort(n) {
+    var arr = [], i, j, tmp;
+
+    for(i = 0; i < n; i++)
+        arr[i] = (i * 7919) % n;
+
+    for(i = 0; i < n; i++) {
+        for(j = n-1; j > i; j--) {
+            if(arr[j-1] > arr[j]) {
+                tmp = arr[j];
+                arr[j] = arr[j-1];
+                arr[j-1] = tmp;
+            }
+        }
+    }
+
+    for(i = 1; i < n; i++) {
+        if(arr[i-1] > arr[i])
+            return false;
+    }
+    return true;
+}
+
+function Point(x, y) {
+    this.x = x;
+    this.y = y;
+}
+
+function points(n) {
+    var pts = [], sum = 0, i, j;
+
+    for(i = 0; i < 100; i++)
+        pts.push(new Point(i, 2*i));
+
+    for(j = 0; j < n; j++) {
+        for(i = 0; i < pts.length; i++)
+            sum += pts[i].x + pts[i].y;
+    }
+
+    return sum;
+}
+
+var count = sieve(100000);
+if(count !== 9592)
+    throw "sieve failed: " + count;
+
+if(!sort(300))
+    throw "sort failed";
+
+count = points(200);
+if(count !== 200 * 3 * 4950)
+    throw "points failed: " + count;
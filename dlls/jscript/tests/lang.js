@@ -1663,6 +1663,46 @@ ok(Date === 1, "Date = " + Date);
 Error = 1;
 ok(Error === 1, "Error = " + Error);
 
+tmp = [];
+for(i = 0; i < 100; i++)
+    tmp[i] = i;
+ok(tmp.length === 100, "tmp.length = " + tmp.length);
+for(i = 0; i < 100; i++)
+    ok(tmp[i] === i, "tmp[" + i + "] = " + tmp[i]);
+delete tmp[50];
+ok(tmp[50] === undefined, "tmp[50] = " + tmp[50]);
+ok(!(50 in tmp), "50 in tmp");
+tmp[50] = "x";
+ok(tmp[50] === "x", "tmp[50] = " + tmp[50]);
+ok(tmp["50"] === "x", "tmp[\"50\"] = " + tmp["50"]);
+ok(tmp[50.0] === "x", "tmp[50.0] = " + tmp[50.0]);
+tmp[1.5] = 2;
+ok(tmp["1.5"] === 2, "tmp[\"1.5\"] = " + tmp["1.5"]);
+ok(tmp.length === 100, "tmp.length = " + tmp.length);
+tmp[100000] = 3;
+ok(tmp.length === 100001, "tmp.length = " + tmp.length);
+ok(tmp[100000] === 3, "tmp[100000] = " + tmp[100000]);
+ok(tmp[99999] === undefined, "tmp[99999] = " + tmp[99999]);
+Array.prototype[1000] = "prot";
+ok(tmp[1000] === "prot", "tmp[1000] = " + tmp[1000]);
+tmp[1000] = "own";
+ok(tmp[1000] === "own", "tmp[1000] = " + tmp[1000]);
+ok([][1000] === "prot", "[][1000] = " + [][1000]);
+delete Array.prototype[1000];
+ok([][1000] === undefined, "[][1000] = " + [][1000]);
+
+function getA(o) {
+    return o.a;
+}
+var o1 = {a: 1, b: 2}, o2 = {b: 3, a: 4};
+ok(getA(o1) === 1, "getA(o1) = " + getA(o1));
+ok(getA(o2) === 4, "getA(o2) = " + getA(o2));
+ok(getA(o1) === 1, "getA(o1) = " + getA(o1));
+delete o1.a;
+ok(getA(o1) === undefined, "getA(o1) = " + getA(o1));
+o1.a = 5;
+ok(getA(o1) === 5, "getA(o1) = " + getA(o1));
+
 /* Keep this test in the end of file */
 undefined = 6;
 ok(undefined === 6, "undefined = " + undefined);
@@ -2886,6 +2886,7 @@ static void run_benchmarks(void)
 {
     trace("Running benchmarks...\n");
 
+    run_benchmark("access.js");
     run_benchmark("dna.js");
     run_benchmark("base64.js");
     run_benchmark("validateinput.js");
@@ -2910,6 +2911,57 @@ static BOOL check_jscript(void)
     return hres == S_OK;
 }
 
+static const char jit_test_script[] =
+    "function sum(n) { var i, r = 0; for(i = 0; i < n; i++) r += i; return r; }\n"
+    "function mix(a, b) { return a < b ? a - b : a * b / 2; }\n"
+    "function cat(a, b) { return a + b; }\n"
+    "function thrower(x) { if(x > 20) throw 'thrown'; return x; }\n"
+    "var i, r;\n"
+    "for(i = 0; i < 100; i++) {\n"
+    "    ok(sum(i) === i * (i - 1) / 2, 'sum(' + i + ') = ' + sum(i));\n"
+    "    ok(mix(i, 50) === (i < 50 ? i - 50 : i * 25), 'mix(' + i + ', 50) = ' + mix(i, 50));\n"
+    "    ok(mix(1.5, i) === (1.5 < i ? 1.5 - i : 0.75 * i), 'mix(1.5, ' + i + ') = ' + mix(1.5, i));\n"
+    "    ok(mix('5', 2) === 5, 'mix(\"5\", 2) = ' + mix('5', 2));\n"
+    "    ok(cat(i, 1) === i + 1, 'cat(' + i + ', 1) = ' + cat(i, 1));\n"
+    "    ok(cat('a', i) === 'a' + i, 'cat(\"a\", ' + i + ') = ' + cat('a', i));\n"
+    "    try {\n"
+    "        r = thrower(i);\n"
+    "        ok(i <= 20 && r === i, 'thrower(' + i + ') returned ' + r);\n"
+    "    }catch(e) {\n"
+    "        ok(i > 20 && e === 'thrown', 'thrower(' + i + ') threw ' + e);\n"
+    "    }\n"
+    "}\n";
+
+/* Runs the tests again with Wine's native code compiler enabled. */
+static void run_jit_tests(void)
+{
+    char prev[16];
+    DWORD size = sizeof(prev), type;
+    BOOL had_value;
+    HKEY hkey;
+    LONG res;
+
+    res = RegCreateKeyA(HKEY_CURRENT_USER, "Software\\Wine\\JScript", &hkey);
+    if(res != ERROR_SUCCESS) {
+        skip("Could not create JScript key: %d\n", res);
+        return;
+    }
+
+    had_value = !RegQueryValueExA(hkey, "JIT", NULL, &type, (BYTE*)prev, &size);
+    res = RegSetValueExA(hkey, "JIT", 0, REG_SZ, (const BYTE*)"enabled", sizeof("enabled"));
+    ok(res == ERROR_SUCCESS, "RegSetValueEx failed: %d\n", res);
+
+    parse_script_a(jit_test_script);
+    run_from_res("lang.js");
+    run_from_res("api.js");
+
+    if(had_value)
+        RegSetValueExA(hkey, "JIT", 0, type, (const BYTE*)prev, size);
+    else
+        RegDeleteValueA(hkey, "JIT");
+    RegCloseKey(hkey);
+}
+
 START_TEST(run)
 {
     int argc;
@@ -2936,6 +2988,8 @@ START_TEST(run)
             run_encoded_tests();
             trace("ParseProcedureText tests...\n");
             test_parse_proc();
+            trace("JIT tests...\n");
+            run_jit_tests();
         }
 
         if(winetest_interactive)
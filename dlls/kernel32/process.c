@@ -3974,13 +3974,161 @@ HRESULT WINAPI RegisterApplicationRecoveryCallback(APPLICATION_RECOVERY_CALLBACK
     return E_FAIL;
 }
 
+/* Returns NUMA node relationships from the system's logical processor information. */
+static SYSTEM_LOGICAL_PROCESSOR_INFORMATION *get_numa_nodes(DWORD *count)
+{
+    SYSTEM_LOGICAL_PROCESSOR_INFORMATION *info = NULL, *new_info;
+    DWORD len = 16 * sizeof(*info), i, nodes = 0;
+    NTSTATUS status;
+
+    for (;;)
+    {
+        if (info) new_info = HeapReAlloc( GetProcessHeap(), 0, info, len );
+        else new_info = HeapAlloc( GetProcessHeap(), 0, len );
+        if (!new_info)
+        {
+            HeapFree( GetProcessHeap(), 0, info );
+            return NULL;
+        }
+        info = new_info;
+
+        status = NtQuerySystemInformation( SystemLogicalProcessorInformation, info, len, &len );
+        if (status != STATUS_INFO_LENGTH_MISMATCH) break;
+    }
+
+    if (!status)
+    {
+        for (i = 0; i < len / sizeof(*info); i++)
+            if (info[i].Relationship == RelationNumaNode) info[nodes++] = info[i];
+    }
+
+    if (!nodes)
+    {
+        /* assume a single node containing all processors */
+        SYSTEM_INFO si;
+
+        GetSystemInfo( &si );
+        info[0].Relationship = RelationNumaNode;
+        info[0].ProcessorMask = si.dwActiveProcessorMask;
+        info[0].NumaNode.NodeNumber = 0;
+        nodes = 1;
+    }
+
+    *count = nodes;
+    return info;
+}
+
+static BOOL get_numa_node_mask( ULONG node, ULONGLONG *mask )
+{
+    SYSTEM_LOGICAL_PROCESSOR_INFORMATION *info;
+    DWORD count, i;
+    BOOL ret = FALSE;
+
+    if (!(info = get_numa_nodes( &count )))
+    {
+        SetLastError( ERROR_NOT_ENOUGH_MEMORY );
+        return FALSE;
+    }
+
+    for (i = 0; i < count; i++)
+    {
+        if (info[i].NumaNode.NodeNumber != node) continue;
+        *mask = info[i].ProcessorMask;
+        ret = TRUE;
+        break;
+    }
+
+    HeapFree( GetProcessHeap(), 0, info );
+    if (!ret) SetLastError( ERROR_INVALID_PARAMETER );
+    return ret;
+}
+
+static BOOL get_numa_processor_node( ULONG processor, USHORT *node )
+{
+    SYSTEM_LOGICAL_PROCESSOR_INFORMATION *info;
+    DWORD count, i;
+    BOOL ret = FALSE;
+
+    if (!(info = get_numa_nodes( &count )))
+    {
+        SetLastError( ERROR_NOT_ENOUGH_MEMORY );
+        return FALSE;
+    }
+
+    for (i = 0; processor < 8 * sizeof(ULONG_PTR) && i < count; i++)
+    {
+        if (!(info[i].ProcessorMask & ((ULONG_PTR)1 << processor))) continue;
+        *node = info[i].NumaNode.NodeNumber;
+        ret = TRUE;
+        break;
+    }
+
+    HeapFree( GetProcessHeap(), 0, info );
+    if (!ret) SetLastError( ERROR_INVALID_PARAMETER );
+    return ret;
+}
+
+static BOOL get_numa_available_memory( ULONG node, ULONGLONG *available_bytes )
+{
+    MEMORYSTATUSEX status;
+    ULONGLONG mask;
+    ULONG highest;
+#ifdef __linux__
+    char name[64], line[256];
+    unsigned long long value;
+    unsigned int id;
+    FILE *f;
+#endif
+
+    if (!get_numa_node_mask( node, &mask )) return FALSE;
+
+#ifdef __linux__
+    sprintf( name, "/sys/devices/system/node/node%u/meminfo", node );
+    if ((f = fopen( name, "r" )))
+    {
+        BOOL ret = FALSE;
+
+        while (!ret && fgets( line, sizeof(line), f ))
+        {
+            if (sscanf( line, "Node %u MemFree: %llu kB", &id, &value ) == 2)
+            {
+                *available_bytes = value * 1024;
+                ret = TRUE;
+            }
+        }
+        fclose( f );
+        if (ret) return TRUE;
+    }
+#endif
+
+    /* without per-node information, all memory is considered local to node 0 */
+    status.dwLength = sizeof(status);
+    if (!GetNumaHighestNodeNumber( &highest ) || !GlobalMemoryStatusEx( &status )) return FALSE;
+    *available_bytes = (node || highest) ? 0 : status.ullAvailPhys;
+    return TRUE;
+}
+
 /**********************************************************************
  *           GetNumaHighestNodeNumber     (KERNEL32.@)
  */
 BOOL WINAPI GetNumaHighestNodeNumber(PULONG highestnode)
 {
+    SYSTEM_LOGICAL_PROCESSOR_INFORMATION *info;
+    DWORD count, i;
+
+    TRACE("(%p)\n", highestnode);
+
+    if (!(info = get_numa_nodes( &count )))
+    {
+        SetLastError( ERROR_NOT_ENOUGH_MEMORY );
+        return FALSE;
+    }
+
     *highestnode = 0;
-    FIXME("(%p): semi-stub\n", highestnode);
+    for (i = 0; i < count; i++)
+        *highestnode = max( *highestnode, info[i].NumaNode.NodeNumber );
+
+    HeapFree( GetProcessHeap(), 0, info );
     return TRUE;
 }
 
@@ -3989,9 +4137,24 @@ BOOL WINAPI GetNumaHighestNodeNumber(PULONG highestnode)
  */
 BOOL WINAPI GetNumaNodeProcessorMask(UCHAR node, PULONGLONG mask)
 {
-    FIXME("(%c %p): stub\n", node, mask);
-    SetLastError(ERROR_CALL_NOT_IMPLEMENTED);
-    return FALSE;
+    TRACE("(%d %p)\n", node, mask);
+    return get_numa_node_mask( node, mask );
+}
+
+/**********************************************************************
+ *           GetNumaNodeProcessorMaskEx     (KERNEL32.@)
+ */
+BOOL WINAPI GetNumaNodeProcessorMaskEx(USHORT node, PGROUP_AFFINITY mask)
+{
+    ULONGLONG processors;
+
+    TRACE("(%d %p)\n", node, mask);
+
+    if (!get_numa_node_mask( node, &processors )) return FALSE;
+
+    memset( mask, 0, sizeof(*mask) );
+    mask->Mask = processors;
+    return TRUE;
 }
 
 /**********************************************************************
@@ -3999,9 +4162,17 @@ BOOL WINAPI GetNumaNodeProcessorMask(UCHAR node, PULONGLONG mask)
  */
 BOOL WINAPI GetNumaAvailableMemoryNode(UCHAR node, PULONGLONG available_bytes)
 {
-    FIXME("(%c %p): stub\n", node, available_bytes);
-    SetLastError(ERROR_CALL_NOT_IMPLEMENTED);
-    return FALSE;
+    TRACE("(%d %p)\n", node, available_bytes);
+    return get_numa_available_memory( node, available_bytes );
+}
+
+/**********************************************************************
+ *           GetNumaAvailableMemoryNodeEx     (KERNEL32.@)
+ */
+BOOL WINAPI GetNumaAvailableMemoryNodeEx(USHORT node, PULONGLONG available_bytes)
+{
+    TRACE("(%d %p)\n", node, available_bytes);
+    return get_numa_available_memory( node, available_bytes );
 }
 
 /***********************************************************************
@@ -4009,20 +4180,35 @@ BOOL WINAPI GetNumaAvailableMemoryNode(UCHAR node, PULONGLONG available_bytes)
  */
 BOOL WINAPI GetNumaProcessorNode(UCHAR processor, PUCHAR node)
 {
-    SYSTEM_INFO si;
+    USHORT ret;
 
     TRACE("(%d, %p)\n", processor, node);
 
-    GetSystemInfo( &si );
-    if (processor < si.dwNumberOfProcessors)
+    if (!get_numa_processor_node( processor, &ret ))
     {
-        *node = 0;
-        return TRUE;
+        *node = 0xFF;
+        return FALSE;
     }
 
-    *node = 0xFF;
-    SetLastError(ERROR_INVALID_PARAMETER);
-    return FALSE;
+    *node = ret;
+    return TRUE;
+}
+
+/***********************************************************************
+ *           GetNumaProcessorNodeEx (KERNEL32.@)
+ */
+BOOL WINAPI GetNumaProcessorNodeEx(PPROCESSOR_NUMBER processor, PUSHORT node)
+{
+    TRACE("(%p, %p)\n", processor, node);
+
+    if (processor->Group || !get_numa_processor_node( processor->Number, node ))
+    {
+        *node = 0xFFFF;
+        SetLastError( ERROR_INVALID_PARAMETER );
+        return FALSE;
+    }
+
+    return TRUE;
 }
 
 /**********************************************************************
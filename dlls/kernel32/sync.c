@@ -40,6 +40,7 @@
 #include "winioctl.h"
 #include "ddk/wdm.h"
 
+#include "wine/server.h"
 #include "wine/unicode.h"
 #include "kernel_private.h"
 
@@ -1716,6 +1717,60 @@ BOOL WINAPI GetNamedPipeInfo(
     return TRUE;
 }
 
+/***********************************************************************
+ *           get_pipe_process_id
+ *
+ * Helper for GetNamedPipeClientProcessId and GetNamedPipeServerProcessId.
+ */
+static BOOL get_pipe_process_id( HANDLE pipe, ULONG *id, BOOL server )
+{
+    NTSTATUS status;
+
+    TRACE( "%p %p\n", pipe, id );
+
+    if (!id)
+    {
+        SetLastError( ERROR_INVALID_PARAMETER );
+        return FALSE;
+    }
+
+    SERVER_START_REQ( get_named_pipe_info )
+    {
+        req->handle = wine_server_obj_handle( pipe );
+        if (!(status = wine_server_call( req )))
+            *id = server ? reply->server_pid : reply->client_pid;
+    }
+    SERVER_END_REQ;
+
+    if (status)
+    {
+        SetLastError( RtlNtStatusToDosError(status) );
+        return FALSE;
+    }
+    if (!*id)
+    {
+        SetLastError( ERROR_PIPE_NOT_CONNECTED );
+        return FALSE;
+    }
+    return TRUE;
+}
+
+/***********************************************************************
+ *           GetNamedPipeClientProcessId  (KERNEL32.@)
+ */
+BOOL WINAPI GetNamedPipeClientProcessId( HANDLE pipe, ULONG *id )
+{
+    return get_pipe_process_id( pipe, id, FALSE );
+}
+
+/***********************************************************************
+ *           GetNamedPipeServerProcessId  (KERNEL32.@)
+ */
+BOOL WINAPI GetNamedPipeServerProcessId( HANDLE pipe, ULONG *id )
+{
+    return get_pipe_process_id( pipe, id, TRUE );
+}
+
 /***********************************************************************
  *           GetNamedPipeHandleStateA  (KERNEL32.@)
  */
@@ -1095,6 +1095,88 @@ static void test_ffcn_directory_overlap(void)
     ok(ret, "RemoveDirectoryA error: %d\n", GetLastError());
 }
 
+static void test_readdirectorychanges_many(void)
+{
+    char path[MAX_PATH], file[MAX_PATH];
+    FILE_NOTIFY_INFORMATION *pfni;
+    DWORD ticks, size, count, added, i;
+    BOOL enum_dir = FALSE;
+    char *buffer;
+    OVERLAPPED ov;
+    HANDLE hdir, hfile;
+    BOOL ret;
+
+    if (!pReadDirectoryChangesW)
+    {
+        win_skip("ReadDirectoryChangesW is not available\n");
+        return;
+    }
+
+    count = winetest_interactive ? 20000 : 500;
+
+    GetTempPathA(MAX_PATH, path);
+    lstrcatA(path, "many");
+    RemoveDirectoryA(path);
+    ret = CreateDirectoryA(path, NULL);
+    ok(ret, "failed to create directory %u\n", GetLastError());
+
+    hdir = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ|FILE_SHARE_WRITE|FILE_SHARE_DELETE,
+                       NULL, OPEN_EXISTING, FILE_FLAG_BACKUP_SEMANTICS | FILE_FLAG_OVERLAPPED, NULL);
+    ok(hdir != INVALID_HANDLE_VALUE, "failed to open directory\n");
+
+    buffer = HeapAlloc(GetProcessHeap(), 0, 0x10000);
+    memset(&ov, 0, sizeof(ov));
+    ov.hEvent = CreateEventW(NULL, FALSE, FALSE, NULL);
+    ret = pReadDirectoryChangesW(hdir, buffer, 0x10000, FALSE, FILE_NOTIFY_CHANGE_FILE_NAME,
+                                 NULL, &ov, NULL);
+    ok(ret, "ReadDirectoryChangesW failed %u\n", GetLastError());
+
+    ticks = GetTickCount();
+    for (i = 0; i < count; i++)
+    {
+        sprintf(file, "%s\\file%u", path, i);
+        hfile = CreateFileA(file, GENERIC_WRITE, 0, NULL, CREATE_ALWAYS, 0, NULL);
+        ok(hfile != INVALID_HANDLE_VALUE, "failed to create file %u\n", GetLastError());
+        CloseHandle(hfile);
+    }
+
+    /* either all the changes are returned, or we're told to enumerate the directory */
+    added = 0;
+    while (added < count && !WaitForSingleObject(ov.hEvent, 1000))
+    {
+        ret = GetOverlappedResult(hdir, &ov, &size, FALSE);
+        if (!ret || (NTSTATUS)ov.Internal == STATUS_NOTIFY_ENUM_DIR)
+        {
+            enum_dir = TRUE;
+            break;
+        }
+        for (pfni = (FILE_NOTIFY_INFORMATION *)buffer; size; )
+        {
+            if (pfni->Action == FILE_ACTION_ADDED) added++;
+            if (!pfni->NextEntryOffset) break;
+            pfni = (FILE_NOTIFY_INFORMATION *)((char *)pfni + pfni->NextEntryOffset);
+        }
+        ret = pReadDirectoryChangesW(hdir, buffer, 0x10000, FALSE, FILE_NOTIFY_CHANGE_FILE_NAME,
+                                     NULL, &ov, NULL);
+        ok(ret, "ReadDirectoryChangesW failed %u\n", GetLastError());
+    }
+    ticks = GetTickCount() - ticks;
+    ok(added == count || enum_dir, "got %u/%u changes\n", added, count);
+    trace("%u file creations notified in %u ms%s\n", added, ticks, enum_dir ? " (overflow)" : "");
+
+    CloseHandle(hdir);
+    CloseHandle(ov.hEvent);
+    HeapFree(GetProcessHeap(), 0, buffer);
+
+    for (i = 0; i < count; i++)
+    {
+        sprintf(file, "%s\\file%u", path, i);
+        DeleteFileA(file);
+    }
+    ret = RemoveDirectoryA(path);
+    ok(ret, "failed to remove directory %u\n", GetLastError());
+}
+
 START_TEST(change)
 {
     HMODULE hkernel32 = GetModuleHandleA("kernel32.dll");
@@ -1110,5 +1192,6 @@ START_TEST(change)
     test_readdirectorychanges_null();
     test_readdirectorychanges_filedir();
     test_readdirectorychanges_cr();
+    test_readdirectorychanges_many();
     test_ffcn_directory_overlap();
 }
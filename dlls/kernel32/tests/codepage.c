@@ -995,6 +995,90 @@ static void test_undefined_byte_char(void)
     }
 }
 
+static void test_utf8_ascii_runs(void)
+{
+    char src[128], dst[128], *big;
+    WCHAR wsrc[128], wdst[128], *wbig;
+    int run, pos, len, wlen, ret, i;
+    DWORD ticks;
+
+    /* runs of ASCII chars of various lengths around a non-ASCII char */
+    for (run = 0; run < 40; run++)
+    {
+        for (pos = 0; pos <= run; pos++)
+        {
+            len = wlen = 0;
+            for (i = 0; i < run; i++)
+            {
+                if (i == pos)
+                {
+                    src[len++] = 0xe2;
+                    src[len++] = 0x82;
+                    src[len++] = 0xac;
+                    wsrc[wlen++] = 0x20ac;
+                }
+                src[len++] = 'a' + i % 26;
+                wsrc[wlen++] = 'a' + i % 26;
+            }
+
+            memset(wdst, 0xcc, sizeof(wdst));
+            ret = MultiByteToWideChar(CP_UTF8, 0, src, len, wdst, sizeof(wdst) / sizeof(WCHAR));
+            ok(ret == wlen, "%d/%d: expected %d, got %d\n", run, pos, wlen, ret);
+            ok(!memcmp(wdst, wsrc, wlen * sizeof(WCHAR)), "%d/%d: wrong data %s\n",
+               run, pos, wine_dbgstr_wn(wdst, ret));
+            ret = MultiByteToWideChar(CP_UTF8, 0, src, len, NULL, 0);
+            ok(ret == wlen, "%d/%d: expected %d, got %d\n", run, pos, wlen, ret);
+            if (wlen)
+            {
+                SetLastError(0xdeadbeef);
+                ret = MultiByteToWideChar(CP_UTF8, 0, src, len, wdst, wlen - 1);
+                ok(!ret && GetLastError() == ERROR_INSUFFICIENT_BUFFER,
+                   "%d/%d: got %d, error %u\n", run, pos, ret, GetLastError());
+            }
+
+            memset(dst, 0xcc, sizeof(dst));
+            ret = WideCharToMultiByte(CP_UTF8, 0, wsrc, wlen, dst, sizeof(dst), NULL, NULL);
+            ok(ret == len, "%d/%d: expected %d, got %d\n", run, pos, len, ret);
+            ok(!memcmp(dst, src, len), "%d/%d: wrong data\n", run, pos);
+            ret = WideCharToMultiByte(CP_UTF8, 0, wsrc, wlen, NULL, 0, NULL, NULL);
+            ok(ret == len, "%d/%d: expected %d, got %d\n", run, pos, len, ret);
+            if (len)
+            {
+                SetLastError(0xdeadbeef);
+                ret = WideCharToMultiByte(CP_UTF8, 0, wsrc, wlen, dst, len - 1, NULL, NULL);
+                ok(!ret && GetLastError() == ERROR_INSUFFICIENT_BUFFER,
+                   "%d/%d: got %d, error %u\n", run, pos, ret, GetLastError());
+            }
+        }
+    }
+
+    /* mostly ASCII text, with an accented letter every few words */
+    len = 0x100000;
+    big = HeapAlloc(GetProcessHeap(), 0, len);
+    wbig = HeapAlloc(GetProcessHeap(), 0, len * sizeof(WCHAR));
+    for (i = 0; i < len; i++) big[i] = (i % 7) ? 'a' + i % 26 : ' ';
+    for (i = 0; i < len - 1; i += 50)
+    {
+        big[i] = 0xc3;
+        big[i + 1] = 0xa9;
+    }
+
+    ticks = GetTickCount();
+    for (i = 0; i < 50; i++)
+        wlen = MultiByteToWideChar(CP_UTF8, 0, big, len, wbig, len);
+    ok(wlen == len - len / 50 - 1, "got %d\n", wlen);
+    trace("MultiByteToWideChar(CP_UTF8): %u ms for 50MB\n", GetTickCount() - ticks);
+
+    ticks = GetTickCount();
+    for (i = 0; i < 50; i++)
+        ret = WideCharToMultiByte(CP_UTF8, 0, wbig, wlen, big, len, NULL, NULL);
+    ok(ret == len, "got %d\n", ret);
+    trace("WideCharToMultiByte(CP_UTF8): %u ms for 50MB\n", GetTickCount() - ticks);
+
+    HeapFree(GetProcessHeap(), 0, big);
+    HeapFree(GetProcessHeap(), 0, wbig);
+}
+
 static void test_threadcp(void)
 {
     static const LCID ENGLISH  = MAKELCID(MAKELANGID(LANG_ENGLISH,  SUBLANG_ENGLISH_US),         SORT_DEFAULT);
@@ -1268,6 +1352,7 @@ START_TEST(codepage)
 
     test_utf7_encoding();
     test_utf7_decoding();
+    test_utf8_ascii_runs();
 
     test_undefined_byte_char();
     test_threadcp();
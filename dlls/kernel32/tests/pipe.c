@@ -36,6 +36,8 @@ static HANDLE alarm_event;
 static BOOL (WINAPI *pDuplicateTokenEx)(HANDLE,DWORD,LPSECURITY_ATTRIBUTES,
                                         SECURITY_IMPERSONATION_LEVEL,TOKEN_TYPE,PHANDLE);
 static DWORD (WINAPI *pQueueUserAPC)(PAPCFUNC pfnAPC, HANDLE hThread, ULONG_PTR dwData);
+static BOOL (WINAPI *pGetNamedPipeClientProcessId)(HANDLE,PULONG);
+static BOOL (WINAPI *pGetNamedPipeServerProcessId)(HANDLE,PULONG);
 
 static BOOL user_apc_ran;
 static void CALLBACK user_apc(ULONG_PTR param)
@@ -2411,6 +2413,106 @@ todo_wine
     CloseHandle(event);
 }
 
+static DWORD CALLBACK ping_pong_server(LPVOID arg)
+{
+    HANDLE pipe = arg;
+    char buf[64];
+    DWORD num;
+    BOOL ret;
+
+    for (;;)
+    {
+        ret = ReadFile(pipe, buf, sizeof(buf), &num, NULL);
+        if (!ret || !num) break;
+        ret = WriteFile(pipe, buf, num, &num, NULL);
+        ok(ret, "WriteFile failed with %u\n", GetLastError());
+        /* rpcrt4 flushes the pipe after each write, do the same */
+        ret = FlushFileBuffers(pipe);
+        ok(ret, "FlushFileBuffers failed with %u\n", GetLastError());
+    }
+    return 0;
+}
+
+static void test_ping_pong(void)
+{
+    HANDLE server, client, thread;
+    DWORD num, ticks, count, i;
+    char buf[64];
+    BOOL ret;
+
+    count = winetest_interactive ? 10000 : 200;
+
+    server = CreateNamedPipeA(PIPENAME, PIPE_ACCESS_DUPLEX, PIPE_TYPE_BYTE | PIPE_WAIT,
+                              1, 1024, 1024, NMPWAIT_USE_DEFAULT_WAIT, NULL);
+    ok(server != INVALID_HANDLE_VALUE, "CreateNamedPipe failed with %u\n", GetLastError());
+    client = CreateFileA(PIPENAME, GENERIC_READ|GENERIC_WRITE, 0, NULL, OPEN_EXISTING, 0, NULL);
+    ok(client != INVALID_HANDLE_VALUE, "CreateFile failed with %u\n", GetLastError());
+    thread = CreateThread(NULL, 0, ping_pong_server, server, 0, NULL);
+
+    memset(buf, 0x55, sizeof(buf));
+    ticks = GetTickCount();
+    for (i = 0; i < count; i++)
+    {
+        ret = WriteFile(client, buf, sizeof(buf), &num, NULL);
+        ok(ret && num == sizeof(buf), "WriteFile failed with %u\n", GetLastError());
+        ret = ReadFile(client, buf, sizeof(buf), &num, NULL);
+        ok(ret && num == sizeof(buf), "ReadFile failed with %u, got %u bytes\n", GetLastError(), num);
+        if (!ret) break;
+    }
+    ticks = GetTickCount() - ticks;
+    trace("%u pipe round trips in %u ms\n", i, ticks);
+
+    CloseHandle(client);
+    ok(WaitForSingleObject(thread, 10000) == WAIT_OBJECT_0, "server thread didn't exit\n");
+    CloseHandle(thread);
+    CloseHandle(server);
+}
+
+static void test_pipe_process_id(void)
+{
+    HANDLE server, client;
+    ULONG pid;
+    BOOL ret;
+
+    if (!pGetNamedPipeClientProcessId || !pGetNamedPipeServerProcessId)
+    {
+        win_skip("GetNamedPipeClientProcessId not available\n");
+        return;
+    }
+
+    server = CreateNamedPipeA(PIPENAME, PIPE_ACCESS_DUPLEX, PIPE_TYPE_BYTE | PIPE_WAIT,
+                              1, 1024, 1024, NMPWAIT_USE_DEFAULT_WAIT, NULL);
+    ok(server != INVALID_HANDLE_VALUE, "CreateNamedPipe failed: %u\n", GetLastError());
+
+    pid = 0;
+    ret = pGetNamedPipeServerProcessId(server, &pid);
+    ok(ret, "GetNamedPipeServerProcessId failed: %u\n", GetLastError());
+    ok(pid == GetCurrentProcessId(), "got pid %04x\n", pid);
+
+    client = CreateFileA(PIPENAME, GENERIC_READ | GENERIC_WRITE, 0, NULL, OPEN_EXISTING, 0, NULL);
+    ok(client != INVALID_HANDLE_VALUE, "CreateFile failed: %u\n", GetLastError());
+
+    pid = 0;
+    ret = pGetNamedPipeClientProcessId(server, &pid);
+    ok(ret, "GetNamedPipeClientProcessId failed: %u\n", GetLastError());
+    ok(pid == GetCurrentProcessId(), "got pid %04x\n", pid);
+    pid = 0;
+    ret = pGetNamedPipeClientProcessId(client, &pid);
+    ok(ret, "GetNamedPipeClientProcessId failed: %u\n", GetLastError());
+    ok(pid == GetCurrentProcessId(), "got pid %04x\n", pid);
+    pid = 0;
+    ret = pGetNamedPipeServerProcessId(client, &pid);
+    ok(ret, "GetNamedPipeServerProcessId failed: %u\n", GetLastError());
+    ok(pid == GetCurrentProcessId(), "got pid %04x\n", pid);
+
+    SetLastError(0xdeadbeef);
+    ret = pGetNamedPipeClientProcessId(GetCurrentProcess(), &pid);
+    ok(!ret, "GetNamedPipeClientProcessId succeeded on a process handle\n");
+
+    CloseHandle(client);
+    CloseHandle(server);
+}
+
 START_TEST(pipe)
 {
     HMODULE hmod;
@@ -2419,6 +2521,8 @@ START_TEST(pipe)
     pDuplicateTokenEx = (void *) GetProcAddress(hmod, "DuplicateTokenEx");
     hmod = GetModuleHandleA("kernel32.dll");
     pQueueUserAPC = (void *) GetProcAddress(hmod, "QueueUserAPC");
+    pGetNamedPipeClientProcessId = (void *) GetProcAddress(hmod, "GetNamedPipeClientProcessId");
+    pGetNamedPipeServerProcessId = (void *) GetProcAddress(hmod, "GetNamedPipeServerProcessId");
 
     if (test_DisconnectNamedPipe())
         return;
@@ -2433,4 +2537,6 @@ START_TEST(pipe)
     test_overlapped_error();
     test_NamedPipeHandleState();
     test_readfileex_pending();
+    test_ping_pong();
+    test_pipe_process_id();
 }
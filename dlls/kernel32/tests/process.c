@@ -78,6 +78,9 @@ static BOOL   (WINAPI *pQueryInformationJobObject)(HANDLE job, JOBOBJECTINFOCLAS
 static BOOL   (WINAPI *pSetInformationJobObject)(HANDLE job, JOBOBJECTINFOCLASS class, LPVOID info, DWORD len);
 static HANDLE (WINAPI *pCreateIoCompletionPort)(HANDLE file, HANDLE existing_port, ULONG_PTR key, DWORD threads);
 static BOOL   (WINAPI *pGetNumaProcessorNode)(UCHAR, PUCHAR);
+static BOOL   (WINAPI *pGetNumaHighestNodeNumber)(PULONG);
+static BOOL   (WINAPI *pGetNumaNodeProcessorMask)(UCHAR, PULONGLONG);
+static BOOL   (WINAPI *pGetNumaAvailableMemoryNode)(UCHAR, PULONGLONG);
 static NTSTATUS (WINAPI *pNtQueryInformationProcess)(HANDLE, PROCESSINFOCLASS, PVOID, ULONG, PULONG);
 static BOOL   (WINAPI *pProcessIdToSessionId)(DWORD,DWORD*);
 static DWORD  (WINAPI *pWTSGetActiveConsoleSessionId)(void);
@@ -243,6 +246,9 @@ static BOOL init(void)
     pSetInformationJobObject = (void *)GetProcAddress(hkernel32, "SetInformationJobObject");
     pCreateIoCompletionPort = (void *)GetProcAddress(hkernel32, "CreateIoCompletionPort");
     pGetNumaProcessorNode = (void *)GetProcAddress(hkernel32, "GetNumaProcessorNode");
+    pGetNumaHighestNodeNumber = (void *)GetProcAddress(hkernel32, "GetNumaHighestNodeNumber");
+    pGetNumaNodeProcessorMask = (void *)GetProcAddress(hkernel32, "GetNumaNodeProcessorMask");
+    pGetNumaAvailableMemoryNode = (void *)GetProcAddress(hkernel32, "GetNumaAvailableMemoryNode");
     pProcessIdToSessionId = (void *)GetProcAddress(hkernel32, "ProcessIdToSessionId");
     pWTSGetActiveConsoleSessionId = (void *)GetProcAddress(hkernel32, "WTSGetActiveConsoleSessionId");
     pCreateToolhelp32Snapshot = (void *)GetProcAddress(hkernel32, "CreateToolhelp32Snapshot");
@@ -2922,6 +2928,56 @@ static void test_GetNumaProcessorNode(void)
     }
 }
 
+static void test_GetNumaNodeProcessorMask(void)
+{
+    ULONGLONG mask, all_mask = 0, available;
+    SYSTEM_INFO si;
+    ULONG highest;
+    UCHAR node;
+    BOOL ret;
+    int i;
+
+    if (!pGetNumaHighestNodeNumber || !pGetNumaNodeProcessorMask || !pGetNumaAvailableMemoryNode)
+    {
+        win_skip("NUMA functions are missing\n");
+        return;
+    }
+
+    highest = 0xdeadbeef;
+    ret = pGetNumaHighestNodeNumber(&highest);
+    ok(ret, "GetNumaHighestNodeNumber failed, error %u\n", GetLastError());
+    ok(highest < 64, "got highest node %u\n", highest);
+
+    for (i = 0; i <= highest; i++)
+    {
+        mask = 0xdeadbeef;
+        ret = pGetNumaNodeProcessorMask(i, &mask);
+        ok(ret, "GetNumaNodeProcessorMask failed for node %d, error %u\n", i, GetLastError());
+        ok(!(mask & all_mask), "node %d overlaps with other nodes\n", i);
+        all_mask |= mask;
+
+        available = 0xdeadbeef;
+        ret = pGetNumaAvailableMemoryNode(i, &available);
+        ok(ret, "GetNumaAvailableMemoryNode failed for node %d, error %u\n", i, GetLastError());
+        ok(available != 0xdeadbeef, "available memory not set for node %d\n", i);
+    }
+
+    GetSystemInfo(&si);
+    if (si.dwNumberOfProcessors <= 8 * sizeof(ULONG_PTR))
+        ok(all_mask == si.dwActiveProcessorMask, "expected processor mask %lx, got %x%08x\n",
+           si.dwActiveProcessorMask, (DWORD)(all_mask >> 32), (DWORD)all_mask);
+
+    for (i = 0; i < si.dwNumberOfProcessors && i < 64; i++)
+    {
+        if (!pGetNumaProcessorNode) break;
+        ret = pGetNumaProcessorNode(i, &node);
+        ok(ret, "GetNumaProcessorNode failed for processor %d\n", i);
+        ret = pGetNumaNodeProcessorMask(node, &mask);
+        ok(ret, "GetNumaNodeProcessorMask failed for node %u\n", node);
+        ok(mask & ((ULONGLONG)1 << i), "processor %d is not in the mask of node %u\n", i, node);
+    }
+}
+
 static void test_session_info(void)
 {
     DWORD session_id, active_session;
@@ -3211,6 +3267,7 @@ START_TEST(process)
     test_DuplicateHandle();
     test_StartupNoConsole();
     test_GetNumaProcessorNode();
+    test_GetNumaNodeProcessorMask();
     test_session_info();
     test_GetLogicalProcessorInformationEx();
     test_largepages();
@@ -46,6 +46,8 @@ struct thiscall_thunk
 
 static ULONG_PTR (WINAPI *call_thiscall_func1)( void *func, void *this );
 static ULONG_PTR (WINAPI *call_thiscall_func2)( void *func, void *this, const void *a );
+static ULONG_PTR (WINAPI *call_thiscall_func3)( void *func, void *this, const void *a,
+        const void *b );
 
 static void init_thiscall_thunk(void)
 {
@@ -58,16 +60,19 @@ static void init_thiscall_thunk(void)
     thunk->jmp_edx  = 0xe2ff; /* jmp  *%edx */
     call_thiscall_func1 = (void *)thunk;
     call_thiscall_func2 = (void *)thunk;
+    call_thiscall_func3 = (void *)thunk;
 }
 
 #define call_func1(func,_this) call_thiscall_func1(func,_this)
 #define call_func2(func,_this,a) call_thiscall_func2(func,_this,(const void*)(a))
+#define call_func3(func,_this,a,b) call_thiscall_func3(func,_this,(const void*)(a),(const void*)(b))
 
 #else
 
 #define init_thiscall_thunk()
 #define call_func1(func,_this) func(_this)
 #define call_func2(func,_this,a) func(_this,a)
+#define call_func3(func,_this,a,b) func(_this,a,b)
 
 #endif /* __i386__ */
 
@@ -103,6 +108,54 @@ typedef struct
     int unknown2[2];
 } critical_section_scoped_lock;
 
+typedef enum
+{
+    SchedulerKind,
+    MaxConcurrency,
+    MinConcurrency,
+    TargetOversubscriptionFactor,
+    LocalContextCacheSize,
+    ContextStackSize,
+    ContextPriority,
+    SchedulingProtocol,
+    DynamicProgressFeedback,
+    WinRTInitialization
+} PolicyElementKey;
+
+typedef struct
+{
+    void *policy_container;
+} SchedulerPolicy;
+
+typedef struct
+{
+    const void **vtable;
+} Context;
+
+typedef struct _UnrealizedChore
+{
+    const void *vtable;
+    void (__cdecl *chore_proc)(struct _UnrealizedChore*);
+    void *task_collection;
+    void *chore_wrapper;
+    MSVCRT_bool runtime_owns_lifetime;
+    MSVCRT_bool detached;
+    void *unknown[4];
+} _UnrealizedChore;
+
+typedef struct
+{
+    /* the collections are allocated inline by the PPL headers */
+    void *data[16];
+} task_collection;
+
+enum
+{
+    TASK_COLLECTION_NOT_COMPLETE,
+    TASK_COLLECTION_SUCCESS,
+    TASK_COLLECTION_CANCELLED
+};
+
 static inline float __port_infinity(void)
 {
     static const unsigned __inf_bytes = 0x7f800000;
@@ -188,6 +241,27 @@ static critical_section_scoped_lock* (__thiscall *p_critical_section_scoped_lock
     (critical_section_scoped_lock*, critical_section *);
 static void (__thiscall *p_critical_section_scoped_lock_dtor)(critical_section_scoped_lock*);
 
+static SchedulerPolicy* (__thiscall *p_SchedulerPolicy_ctor)(SchedulerPolicy*);
+static SchedulerPolicy* (__cdecl *p_SchedulerPolicy_ctor_policies)(SchedulerPolicy*, size_t, ...);
+static void (__thiscall *p_SchedulerPolicy_dtor)(SchedulerPolicy*);
+static unsigned int (__thiscall *p_SchedulerPolicy_GetPolicyValue)(const SchedulerPolicy*, PolicyElementKey);
+static unsigned int (__thiscall *p_SchedulerPolicy_SetPolicyValue)(SchedulerPolicy*, PolicyElementKey, unsigned int);
+static void (__cdecl *p_CurrentScheduler_Create)(const SchedulerPolicy*);
+static void (__cdecl *p_CurrentScheduler_Detach)(void);
+static unsigned int (__cdecl *p_CurrentScheduler_Id)(void);
+static unsigned int (__cdecl *p_CurrentScheduler_GetNumberOfVirtualProcessors)(void);
+static void (__cdecl *p_CurrentScheduler_ScheduleTask)(void (__cdecl*)(void*), void*);
+static Context* (__cdecl *p_Context_CurrentContext)(void);
+static unsigned int (__cdecl *p_Context_Id)(void);
+static void (__cdecl *p_Context_Block)(void);
+static task_collection* (__thiscall *p__StructuredTaskCollection_ctor)(task_collection*, void*);
+static void (__thiscall *p__StructuredTaskCollection__Schedule)(task_collection*, _UnrealizedChore*);
+static int (WINAPI *p__StructuredTaskCollection__RunAndWait)(task_collection*, _UnrealizedChore*);
+static task_collection* (__thiscall *p__TaskCollection_ctor)(task_collection*);
+static void (__thiscall *p__TaskCollection_dtor)(task_collection*);
+static void (__thiscall *p__TaskCollection__Schedule)(task_collection*, _UnrealizedChore*);
+static int (WINAPI *p__TaskCollection__RunAndWait)(task_collection*, _UnrealizedChore*);
+
 #define SETNOFAIL(x,y) x = (void*)GetProcAddress(module,y)
 #define SET(x,y) do { SETNOFAIL(x,y); ok(x != NULL, "Export '%s' not found\n", y); } while(0)
 
@@ -240,6 +314,36 @@ static BOOL init(void)
                 "??0scoped_lock@critical_section@Concurrency@@QEAA@AEAV12@@Z");
         SET(p_critical_section_scoped_lock_dtor,
                 "??1scoped_lock@critical_section@Concurrency@@QEAA@XZ");
+        SET(p_SchedulerPolicy_ctor,
+                "??0SchedulerPolicy@Concurrency@@QEAA@XZ");
+        SET(p_SchedulerPolicy_ctor_policies,
+                "??0SchedulerPolicy@Concurrency@@QEAA@_KZZ");
+        SET(p_SchedulerPolicy_dtor,
+                "??1SchedulerPolicy@Concurrency@@QEAA@XZ");
+        SET(p_SchedulerPolicy_GetPolicyValue,
+                "?GetPolicyValue@SchedulerPolicy@Concurrency@@QEBAIW4PolicyElementKey@2@@Z");
+        SET(p_SchedulerPolicy_SetPolicyValue,
+                "?SetPolicyValue@SchedulerPolicy@Concurrency@@QEAAIW4PolicyElementKey@2@I@Z");
+        SET(p_CurrentScheduler_Create,
+                "?Create@CurrentScheduler@Concurrency@@SAXAEBVSchedulerPolicy@2@@Z");
+        SET(p_CurrentScheduler_ScheduleTask,
+                "?ScheduleTask@CurrentScheduler@Concurrency@@SAXP6AXPEAX@Z0@Z");
+        SET(p_Context_CurrentContext,
+                "?CurrentContext@Context@Concurrency@@SAPEAV12@XZ");
+        SET(p__StructuredTaskCollection_ctor,
+                "??0_StructuredTaskCollection@details@Concurrency@@QEAA@PEAV_CancellationTokenState@12@@Z");
+        SET(p__StructuredTaskCollection__Schedule,
+                "?_Schedule@_StructuredTaskCollection@details@Concurrency@@QEAAXPEAV_UnrealizedChore@23@@Z");
+        SET(p__StructuredTaskCollection__RunAndWait,
+                "?_RunAndWait@_StructuredTaskCollection@details@Concurrency@@QEAA?AW4_TaskCollectionStatus@23@PEAV_UnrealizedChore@23@@Z");
+        SET(p__TaskCollection_ctor,
+                "??0_TaskCollection@details@Concurrency@@QEAA@XZ");
+        SET(p__TaskCollection_dtor,
+                "??1_TaskCollection@details@Concurrency@@QEAA@XZ");
+        SET(p__TaskCollection__Schedule,
+                "?_Schedule@_TaskCollection@details@Concurrency@@QEAAXPEAV_UnrealizedChore@23@@Z");
+        SET(p__TaskCollection__RunAndWait,
+                "?_RunAndWait@_TaskCollection@details@Concurrency@@QEAA?AW4_TaskCollectionStatus@23@PEAV_UnrealizedChore@23@@Z");
     } else {
 #ifdef __arm__
         SET(p_critical_section_ctor,
@@ -260,6 +364,28 @@ static BOOL init(void)
                 "??0scoped_lock@critical_section@Concurrency@@QAA@AAV12@@Z");
         SET(p_critical_section_scoped_lock_dtor,
                 "??1scoped_lock@critical_section@Concurrency@@QAA@XZ");
+        SET(p_SchedulerPolicy_ctor,
+                "??0SchedulerPolicy@Concurrency@@QAA@XZ");
+        SET(p_SchedulerPolicy_dtor,
+                "??1SchedulerPolicy@Concurrency@@QAA@XZ");
+        SET(p_SchedulerPolicy_GetPolicyValue,
+                "?GetPolicyValue@SchedulerPolicy@Concurrency@@QBAIW4PolicyElementKey@2@@Z");
+        SET(p_SchedulerPolicy_SetPolicyValue,
+                "?SetPolicyValue@SchedulerPolicy@Concurrency@@QAAIW4PolicyElementKey@2@I@Z");
+        SET(p__StructuredTaskCollection_ctor,
+                "??0_StructuredTaskCollection@details@Concurrency@@QAA@PAV_CancellationTokenState@12@@Z");
+        SET(p__StructuredTaskCollection__Schedule,
+                "?_Schedule@_StructuredTaskCollection@details@Concurrency@@QAAXPAV_UnrealizedChore@23@@Z");
+        SET(p__StructuredTaskCollection__RunAndWait,
+                "?_RunAndWait@_StructuredTaskCollection@details@Concurrency@@QAA?AW4_TaskCollectionStatus@23@PAV_UnrealizedChore@23@@Z");
+        SET(p__TaskCollection_ctor,
+                "??0_TaskCollection@details@Concurrency@@QAA@XZ");
+        SET(p__TaskCollection_dtor,
+                "??1_TaskCollection@details@Concurrency@@QAA@XZ");
+        SET(p__TaskCollection__Schedule,
+                "?_Schedule@_TaskCollection@details@Concurrency@@QAAXPAV_UnrealizedChore@23@@Z");
+        SET(p__TaskCollection__RunAndWait,
+                "?_RunAndWait@_TaskCollection@details@Concurrency@@QAA?AW4_TaskCollectionStatus@23@PAV_UnrealizedChore@23@@Z");
 #else
         SET(p_critical_section_ctor,
                 "??0critical_section@Concurrency@@QAE@XZ");
@@ -279,8 +405,44 @@ static BOOL init(void)
                 "??0scoped_lock@critical_section@Concurrency@@QAE@AAV12@@Z");
         SET(p_critical_section_scoped_lock_dtor,
                 "??1scoped_lock@critical_section@Concurrency@@QAE@XZ");
+        SET(p_SchedulerPolicy_ctor,
+                "??0SchedulerPolicy@Concurrency@@QAE@XZ");
+        SET(p_SchedulerPolicy_dtor,
+                "??1SchedulerPolicy@Concurrency@@QAE@XZ");
+        SET(p_SchedulerPolicy_GetPolicyValue,
+                "?GetPolicyValue@SchedulerPolicy@Concurrency@@QBEIW4PolicyElementKey@2@@Z");
+        SET(p_SchedulerPolicy_SetPolicyValue,
+                "?SetPolicyValue@SchedulerPolicy@Concurrency@@QAEIW4PolicyElementKey@2@I@Z");
+        SET(p__StructuredTaskCollection_ctor,
+                "??0_StructuredTaskCollection@details@Concurrency@@QAE@PAV_CancellationTokenState@12@@Z");
+        SET(p__StructuredTaskCollection__Schedule,
+                "?_Schedule@_StructuredTaskCollection@details@Concurrency@@QAEXPAV_UnrealizedChore@23@@Z");
+        SET(p__StructuredTaskCollection__RunAndWait,
+                "?_RunAndWait@_StructuredTaskCollection@details@Concurrency@@QAG?AW4_TaskCollectionStatus@23@PAV_UnrealizedChore@23@@Z");
+        SET(p__TaskCollection_ctor,
+                "??0_TaskCollection@details@Concurrency@@QAE@XZ");
+        SET(p__TaskCollection_dtor,
+                "??1_TaskCollection@details@Concurrency@@QAE@XZ");
+        SET(p__TaskCollection__Schedule,
+                "?_Schedule@_TaskCollection@details@Concurrency@@QAEXPAV_UnrealizedChore@23@@Z");
+        SET(p__TaskCollection__RunAndWait,
+                "?_RunAndWait@_TaskCollection@details@Concurrency@@QAG?AW4_TaskCollectionStatus@23@PAV_UnrealizedChore@23@@Z");
 #endif
+        SET(p_SchedulerPolicy_ctor_policies,
+                "??0SchedulerPolicy@Concurrency@@QAA@IZZ");
+        SET(p_CurrentScheduler_Create,
+                "?Create@CurrentScheduler@Concurrency@@SAXABVSchedulerPolicy@2@@Z");
+        SET(p_CurrentScheduler_ScheduleTask,
+                "?ScheduleTask@CurrentScheduler@Concurrency@@SAXP6AXPAX@Z0@Z");
+        SET(p_Context_CurrentContext,
+                "?CurrentContext@Context@Concurrency@@SAPAV12@XZ");
     }
+    SET(p_CurrentScheduler_Detach, "?Detach@CurrentScheduler@Concurrency@@SAXXZ");
+    SET(p_CurrentScheduler_Id, "?Id@CurrentScheduler@Concurrency@@SAIXZ");
+    SET(p_CurrentScheduler_GetNumberOfVirtualProcessors,
+            "?GetNumberOfVirtualProcessors@CurrentScheduler@Concurrency@@SAIXZ");
+    SET(p_Context_Id, "?Id@Context@Concurrency@@SAIXZ");
+    SET(p_Context_Block, "?Block@Context@Concurrency@@SAXXZ");
 
     init_thiscall_thunk();
     return TRUE;
@@ -758,6 +920,204 @@ static void test__wcreate_locale(void)
     ok(errno == -1, "expected errno -1, but got %i\n", e);
 }
 
+static void test_SchedulerPolicy(void)
+{
+    SchedulerPolicy policy;
+    unsigned int val;
+
+    call_func1(p_SchedulerPolicy_ctor, &policy);
+    val = call_func2(p_SchedulerPolicy_GetPolicyValue, &policy, MaxConcurrency);
+    ok(val == ~0u, "MaxConcurrency = %x\n", val);
+    val = call_func2(p_SchedulerPolicy_GetPolicyValue, &policy, MinConcurrency);
+    ok(val == 1, "MinConcurrency = %d\n", val);
+    val = call_func2(p_SchedulerPolicy_GetPolicyValue, &policy, ContextPriority);
+    ok(val == THREAD_PRIORITY_NORMAL, "ContextPriority = %d\n", val);
+
+    val = call_func3(p_SchedulerPolicy_SetPolicyValue, &policy,
+            LocalContextCacheSize, 16);
+    ok(val == 8, "SetPolicyValue returned %d\n", val);
+    val = call_func2(p_SchedulerPolicy_GetPolicyValue, &policy, LocalContextCacheSize);
+    ok(val == 16, "LocalContextCacheSize = %d\n", val);
+    call_func1(p_SchedulerPolicy_dtor, &policy);
+
+    p_SchedulerPolicy_ctor_policies(&policy, 2, MinConcurrency, 1, MaxConcurrency, 2);
+    val = call_func2(p_SchedulerPolicy_GetPolicyValue, &policy, MaxConcurrency);
+    ok(val == 2, "MaxConcurrency = %d\n", val);
+    call_func1(p_SchedulerPolicy_dtor, &policy);
+}
+
+static LONG task_count;
+static HANDLE task_event;
+
+static void __cdecl schedule_task_proc(void *arg)
+{
+    if (!InterlockedDecrement(&task_count))
+        SetEvent(task_event);
+}
+
+static void test_CurrentScheduler(void)
+{
+    SchedulerPolicy policy;
+    unsigned int id, i;
+    DWORD ret;
+
+    id = p_CurrentScheduler_Id();
+    ok(id == -1, "CurrentScheduler::Id() = %d\n", id);
+
+    p_SchedulerPolicy_ctor_policies(&policy, 2, MinConcurrency, 1, MaxConcurrency, 2);
+    p_CurrentScheduler_Create(&policy);
+    call_func1(p_SchedulerPolicy_dtor, &policy);
+
+    id = p_CurrentScheduler_Id();
+    ok(id != -1, "CurrentScheduler::Id() = %d\n", id);
+    i = p_CurrentScheduler_GetNumberOfVirtualProcessors();
+    ok(i == 2, "GetNumberOfVirtualProcessors() = %d\n", i);
+
+    task_event = CreateEventW(NULL, FALSE, FALSE, NULL);
+    task_count = 100;
+    for (i = 0; i < 100; i++)
+        p_CurrentScheduler_ScheduleTask(schedule_task_proc, NULL);
+    ret = WaitForSingleObject(task_event, 5000);
+    ok(ret == WAIT_OBJECT_0, "WaitForSingleObject returned %d\n", ret);
+    ok(!task_count, "task_count = %d\n", task_count);
+    CloseHandle(task_event);
+
+    p_CurrentScheduler_Detach();
+    id = p_CurrentScheduler_Id();
+    ok(id == -1, "CurrentScheduler::Id() = %d\n", id);
+}
+
+static Context *blocked_context;
+static LONG block_flag;
+static void (__thiscall *p_Context_Unblock)(Context*);
+
+static unsigned __stdcall test_Context_block(void *arg)
+{
+    blocked_context = p_Context_CurrentContext();
+    ok(p_Context_Id() != -1, "Context::Id() = -1\n");
+    SetEvent(task_event);
+    p_Context_Block();
+    InterlockedExchange(&block_flag, 1);
+    return 0;
+}
+
+static void test_Context(void)
+{
+    Context *context;
+    HANDLE thread;
+    DWORD ret;
+
+    context = p_Context_CurrentContext();
+    ok(context != NULL, "Context::CurrentContext() returned NULL\n");
+    ok(p_Context_CurrentContext() == context, "Context::CurrentContext() changed\n");
+
+    task_event = CreateEventW(NULL, FALSE, FALSE, NULL);
+    block_flag = 0;
+    thread = (HANDLE)_beginthreadex(NULL, 0, test_Context_block, NULL, 0, NULL);
+    ok(thread != INVALID_HANDLE_VALUE, "_beginthread failed (%d)\n", errno);
+    WaitForSingleObject(task_event, INFINITE);
+    ret = WaitForSingleObject(thread, 100);
+    ok(ret == WAIT_TIMEOUT, "WaitForSingleObject returned %d\n", ret);
+    ok(!block_flag, "context was not blocked\n");
+    p_Context_Unblock = (void*)blocked_context->vtable[3];
+    call_func1(p_Context_Unblock, blocked_context);
+    ret = WaitForSingleObject(thread, INFINITE);
+    ok(ret == WAIT_OBJECT_0, "WaitForSingleObject returned %d\n", ret);
+    ok(block_flag, "context was not unblocked\n");
+    CloseHandle(thread);
+    CloseHandle(task_event);
+}
+
+static LONG chore_count;
+
+static void __cdecl chore_proc(_UnrealizedChore *chore)
+{
+    InterlockedIncrement(&chore_count);
+}
+
+static void __cdecl chore_proc_work(_UnrealizedChore *chore)
+{
+    volatile unsigned int i, sum = 0;
+
+    for (i = 0; i < 1000; i++) sum += i;
+    InterlockedIncrement(&chore_count);
+}
+
+static void test_task_collection(void)
+{
+    _UnrealizedChore chores[16];
+    task_collection collection;
+    int i, status;
+
+    memset(chores, 0, sizeof(chores));
+    for (i = 0; i < (int)(sizeof(chores)/sizeof(*chores)); i++)
+        chores[i].chore_proc = chore_proc;
+
+    chore_count = 0;
+    call_func2(p__StructuredTaskCollection_ctor, &collection, NULL);
+    for (i = 0; i < (int)(sizeof(chores)/sizeof(*chores)); i++)
+        call_func2(p__StructuredTaskCollection__Schedule, &collection, &chores[i]);
+    status = p__StructuredTaskCollection__RunAndWait(&collection, NULL);
+    ok(status == TASK_COLLECTION_SUCCESS, "_RunAndWait returned %d\n", status);
+    ok(chore_count == (int)(sizeof(chores)/sizeof(*chores)), "chore_count = %d\n", chore_count);
+
+    chore_count = 0;
+    call_func1(p__TaskCollection_ctor, &collection);
+    for (i = 0; i < (int)(sizeof(chores)/sizeof(*chores)); i++)
+        call_func2(p__TaskCollection__Schedule, &collection, &chores[i]);
+    status = p__TaskCollection__RunAndWait(&collection, NULL);
+    ok(status == TASK_COLLECTION_SUCCESS, "_RunAndWait returned %d\n", status);
+    ok(chore_count == (int)(sizeof(chores)/sizeof(*chores)), "chore_count = %d\n", chore_count);
+    call_func1(p__TaskCollection_dtor, &collection);
+}
+
+static void benchmark_task_collection(void)
+{
+    static _UnrealizedChore chores[4096];
+    task_collection collection;
+    LARGE_INTEGER freq, start, end;
+    int i, j;
+
+    if (!winetest_interactive)
+        return;
+
+    memset(chores, 0, sizeof(chores));
+    for (i = 0; i < (int)(sizeof(chores)/sizeof(*chores)); i++)
+        chores[i].chore_proc = chore_proc_work;
+    QueryPerformanceFrequency(&freq);
+
+    /* parallel_for style fan-out, the waiting thread helps running the chores */
+    chore_count = 0;
+    QueryPerformanceCounter(&start);
+    for (j = 0; j < 16; j++)
+    {
+        call_func2(p__StructuredTaskCollection_ctor, &collection, NULL);
+        for (i = 0; i < (int)(sizeof(chores)/sizeof(*chores)); i++)
+            call_func2(p__StructuredTaskCollection__Schedule, &collection, &chores[i]);
+        p__StructuredTaskCollection__RunAndWait(&collection, NULL);
+    }
+    QueryPerformanceCounter(&end);
+    ok(chore_count == 16 * (int)(sizeof(chores)/sizeof(*chores)), "chore_count = %d\n", chore_count);
+    trace("parallel_for: %d chores in %.2f ms\n", chore_count,
+            (end.QuadPart - start.QuadPart) * 1000.0 / freq.QuadPart);
+
+    /* task_group style fan-out */
+    chore_count = 0;
+    QueryPerformanceCounter(&start);
+    for (j = 0; j < 16; j++)
+    {
+        call_func1(p__TaskCollection_ctor, &collection);
+        for (i = 0; i < (int)(sizeof(chores)/sizeof(*chores)); i++)
+            call_func2(p__TaskCollection__Schedule, &collection, &chores[i]);
+        p__TaskCollection__RunAndWait(&collection, NULL);
+        call_func1(p__TaskCollection_dtor, &collection);
+    }
+    QueryPerformanceCounter(&end);
+    ok(chore_count == 16 * (int)(sizeof(chores)/sizeof(*chores)), "chore_count = %d\n", chore_count);
+    trace("task_group: %d chores in %.2f ms\n", chore_count,
+            (end.QuadPart - start.QuadPart) * 1000.0 / freq.QuadPart);
+}
+
 START_TEST(msvcr120)
 {
     if (!init()) return;
@@ -773,4 +1133,9 @@ START_TEST(msvcr120)
     test_critical_section();
     test_fegetenv();
     test__wcreate_locale();
+    test_SchedulerPolicy();
+    test_CurrentScheduler();
+    test_Context();
+    test_task_collection();
+    benchmark_task_collection();
 }
@@ -82,6 +82,7 @@ static char utf16_bom[2] = { 0xff, 0xfe };
 #define MSVCRT_FD_BLOCK_SIZE 32
 
 #define MSVCRT_INTERNAL_BUFSIZ 4096
+#define MSVCRT_INTERNAL_BUFSIZ_MAX 0x10000
 
 /* ioinfo structure size is different in msvcrXX.dll's */
 typedef struct {
@@ -674,6 +675,23 @@ static BOOL msvcrt_alloc_buffer(MSVCRT_FILE* file)
     return TRUE;
 }
 
+/* INTERNAL: Grow the stdio buffer of a stream that is read sequentially */
+static void msvcrt_grow_buffer(MSVCRT_FILE* file)
+{
+    char *base;
+
+    /* most of the buffer has been consumed since the last fill or seek */
+    if(!(file->_flag & MSVCRT__IOMYBUF) || (file->_flag & (MSVCRT__IOWRT | MSVCRT__IOSETVBUF))
+            || file->_bufsiz >= MSVCRT_INTERNAL_BUFSIZ_MAX
+            || file->_ptr - file->_base < file->_bufsiz / 2)
+        return;
+
+    if(!(base = MSVCRT_realloc(file->_base, file->_bufsiz * 2)))
+        return;
+    file->_base = file->_ptr = base;
+    file->_bufsiz *= 2;
+}
+
 /* INTERNAL: Allocate temporary buffer for stdout and stderr */
 static BOOL add_std_buffer(MSVCRT_FILE *file)
 {
@@ -2507,7 +2525,7 @@ static int read_utf8(ioinfo *fdinfo, MSVCRT_wchar_t *buf, unsigned int count)
 {
     HANDLE hand = fdinfo->handle;
     char min_buf[4], *readbuf, lookahead;
-    DWORD readbuf_size, pos=0, num_read=1, char_len, i, j;
+    DWORD readbuf_size, pos=0, num_read=1, char_len, i, j, run;
 
     /* make the buffer big enough to hold at least one character */
     /* read bytes have to fit to output and lookahead buffers */
@@ -2636,6 +2654,17 @@ static int read_utf8(ioinfo *fdinfo, MSVCRT_wchar_t *buf, unsigned int count)
     pos = i;
 
     for(i=0, j=0; i<pos; i++) {
+        /* copy the characters that don't need any translation */
+        run = msvcrt_text_run(readbuf+i, pos-i, FALSE);
+        if(run) {
+            if(i != j)
+                memmove(readbuf+j, readbuf+i, run);
+            i += run;
+            j += run;
+            if(i == pos)
+                break;
+        }
+
         if(readbuf[i] == 0x1a) {
             fdinfo->wxflag |= WX_ATEOF;
             break;
@@ -2662,10 +2691,16 @@ static int read_utf8(ioinfo *fdinfo, MSVCRT_wchar_t *buf, unsigned int count)
     }
     pos = j;
 
-    if(!(num_read = MultiByteToWideChar(CP_UTF8, 0, readbuf, pos, buf, count))) {
-        msvcrt_set_errno(GetLastError());
-        if (readbuf != min_buf) MSVCRT_free(readbuf);
-        return -1;
+    /* ASCII characters don't need the UTF-8 conversion */
+    num_read = msvcrt_ascii_widen(buf, readbuf, pos);
+    if(num_read < pos || !pos) {
+        if(!(char_len = MultiByteToWideChar(CP_UTF8, 0, readbuf+num_read, pos-num_read,
+                        buf+num_read, count-num_read))) {
+            msvcrt_set_errno(GetLastError());
+            if (readbuf != min_buf) MSVCRT_free(readbuf);
+            return -1;
+        }
+        num_read += char_len;
     }
 
     if (readbuf != min_buf) MSVCRT_free(readbuf);
@@ -2744,7 +2779,7 @@ static int read_i(int fd, ioinfo *fdinfo, void *buf, unsigned int count)
         }
         else if (fdinfo->wxflag & WX_TEXT)
         {
-            DWORD i, j;
+            DWORD i, j, run;
 
             if (bufstart[0]=='\n' && (!utf16 || bufstart[1]==0))
                 fdinfo->wxflag |= WX_READNL;
@@ -2753,6 +2788,18 @@ static int read_i(int fd, ioinfo *fdinfo, void *buf, unsigned int count)
 
             for (i=0, j=0; i<num_read; i+=1+utf16)
             {
+                /* copy the characters that don't need any translation */
+                run = msvcrt_text_run(bufstart+i, num_read-i, utf16);
+                if (run)
+                {
+                    if (i != j)
+                        memmove(bufstart+j, bufstart+i, run);
+                    i += run;
+                    j += run;
+                    if (i == num_read)
+                        break;
+                }
+
                 /* in text mode, a ctrl-z signals EOF */
                 if (bufstart[i]==0x1a && (!utf16 || bufstart[i+1]==0))
                 {
@@ -3388,21 +3435,26 @@ int CDECL MSVCRT__write(int fd, const void* buf, unsigned int count)
 
         if (!(info->exflag & (EF_UTF8|EF_UTF16)))
         {
+            const char *nl, *end = s + count;
+
             /* find number of \n */
-            for (nr_lf=0, i=0; i<count; i++)
-                if (s[i] == '\n')
-                    nr_lf++;
+            for (nr_lf=0, nl=s; (nl = memchr(nl, '\n', end - nl)); nl++)
+                nr_lf++;
             if (nr_lf)
             {
                 size = count+nr_lf;
                 if ((q = p = MSVCRT_malloc(size)))
                 {
-                    for (s = buf, i = 0, j = 0; i < count; i++)
+                    const char *src = buf;
+
+                    for (j = 0; (nl = memchr(src, '\n', end - src)); src = nl + 1)
                     {
-                        if (s[i] == '\n')
-                            p[j++] = '\r';
-                        p[j++] = s[i];
+                        memcpy(p + j, src, nl - src);
+                        j += nl - src;
+                        p[j++] = '\r';
+                        p[j++] = '\n';
                     }
+                    memcpy(p + j, src, end - src);
                 }
                 else
                 {
@@ -3614,6 +3666,7 @@ int CDECL MSVCRT__filbuf(MSVCRT_FILE* file)
 
         return c;
     } else {
+        msvcrt_grow_buffer(file);
         file->_cnt = MSVCRT__read(file->_file, file->_base, file->_bufsiz);
         if(file->_cnt<=0) {
             file->_flag |= (file->_cnt == 0) ? MSVCRT__IOEOF : MSVCRT__IOERR;
@@ -3681,8 +3734,25 @@ char * CDECL MSVCRT_fgets(char *s, int size, MSVCRT_FILE* file)
 
   MSVCRT__lock_file(file);
 
-  while ((size >1) && (cc = MSVCRT__fgetc_nolock(file)) != MSVCRT_EOF && cc != '\n')
+  while (size > 1)
     {
+      /* copy the line directly from the stream buffer */
+      if (file->_cnt > 0)
+        {
+          int len = min(file->_cnt, size - 1);
+          char *nl = memchr(file->_ptr, '\n', len);
+
+          if (nl) len = nl - file->_ptr;
+          memcpy(s, file->_ptr, len);
+          s += len;
+          size -= len;
+          file->_ptr += len;
+          file->_cnt -= len;
+          if (!nl) continue;
+        }
+
+      if ((cc = MSVCRT__fgetc_nolock(file)) == MSVCRT_EOF || cc == '\n')
+        break;
       *s++ = (char)cc;
       size --;
     }
@@ -3815,14 +3885,41 @@ MSVCRT_wchar_t * CDECL MSVCRT_fgetws(MSVCRT_wchar_t *s, int size, MSVCRT_FILE* f
 {
   MSVCRT_wint_t cc = MSVCRT_WEOF;
   MSVCRT_wchar_t * buf_start = s;
+  ioinfo *info;
+  BOOL wide;
 
   TRACE(":file(%p) fd (%d) str (%p) len (%d)\n",
         file,file->_file,s,size);
 
   MSVCRT__lock_file(file);
 
-  while ((size >1) && (cc = MSVCRT__fgetwc_nolock(file)) != MSVCRT_WEOF && cc != '\n')
+  /* the stream buffer contains UTF-16 characters */
+  info = get_ioinfo_nolock(file->_file);
+  wide = (info->exflag & (EF_UTF8 | EF_UTF16)) || !(info->wxflag & WX_TEXT);
+
+  while (size > 1)
     {
+      /* copy the line directly from the stream buffer */
+      if (wide && file->_cnt >= (int)sizeof(MSVCRT_wchar_t))
+        {
+          int i, len = min(file->_cnt / (int)sizeof(MSVCRT_wchar_t), size - 1);
+          MSVCRT_wchar_t wc;
+
+          for (i = 0; i < len; i++)
+            {
+              memcpy(&wc, file->_ptr + i * sizeof(wc), sizeof(wc));
+              if (wc == '\n') break;
+              s[i] = wc;
+            }
+          s += i;
+          size -= i;
+          file->_ptr += i * sizeof(wc);
+          file->_cnt -= i * sizeof(wc);
+          if (i == len) continue;
+        }
+
+      if ((cc = MSVCRT__fgetwc_nolock(file)) == MSVCRT_WEOF || cc == '\n')
+        break;
       *s++ = cc;
       size --;
     }
@@ -4768,7 +4865,7 @@ int CDECL MSVCRT_setvbuf(MSVCRT_FILE* file, char *buf, int mode, MSVCRT_size_t s
     MSVCRT__fflush_nolock(file);
     if(file->_flag & MSVCRT__IOMYBUF)
         MSVCRT_free(file->_base);
-    file->_flag &= ~(MSVCRT__IONBF | MSVCRT__IOMYBUF | MSVCRT__USERBUF);
+    file->_flag &= ~(MSVCRT__IONBF | MSVCRT__IOMYBUF | MSVCRT__USERBUF | MSVCRT__IOSETVBUF);
     file->_cnt = 0;
 
     if(mode == MSVCRT__IONBF) {
@@ -4787,7 +4884,8 @@ int CDECL MSVCRT_setvbuf(MSVCRT_FILE* file, char *buf, int mode, MSVCRT_size_t s
             return -1;
         }
 
-        file->_flag |= MSVCRT__IOMYBUF;
+        /* the application chose the size, don't grow it */
+        file->_flag |= MSVCRT__IOMYBUF | MSVCRT__IOSETVBUF;
         file->_bufsiz = size;
     }
     MSVCRT__unlock_file(file);
@@ -52,8 +52,364 @@ static unsigned int MSVCRT_amblksiz = 16;
 /* FIXME - According to documentation it should be 480 bytes, at runtime default is 0 */
 static MSVCRT_size_t MSVCRT_sbh_threshold = 0;
 
+/* Thread caching allocator for small blocks, enabled by setting WINE_MSVCRT_HEAP_CACHE.
+ *
+ * Small blocks are carved out of 64k slabs committed from a reserved arena.
+ * Every slab serves a single size class. Freed blocks go to a per-thread
+ * free list, batches of blocks are exchanged with the global per-class lists
+ * when a thread cache runs empty or grows too big. The block header keeps the
+ * requested size so _msize stays exact, and _heapwalk reports arena blocks
+ * after the entries of the Win32 heap. */
+#define CACHE_GRANULARITY  16
+#define CACHE_CLASSES      32
+#define CACHE_MAX_SIZE     (CACHE_GRANULARITY*CACHE_CLASSES)
+#define CACHE_SLAB_SIZE    0x10000
+#ifdef _WIN64
+#define CACHE_ARENA_SIZE   0x40000000
+#else
+#define CACHE_ARENA_SIZE   0x4000000
+#endif
+#define CACHE_THREAD_MAX   64
+#define CACHE_BATCH        32
+#define CACHE_FREE_BLOCK   (~(MSVCRT_size_t)0)
+
+typedef struct cache_block
+{
+    MSVCRT_size_t size;         /* requested size or CACHE_FREE_BLOCK */
+    struct cache_block *next;   /* free list link */
+} DECLSPEC_ALIGN(MEMORY_ALLOCATION_ALIGNMENT) cache_block;
+
+typedef struct
+{
+    unsigned int class;
+    unsigned int count;
+} DECLSPEC_ALIGN(MEMORY_ALLOCATION_ALIGNMENT) cache_slab;
+
+struct heap_cache
+{
+    cache_block *free[CACHE_CLASSES];
+    unsigned int count[CACHE_CLASSES];
+};
+
+static struct
+{
+    CRITICAL_SECTION cs;
+    cache_block *free;
+    unsigned int count;
+} cache_central[CACHE_CLASSES];
+
+static BOOL cache_enabled;
+static char *cache_arena;
+static unsigned int cache_slabs;
+static CRITICAL_SECTION cache_arena_cs;
+
+static inline BOOL cache_is_arena_ptr(const void *ptr)
+{
+    return (MSVCRT_size_t)((const char*)ptr - cache_arena) < CACHE_ARENA_SIZE;
+}
+
+static inline cache_block* cache_get_block(void *ptr)
+{
+    return (cache_block*)ptr - 1;
+}
+
+static inline unsigned int cache_slot_size(unsigned int class)
+{
+    return sizeof(cache_block) + (class+1)*CACHE_GRANULARITY;
+}
+
+static inline cache_slab* cache_get_slab(const void *ptr)
+{
+    return (cache_slab*)((DWORD_PTR)ptr & ~(DWORD_PTR)(CACHE_SLAB_SIZE-1));
+}
+
+/* called with cache_central[class].cs held */
+static BOOL cache_new_slab(unsigned int class)
+{
+    unsigned int i, slot_size = cache_slot_size(class);
+    cache_block *block, *prev = NULL;
+    cache_slab *slab;
+
+    EnterCriticalSection(&cache_arena_cs);
+    if(cache_slabs >= CACHE_ARENA_SIZE/CACHE_SLAB_SIZE ||
+            !VirtualAlloc(cache_arena + cache_slabs*CACHE_SLAB_SIZE,
+                CACHE_SLAB_SIZE, MEM_COMMIT, PAGE_READWRITE))
+    {
+        LeaveCriticalSection(&cache_arena_cs);
+        return FALSE;
+    }
+    slab = (cache_slab*)(cache_arena + cache_slabs*CACHE_SLAB_SIZE);
+    slab->class = class;
+    slab->count = (CACHE_SLAB_SIZE - sizeof(*slab)) / slot_size;
+    /* publish the slab after it's initialized, _heapwalk reads it unlocked */
+    InterlockedIncrement((LONG*)&cache_slabs);
+    LeaveCriticalSection(&cache_arena_cs);
+
+    for(i=slab->count; i>0; i--)
+    {
+        block = (cache_block*)((char*)(slab+1) + (i-1)*slot_size);
+        block->size = CACHE_FREE_BLOCK;
+        block->next = prev;
+        prev = block;
+    }
+    cache_central[class].free = prev;
+    cache_central[class].count += slab->count;
+    return TRUE;
+}
+
+/* The thread data is not created here: blocks allocated or freed once it is
+ * gone, e.g. by DLLs detaching after msvcrt, go through the central lists. */
+static struct heap_cache* cache_get_thread_cache(void)
+{
+    DWORD err = GetLastError();
+    thread_data_t *data = TlsGetValue(msvcrt_tls_index);
+
+    if(data && !data->heap_cache)
+        data->heap_cache = HeapAlloc(GetProcessHeap(), HEAP_ZERO_MEMORY, sizeof(*data->heap_cache));
+    SetLastError(err);
+    return data ? data->heap_cache : NULL;
+}
+
+static cache_block* cache_refill(struct heap_cache *cache, unsigned int class)
+{
+    cache_block *block, *last;
+    unsigned int count;
+
+    EnterCriticalSection(&cache_central[class].cs);
+    if(!cache_central[class].free && !cache_new_slab(class))
+    {
+        LeaveCriticalSection(&cache_central[class].cs);
+        return NULL;
+    }
+
+    block = last = cache_central[class].free;
+    for(count=1; count<CACHE_BATCH && last->next; count++)
+        last = last->next;
+    cache_central[class].free = last->next;
+    cache_central[class].count -= count;
+    LeaveCriticalSection(&cache_central[class].cs);
+
+    last->next = NULL;
+    cache->free[class] = block;
+    cache->count[class] = count;
+    return block;
+}
+
+static void cache_release(cache_block *first, unsigned int class, unsigned int count)
+{
+    cache_block *last;
+
+    for(last=first; last->next; last=last->next);
+
+    EnterCriticalSection(&cache_central[class].cs);
+    last->next = cache_central[class].free;
+    cache_central[class].free = first;
+    cache_central[class].count += count;
+    LeaveCriticalSection(&cache_central[class].cs);
+}
+
+/* takes a single block from the central list */
+static cache_block* cache_take(unsigned int class)
+{
+    cache_block *block;
+
+    EnterCriticalSection(&cache_central[class].cs);
+    if(!cache_central[class].free && !cache_new_slab(class))
+    {
+        LeaveCriticalSection(&cache_central[class].cs);
+        return NULL;
+    }
+    block = cache_central[class].free;
+    cache_central[class].free = block->next;
+    cache_central[class].count--;
+    LeaveCriticalSection(&cache_central[class].cs);
+    return block;
+}
+
+static void* cache_alloc(DWORD flags, MSVCRT_size_t size)
+{
+    unsigned int class = size ? (size-1) / CACHE_GRANULARITY : 0;
+    struct heap_cache *cache;
+    cache_block *block;
+
+    if(!(cache = cache_get_thread_cache()))
+    {
+        if(!(block = cache_take(class)))
+            return NULL;
+    }
+    else
+    {
+        if(!(block = cache->free[class]) && !(block = cache_refill(cache, class)))
+            return NULL;
+        cache->free[class] = block->next;
+        cache->count[class]--;
+    }
+    block->size = size;
+    block->next = NULL;
+    if(flags & HEAP_ZERO_MEMORY)
+        memset(block+1, 0, size);
+    return block+1;
+}
+
+static BOOL cache_free(void *ptr)
+{
+    cache_block *block = cache_get_block(ptr);
+    unsigned int class = cache_get_slab(ptr)->class;
+    struct heap_cache *cache;
+
+    if(block->size == CACHE_FREE_BLOCK)
+    {
+        WARN("%p already freed\n", ptr);
+        SetLastError(ERROR_INVALID_PARAMETER);
+        return FALSE;
+    }
+    block->size = CACHE_FREE_BLOCK;
+
+    if(!(cache = cache_get_thread_cache()))
+    {
+        block->next = NULL;
+        cache_release(block, class, 1);
+        return TRUE;
+    }
+
+    block->next = cache->free[class];
+    cache->free[class] = block;
+    if(++cache->count[class] > CACHE_THREAD_MAX)
+    {
+        cache_block *last = block;
+        unsigned int i;
+
+        /* keep the most recently freed blocks, they are likely to be hot */
+        for(i=1; i<CACHE_THREAD_MAX-CACHE_BATCH; i++)
+            last = last->next;
+        cache_release(last->next, class, cache->count[class]-i);
+        last->next = NULL;
+        cache->count[class] = i;
+    }
+    return TRUE;
+}
+
+static void* cache_realloc(DWORD flags, void *ptr, MSVCRT_size_t size)
+{
+    cache_block *block = cache_get_block(ptr);
+    unsigned int class = cache_get_slab(ptr)->class;
+    void *ret;
+
+    if(block->size == CACHE_FREE_BLOCK)
+    {
+        SetLastError(ERROR_INVALID_PARAMETER);
+        return NULL;
+    }
+
+    if(size <= (class+1)*CACHE_GRANULARITY)
+    {
+        block->size = size;
+        return ptr;
+    }
+    if(flags & HEAP_REALLOC_IN_PLACE_ONLY)
+        return NULL;
+
+    if(size <= CACHE_MAX_SIZE)
+        ret = cache_alloc(flags, size);
+    else
+        ret = HeapAlloc(heap, flags, size);
+    if(!ret) return NULL;
+
+    memcpy(ret, ptr, min(block->size, size));
+    cache_free(ptr);
+    return ret;
+}
+
+/* returns the arena entry following ptr, ptr may be NULL */
+static BOOL cache_heapwalk(struct MSVCRT__heapinfo *next, void *ptr)
+{
+    unsigned int slab_idx, idx, slot_size;
+    cache_slab *slab;
+    cache_block *block;
+
+    if(ptr)
+    {
+        slab = cache_get_slab(ptr);
+        slot_size = cache_slot_size(slab->class);
+        slab_idx = ((char*)slab - cache_arena) / CACHE_SLAB_SIZE;
+        idx = ((char*)cache_get_block(ptr) - (char*)(slab+1)) / slot_size + 1;
+    }
+    else
+    {
+        slab_idx = 0;
+        idx = 0;
+    }
+
+    for(; slab_idx < cache_slabs; slab_idx++, idx=0)
+    {
+        slab = (cache_slab*)(cache_arena + slab_idx*CACHE_SLAB_SIZE);
+        if(idx >= slab->count)
+            continue;
+
+        slot_size = cache_slot_size(slab->class);
+        block = (cache_block*)((char*)(slab+1) + idx*slot_size);
+        next->_pentry = (int*)(block+1);
+        if(block->size == CACHE_FREE_BLOCK)
+        {
+            next->_size = slot_size - sizeof(*block);
+            next->_useflag = MSVCRT__FREEENTRY;
+        }
+        else
+        {
+            next->_size = block->size;
+            next->_useflag = MSVCRT__USEDENTRY;
+        }
+        return TRUE;
+    }
+    return FALSE;
+}
+
+static void cache_init(void)
+{
+    char buf[16];
+    unsigned int i;
+
+    if(!GetEnvironmentVariableA("WINE_MSVCRT_HEAP_CACHE", buf, sizeof(buf)) || !strcmp(buf, "0"))
+        return;
+
+    cache_arena = VirtualAlloc(NULL, CACHE_ARENA_SIZE, MEM_RESERVE, PAGE_READWRITE);
+    if(!cache_arena)
+    {
+        WARN("failed to reserve heap cache arena\n");
+        return;
+    }
+
+    InitializeCriticalSection(&cache_arena_cs);
+    cache_arena_cs.DebugInfo->Spare[0] = (DWORD_PTR)(__FILE__ ": cache_arena_cs");
+    for(i=0; i<CACHE_CLASSES; i++)
+        InitializeCriticalSectionAndSpinCount(&cache_central[i].cs, 4000);
+    cache_enabled = TRUE;
+    TRACE("heap cache enabled\n");
+}
+
+void msvcrt_free_heap_cache(struct heap_cache *cache)
+{
+    unsigned int i;
+
+    if(!cache)
+        return;
+
+    for(i=0; i<CACHE_CLASSES; i++)
+    {
+        if(cache->free[i])
+            cache_release(cache->free[i], i, cache->count[i]);
+    }
+    HeapFree(GetProcessHeap(), 0, cache);
+}
+
 static void* msvcrt_heap_alloc(DWORD flags, MSVCRT_size_t size)
 {
+    if(cache_enabled && size <= CACHE_MAX_SIZE && size >= MSVCRT_sbh_threshold)
+    {
+        void *ret = cache_alloc(flags, size);
+        if(ret) return ret;
+    }
+
     if(size < MSVCRT_sbh_threshold)
     {
         void *memblock, *temp, **saved;
@@ -72,6 +428,9 @@ static void* msvcrt_heap_alloc(DWORD flags, MSVCRT_size_t size)
 
 static void* msvcrt_heap_realloc(DWORD flags, void *ptr, MSVCRT_size_t size)
 {
+    if(cache_enabled && cache_is_arena_ptr(ptr))
+        return cache_realloc(flags, ptr, size);
+
     if(sb_heap && ptr && !HeapValidate(heap, 0, ptr))
     {
         /* TODO: move data to normal heap if it exceeds sbh_threshold limit */
@@ -104,6 +463,9 @@ static void* msvcrt_heap_realloc(DWORD flags, void *ptr, MSVCRT_size_t size)
 
 static BOOL msvcrt_heap_free(void *ptr)
 {
+    if(cache_enabled && cache_is_arena_ptr(ptr))
+        return cache_free(ptr);
+
     if(sb_heap && ptr && !HeapValidate(heap, 0, ptr))
     {
         void **saved = SAVED_PTR(ptr);
@@ -115,6 +477,12 @@ static BOOL msvcrt_heap_free(void *ptr)
 
 static MSVCRT_size_t msvcrt_heap_size(void *ptr)
 {
+    if(cache_enabled && cache_is_arena_ptr(ptr))
+    {
+        cache_block *block = cache_get_block(ptr);
+        return block->size;
+    }
+
     if(sb_heap && ptr && !HeapValidate(heap, 0, ptr))
     {
         void **saved = SAVED_PTR(ptr);
@@ -289,6 +657,13 @@ int CDECL _heapwalk(struct MSVCRT__heapinfo* next)
       FIXME("small blocks heap not supported\n");
 
   LOCK_HEAP;
+  if (cache_enabled && cache_is_arena_ptr(next->_pentry))
+  {
+    BOOL found = cache_heapwalk(next, next->_pentry);
+    UNLOCK_HEAP;
+    return found ? MSVCRT__HEAPOK : MSVCRT__HEAPEND;
+  }
+
   phe.lpData = next->_pentry;
   phe.cbData = next->_size;
   phe.wFlags = next->_useflag == MSVCRT__USEDENTRY ? PROCESS_HEAP_ENTRY_BUSY : 0;
@@ -305,9 +680,13 @@ int CDECL _heapwalk(struct MSVCRT__heapinfo* next)
   {
     if (!HeapWalk( heap, &phe ))
     {
-      UNLOCK_HEAP;
       if (GetLastError() == ERROR_NO_MORE_ITEMS)
-         return MSVCRT__HEAPEND;
+      {
+        BOOL found = cache_enabled && cache_heapwalk(next, NULL);
+        UNLOCK_HEAP;
+        return found ? MSVCRT__HEAPOK : MSVCRT__HEAPEND;
+      }
+      UNLOCK_HEAP;
       msvcrt_set_errno(GetLastError());
       if (!phe.lpData)
         return MSVCRT__HEAPBADBEGIN;
@@ -855,6 +1234,7 @@ int CDECL MSVCRT_strncpy_s(char *dest, MSVCRT_size_t numberOfElements,
 BOOL msvcrt_init_heap(void)
 {
     heap = HeapCreate(0, 0, 0);
+    if(heap) cache_init();
     return heap != NULL;
 }
 
@@ -863,4 +1243,15 @@ void msvcrt_destroy_heap(void)
     HeapDestroy(heap);
     if(sb_heap)
         HeapDestroy(sb_heap);
+    if(cache_enabled)
+    {
+        unsigned int i;
+
+        cache_enabled = FALSE;
+        for(i=0; i<CACHE_CLASSES; i++)
+            DeleteCriticalSection(&cache_central[i].cs);
+        cache_arena_cs.DebugInfo->Spare[0] = 0;
+        DeleteCriticalSection(&cache_arena_cs);
+        VirtualFree(cache_arena, 0, MEM_RELEASE);
+    }
 }
@@ -79,6 +79,9 @@ static inline void msvcrt_free_tls_mem(void)
         free_locinfo(tls->locinfo);
         free_mbcinfo(tls->mbcinfo);
     }
+    /* memory freed from now on must not use the thread data */
+    TlsSetValue(msvcrt_tls_index, NULL);
+    msvcrt_free_heap_cache(tls->heap_cache);
   }
   HeapFree(GetProcessHeap(), 0, tls);
 }
@@ -97,6 +100,7 @@ BOOL WINAPI DllMain(HINSTANCE hinstDLL, DWORD fdwReason, LPVOID lpvReserved)
   {
   case DLL_PROCESS_ATTACH:
     msvcrt_init_exception(hinstDLL);
+    msvcrt_init_scheduler(hinstDLL);
     if(!msvcrt_init_heap())
         return FALSE;
     if(!msvcrt_init_tls()) {
@@ -111,6 +115,7 @@ BOOL WINAPI DllMain(HINSTANCE hinstDLL, DWORD fdwReason, LPVOID lpvReserved)
         return FALSE;
     }
     msvcrt_init_math();
+    msvcrt_init_string();
     msvcrt_init_io();
     msvcrt_init_console();
     msvcrt_init_args();
@@ -133,6 +138,8 @@ BOOL WINAPI DllMain(HINSTANCE hinstDLL, DWORD fdwReason, LPVOID lpvReserved)
     msvcrt_free_console();
     msvcrt_free_args();
     msvcrt_free_signals();
+    msvcrt_free_scheduler_thread();
+    msvcrt_free_scheduler();
     msvcrt_free_tls_mem();
     if (!msvcrt_free_tls())
       return FALSE;
@@ -142,6 +149,7 @@ BOOL WINAPI DllMain(HINSTANCE hinstDLL, DWORD fdwReason, LPVOID lpvReserved)
     break;
   case DLL_THREAD_DETACH:
     msvcrt_free_tls_mem();
+    msvcrt_free_scheduler_thread();
     TRACE("finished thread free\n");
     break;
   }
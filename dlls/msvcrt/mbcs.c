@@ -123,7 +123,7 @@ static inline int u_strcmp( const unsigned char *s1, const unsigned char *s2 )
 
 static inline int u_strcasecmp( const unsigned char *s1, const unsigned char *s2 )
 {
-  return strcasecmp( (const char*)s1, (const char*)s2 );
+  return msvcrt_strncmp_ascii( (const char*)s1, (const char*)s2, ~(MSVCRT_size_t)0, TRUE );
 }
 
 static inline int u_strncmp( const unsigned char *s1, const unsigned char *s2, MSVCRT_size_t len )
@@ -133,7 +133,7 @@ static inline int u_strncmp( const unsigned char *s1, const unsigned char *s2, M
 
 static inline int u_strncasecmp( const unsigned char *s1, const unsigned char *s2, MSVCRT_size_t len )
 {
-  return strncasecmp( (const char*)s1, (const char*)s2, len );
+  return msvcrt_strncmp_ascii( (const char*)s1, (const char*)s2, len, TRUE );
 }
 
 static inline unsigned char *u_strchr( const unsigned char *s, unsigned char x )
@@ -778,6 +778,10 @@ int CDECL _mbscmp(const unsigned char* str, const unsigned char* cmp)
   if(get_mbcinfo()->ismbcodepage)
   {
     unsigned int strc, cmpc;
+    MSVCRT_size_t prefix = msvcrt_ascii_prefix((const char*)str, (const char*)cmp);
+
+    str += prefix;
+    cmp += prefix;
     do {
       if(!*str)
         return *cmp ? -1 : 0;
@@ -269,6 +269,7 @@ struct __thread_data {
 #if _MSVCR_VER >= 140
     MSVCRT_invalid_parameter_handler invalid_parameter_handler;
 #endif
+    struct heap_cache              *heap_cache;         /* small blocks cache */
 };
 
 typedef struct __thread_data thread_data_t;
@@ -284,6 +285,9 @@ extern WORD MSVCRT__ctype [257];
 void msvcrt_set_errno(int) DECLSPEC_HIDDEN;
 #if _MSVCR_VER >= 80
 void throw_bad_alloc(const char*) DECLSPEC_HIDDEN;
+#if _MSVCR_VER >= 100
+unsigned int __cdecl _GetConcurrency(void);
+#endif
 #endif
 
 void __cdecl _purecall(void);
@@ -315,8 +319,12 @@ extern void msvcrt_init_mt_locks(void) DECLSPEC_HIDDEN;
 extern void msvcrt_free_locks(void) DECLSPEC_HIDDEN;
 
 extern void msvcrt_init_exception(void*) DECLSPEC_HIDDEN;
+extern void msvcrt_init_scheduler(void*) DECLSPEC_HIDDEN;
+extern void msvcrt_free_scheduler(void) DECLSPEC_HIDDEN;
+extern void msvcrt_free_scheduler_thread(void) DECLSPEC_HIDDEN;
 extern BOOL msvcrt_init_locale(void) DECLSPEC_HIDDEN;
 extern void msvcrt_init_math(void) DECLSPEC_HIDDEN;
+extern void msvcrt_init_string(void) DECLSPEC_HIDDEN;
 extern void msvcrt_init_io(void) DECLSPEC_HIDDEN;
 extern void msvcrt_free_io(void) DECLSPEC_HIDDEN;
 extern void msvcrt_init_console(void) DECLSPEC_HIDDEN;
@@ -328,9 +336,20 @@ extern void msvcrt_free_signals(void) DECLSPEC_HIDDEN;
 extern void msvcrt_free_popen_data(void) DECLSPEC_HIDDEN;
 extern BOOL msvcrt_init_heap(void) DECLSPEC_HIDDEN;
 extern void msvcrt_destroy_heap(void) DECLSPEC_HIDDEN;
+extern void msvcrt_free_heap_cache(struct heap_cache*) DECLSPEC_HIDDEN;
 
 extern unsigned msvcrt_create_io_inherit_block(WORD*, BYTE**) DECLSPEC_HIDDEN;
 
+/* Vectorized string helpers */
+extern MSVCRT_size_t msvcrt_strnlen(const char*, MSVCRT_size_t) DECLSPEC_HIDDEN;
+extern MSVCRT_size_t msvcrt_wcsnlen(const MSVCRT_wchar_t*, MSVCRT_size_t) DECLSPEC_HIDDEN;
+extern MSVCRT_wchar_t* msvcrt_wcschr(const MSVCRT_wchar_t*, MSVCRT_wchar_t) DECLSPEC_HIDDEN;
+extern int msvcrt_wcsncmp(const MSVCRT_wchar_t*, const MSVCRT_wchar_t*, MSVCRT_size_t, BOOL) DECLSPEC_HIDDEN;
+extern int msvcrt_strncmp_ascii(const char*, const char*, MSVCRT_size_t, BOOL) DECLSPEC_HIDDEN;
+extern MSVCRT_size_t msvcrt_ascii_prefix(const char*, const char*) DECLSPEC_HIDDEN;
+extern MSVCRT_size_t msvcrt_text_run(const char*, MSVCRT_size_t, BOOL) DECLSPEC_HIDDEN;
+extern MSVCRT_size_t msvcrt_ascii_widen(MSVCRT_wchar_t*, const char*, MSVCRT_size_t) DECLSPEC_HIDDEN;
+
 extern unsigned int __cdecl _control87(unsigned int, unsigned int);
 
 /* run-time error codes */
@@ -807,6 +826,7 @@ struct MSVCRT__stat64 {
 #define MSVCRT__IOSTRG   0x0040
 #define MSVCRT__IORW     0x0080
 #define MSVCRT__USERBUF  0x0100
+#define MSVCRT__IOSETVBUF 0x0400
 #define MSVCRT__IOCOMMIT 0x4000
 
 #define MSVCRT__S_IEXEC  0x0040
@@ -92,16 +92,16 @@ static inline int FUNC_NAME(pf_fill)(FUNC_NAME(puts_clbk) pf_puts, void *puts_ct
     }
     written = r;
 
-    if((!left && flags->LeftAlign) || (left && !flags->LeftAlign)) {
-        APICHAR ch;
+    if(((!left && flags->LeftAlign) || (left && !flags->LeftAlign)) && flags->FieldLength > len) {
+        APICHAR pad[32];
+        int n;
 
-        if(left && flags->PadZero)
-            ch = '0';
-        else
-            ch = ' ';
+        for(i=0; i<sizeof(pad)/sizeof(pad[0]); i++)
+            pad[i] = (left && flags->PadZero) ? '0' : ' ';
 
-        for(i=0; i<flags->FieldLength-len && r>=0; i++) {
-            r = pf_puts(puts_ctx, 1, &ch);
+        for(i=flags->FieldLength-len; i>0 && r>=0; i-=n) {
+            n = min(i, sizeof(pad)/sizeof(pad[0]));
+            r = pf_puts(puts_ctx, n, pad);
             written += r;
         }
     }
@@ -139,9 +139,19 @@ static inline int FUNC_NAME(pf_output_str)(FUNC_NAME(puts_clbk) pf_puts, void *p
         const char *str, int len, MSVCRT_pthreadlocinfo locinfo)
 {
 #ifdef PRINTF_WIDE
+    MSVCRT_wchar_t buf[64];
     LPWSTR out;
-    int len_w = MultiByteToWideChar(locinfo->lc_codepage, 0, str, len, NULL, 0);
+    int i, len_w;
+
+    /* formatted numbers are ASCII and don't need the code page conversion */
+    if(len <= sizeof(buf)/sizeof(buf[0])) {
+        for(i=0; i<len && !(str[i] & 0x80); i++)
+            buf[i] = str[i];
+        if(i == len)
+            return pf_puts(puts_ctx, len, buf);
+    }
 
+    len_w = MultiByteToWideChar(locinfo->lc_codepage, 0, str, len, NULL, 0);
     out = HeapAlloc(GetProcessHeap(), 0, len_w*sizeof(WCHAR));
     if(!out)
         return -1;
@@ -275,11 +285,24 @@ static inline void FUNC_NAME(pf_integer_conv)(APICHAR *buf, int buf_len,
         flags->Alternate = 0;
         if(flags->Precision)
             buf[i++] = '0';
+    } else if(base == 10) {
+        ULONGLONG v = x;
+        unsigned int v32;
+
+        /* only use 64-bit divisions while they are needed */
+        while(v > 0xffffffff) {
+            buf[i++] = digits[v%10];
+            v /= 10;
+        }
+        for(v32 = v; v32; v32 /= 10)
+            buf[i++] = digits[v32%10];
     } else {
-        while(x != 0) {
-            j = (ULONGLONG)x%base;
-            x = (ULONGLONG)x/base;
-            buf[i++] = digits[j];
+        ULONGLONG v = x;
+        unsigned int shift = (base == 16 ? 4 : 3);
+
+        while(v) {
+            buf[i++] = digits[v & (base-1)];
+            v >>= shift;
         }
     }
     k = flags->Precision-i;
@@ -341,6 +364,154 @@ static inline void FUNC_NAME(pf_fixup_exponent)(char *buf, BOOL three_digit_exp)
     }
 }
 
+/* pf_mul64: 64x64 bits multiplication with 128 bits result */
+static inline void FUNC_NAME(pf_mul64)(ULONGLONG a, ULONGLONG b, ULONGLONG *hi, ULONGLONG *lo)
+{
+    ULONGLONG p0 = (a & 0xffffffff) * (b & 0xffffffff);
+    ULONGLONG p1 = (a & 0xffffffff) * (b >> 32);
+    ULONGLONG p2 = (a >> 32) * (b & 0xffffffff);
+    ULONGLONG p3 = (a >> 32) * (b >> 32);
+    ULONGLONG mid = (p0 >> 32) + (p1 & 0xffffffff) + (p2 & 0xffffffff);
+
+    *lo = (mid << 32) | (p0 & 0xffffffff);
+    *hi = p3 + (p1 >> 32) + (p2 >> 32) + (mid >> 32);
+}
+
+/* pf_round_scaled: computes val*10^p rounded to an integer, where val is m*2^e.
+ * Fails if the result doesn't fit in 17 digits or if it's a tie, so the
+ * rounding mode doesn't matter. */
+static inline BOOL FUNC_NAME(pf_round_scaled)(ULONGLONG m, int e, int p, ULONGLONG *ret)
+{
+    static const ULONGLONG pow10[] = {
+        1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000,
+        1000000000, 10000000000, 100000000000, 1000000000000, 10000000000000,
+        100000000000000, 1000000000000000, 10000000000000000, 100000000000000000,
+        1000000000000000000, 10000000000000000000u };
+    ULONGLONG hi, lo, q, rem_hi, rem_lo, half_hi, half_lo;
+    int s = -e;
+
+    if(p < 0 || p >= sizeof(pow10)/sizeof(pow10[0]))
+        return FALSE;
+
+    FUNC_NAME(pf_mul64)(m, pow10[p], &hi, &lo);
+    if(e >= 0) {
+        if(hi || e >= 64 || (lo << e) >> e != lo)
+            return FALSE;
+        q = lo << e;
+    } else if(s < 64) {
+        if(hi >> s)
+            return FALSE;
+        q = (lo >> s) | (hi << (64 - s));
+        rem_hi = 0;
+        rem_lo = lo & (((ULONGLONG)1 << s) - 1);
+        half_hi = 0;
+        half_lo = (ULONGLONG)1 << (s - 1);
+    } else if(s == 64) {
+        q = hi;
+        rem_hi = 0;
+        rem_lo = lo;
+        half_hi = 0;
+        half_lo = (ULONGLONG)1 << 63;
+    } else if(s < 128) {
+        q = hi >> (s - 64);
+        rem_hi = hi & (((ULONGLONG)1 << (s - 64)) - 1);
+        rem_lo = lo;
+        half_hi = (ULONGLONG)1 << (s - 65);
+        half_lo = 0;
+    } else {
+        return FALSE;
+    }
+
+    if(e < 0) {
+        if(rem_hi > half_hi || (rem_hi == half_hi && rem_lo > half_lo))
+            q++;
+        else if(rem_hi == half_hi && rem_lo == half_lo)
+            return FALSE;
+    }
+
+    if(q >= pow10[17])
+        return FALSE;
+    *ret = q;
+    return TRUE;
+}
+
+/* pf_format_float: formats non-negative val with the 'e' and 'f' formats
+ * without going through the C library, returns FALSE for the cases it
+ * can't handle exactly. */
+static inline BOOL FUNC_NAME(pf_format_float)(char *buf, double val, FUNC_NAME(pf_flags) *flags)
+{
+    union { double f; ULONGLONG i; } u;
+    int prec = flags->Precision<0 ? 6 : flags->Precision;
+    int e, exp10 = 0, len, i;
+    ULONGLONG m, m2, q = 0;
+    char digits[24];
+
+    if(flags->Format!='e' && flags->Format!='E' && flags->Format!='f' && flags->Format!='F')
+        return FALSE;
+
+    u.f = val;
+    if(u.i >> 63)
+        return FALSE;
+    e = (u.i >> 52) & 0x7ff;
+    m = u.i & (((ULONGLONG)1 << 52) - 1);
+    if(e == 0x7ff)
+        return FALSE;
+    if(e)
+        m |= (ULONGLONG)1 << 52;
+    else
+        e = 1;
+    e -= 1075;
+
+    if(flags->Format=='f' || flags->Format=='F') {
+        if(m && !FUNC_NAME(pf_round_scaled)(m, e, prec, &q))
+            return FALSE;
+    } else if(m) {
+        if(prec > 16)
+            return FALSE;
+
+        /* log10 may be off by one, fix it with the number of digits */
+        exp10 = floor(log10(val));
+        for(i=0; i<2; i++) {
+            if(!FUNC_NAME(pf_round_scaled)(m, e, prec-exp10, &q))
+                return FALSE;
+            for(m2=q, len=0; m2; len++)
+                m2 /= 10;
+            if(len == prec+1)
+                break;
+            exp10 += (len > prec+1 ? 1 : -1);
+        }
+        if(i == 2)
+            return FALSE;
+    }
+
+    /* digits of q, padded with zeros to at least prec+1 digits */
+    len = 0;
+    do {
+        digits[len++] = '0' + q%10;
+        q /= 10;
+    } while(q);
+    while(len <= prec)
+        digits[len++] = '0';
+
+    if(flags->Format=='f' || flags->Format=='F') {
+        for(i=len-1; i>=prec; i--)
+            *buf++ = digits[i];
+        if(prec || flags->Alternate)
+            *buf++ = '.';
+        for(; i>=0; i--)
+            *buf++ = digits[i];
+        *buf = 0;
+    } else {
+        *buf++ = digits[len-1];
+        if(prec || flags->Alternate)
+            *buf++ = '.';
+        for(i=len-2; i>=0; i--)
+            *buf++ = digits[i];
+        sprintf(buf, "%c%c%02d", flags->Format, exp10<0 ? '-' : '+', exp10<0 ? -exp10 : exp10);
+    }
+    return TRUE;
+}
+
 int FUNC_NAME(pf_printf)(FUNC_NAME(puts_clbk) pf_puts, void *puts_ctx, const APICHAR *fmt,
         MSVCRT__locale_t locale, DWORD options,
         args_clbk pf_args, void *args_ctx, __ms_va_list *valist)
@@ -627,7 +798,8 @@ int FUNC_NAME(pf_printf)(FUNC_NAME(puts_clbk) pf_puts, void *puts_ctx, const API
                     for(i=0; tmp[i]; i++)
                         tmp[i] = toupper(tmp[i]);
             } else {
-                sprintf(tmp, float_fmt, val);
+                if(!FUNC_NAME(pf_format_float)(tmp, val, &flags))
+                    sprintf(tmp, float_fmt, val);
                 if(toupper(flags.Format)=='E' || toupper(flags.Format)=='G')
                     FUNC_NAME(pf_fixup_exponent)(tmp, three_digit_exp);
             }
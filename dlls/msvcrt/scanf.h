@@ -114,8 +114,9 @@
 #endif /* STRING_LEN */
 #else /* STRING */
 #ifdef WIDE_SCANF
-#define _GETC_(file) (consumed++, MSVCRT_fgetwc(file))
-#define _UNGETC_(nch, file) do { MSVCRT_ungetwc(nch, file); consumed--; } while(0)
+/* the file is locked for the whole call, use the nolock functions */
+#define _GETC_(file) (consumed++, MSVCRT__fgetwc_nolock(file))
+#define _UNGETC_(nch, file) do { MSVCRT__ungetwc_nolock(nch, file); consumed--; } while(0)
 #define _LOCK_FILE_(file) MSVCRT__lock_file(file)
 #define _UNLOCK_FILE_(file) MSVCRT__unlock_file(file)
 #ifdef SECURE
@@ -124,8 +125,9 @@
 #define _FUNCTION_ static int MSVCRT_vfwscanf_l(MSVCRT_FILE* file, const MSVCRT_wchar_t *format, MSVCRT__locale_t locale, __ms_va_list ap)
 #endif /* SECURE */
 #else /* WIDE_SCANF */
-#define _GETC_(file) (consumed++, MSVCRT_fgetc(file))
-#define _UNGETC_(nch, file) do { MSVCRT_ungetc(nch, file); consumed--; } while(0)
+/* the file is locked for the whole call, use the nolock functions */
+#define _GETC_(file) (consumed++, MSVCRT__fgetc_nolock(file))
+#define _UNGETC_(nch, file) do { MSVCRT__ungetc_nolock(nch, file); consumed--; } while(0)
 #define _LOCK_FILE_(file) MSVCRT__lock_file(file)
 #define _UNLOCK_FILE_(file) MSVCRT__unlock_file(file)
 #ifdef SECURE
@@ -0,0 +1,1770 @@
+/*
+ * Concurrency Runtime scheduler
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301, USA
+ */
+
+#include "config.h"
+#include "wine/port.h"
+
+#include <stdarg.h>
+
+#include "windef.h"
+#include "winbase.h"
+#include "winternl.h"
+#include "wine/debug.h"
+#include "msvcrt.h"
+#include "cppexcept.h"
+#include "cxx.h"
+
+#if _MSVCR_VER >= 100
+
+WINE_DEFAULT_DEBUG_CHANNEL(msvcrt);
+
+typedef void (__cdecl *proc_t)(void*);
+
+typedef struct {
+    const vtable_ptr *vtable;
+} Context;
+
+typedef struct {
+    Context *context;
+} _Context;
+
+typedef struct {
+    const vtable_ptr *vtable;
+} Scheduler;
+
+typedef struct {
+    Scheduler *scheduler;
+} _Scheduler;
+
+typedef struct {
+    const vtable_ptr *vtable;
+} ScheduleGroup;
+
+typedef enum {
+    SchedulerKind,
+    MaxConcurrency,
+    MinConcurrency,
+    TargetOversubscriptionFactor,
+    LocalContextCacheSize,
+    ContextStackSize,
+    ContextPriority,
+    SchedulingProtocol,
+    DynamicProgressFeedback,
+    WinRTInitialization,
+    last_policy_id
+} PolicyElementKey;
+
+#define MAX_EXECUTION_RESOURCES  ~0u
+#define INHERIT_THREAD_PRIORITY  0xf000
+
+typedef struct {
+    struct _policy_container {
+        unsigned int policies[last_policy_id];
+    } *policy_container;
+} SchedulerPolicy;
+
+typedef enum {
+    TASK_COLLECTION_NOT_COMPLETE,
+    TASK_COLLECTION_SUCCESS,
+    TASK_COLLECTION_CANCELLED
+} _TaskCollectionStatus;
+
+/* The first fields are initialized by inline code in the PPL headers when
+ * msvcr100 is used, only count and finished have a well known meaning there. */
+typedef struct _StructuredTaskCollection
+{
+    struct ExternalContextBase *waiter;
+    LONG canceled;
+    void *token_state;
+    Context *context;
+    LONG count;
+    LONG finished;
+    void *exception;
+    void *token;
+} _StructuredTaskCollection;
+
+typedef _StructuredTaskCollection _TaskCollection;
+
+#define FINISHED_INITIAL 0x80000000
+
+typedef struct _UnrealizedChore
+{
+    const vtable_ptr *vtable;
+    void (__cdecl *chore_proc)(struct _UnrealizedChore*);
+    _StructuredTaskCollection *task_collection;
+    void (__cdecl *chore_wrapper)(void*);
+    MSVCRT_bool runtime_owns_lifetime;
+    MSVCRT_bool detached;
+} _UnrealizedChore;
+
+typedef struct
+{
+    proc_t proc;
+    void *data;
+    struct ScheduleGroupBase *group;
+} sched_task;
+
+/* Work-stealing deque of a virtual processor. The owning worker pushes and
+ * pops at the tail, other workers steal the oldest task from the head. */
+typedef struct
+{
+    CRITICAL_SECTION cs;
+    sched_task *tasks;
+    unsigned int head;
+    unsigned int count;
+    unsigned int size;
+} task_queue;
+
+typedef struct ThreadScheduler
+{
+    Scheduler scheduler;
+    LONG ref;
+    LONG internal_ref;
+    unsigned int id;
+    unsigned int virt_proc_no;
+    SchedulerPolicy policy;
+    CRITICAL_SECTION cs;
+    CONDITION_VARIABLE cv;
+    int shutdown_count;
+    int shutdown_size;
+    HANDLE *shutdown_events;
+    BOOL shutdown;
+    unsigned int threads_no;
+    LONG queued;
+    LONG sleeping;
+    LONG next_queue;
+    task_queue *queues;
+} ThreadScheduler;
+
+typedef struct ScheduleGroupBase
+{
+    ScheduleGroup group;
+    LONG ref;
+    unsigned int id;
+    ThreadScheduler *scheduler;
+} ScheduleGroupBase;
+
+struct scheduler_list {
+    struct scheduler_list *next;
+    Scheduler *scheduler;
+};
+
+typedef struct ExternalContextBase
+{
+    Context context;
+    struct scheduler_list scheduler;
+    unsigned int id;
+    LONG blocked;
+    HANDLE event;
+    ThreadScheduler *worker;
+    unsigned int virt_proc;
+    ScheduleGroupBase *group;
+    _StructuredTaskCollection *task_collection;
+} ExternalContextBase;
+
+extern const vtable_ptr MSVCRT_type_info_vtable;
+extern const vtable_ptr MSVCRT_ExternalContextBase_vtable;
+extern const vtable_ptr MSVCRT_ThreadScheduler_vtable;
+extern const vtable_ptr MSVCRT_ScheduleGroupBase_vtable;
+
+static DWORD context_tls_index = TLS_OUT_OF_INDEXES;
+
+static CRITICAL_SECTION default_scheduler_cs;
+static CRITICAL_SECTION_DEBUG default_scheduler_cs_debug =
+{
+    0, 0, &default_scheduler_cs,
+    { &default_scheduler_cs_debug.ProcessLocksList, &default_scheduler_cs_debug.ProcessLocksList },
+      0, 0, { (DWORD_PTR)(__FILE__ ": default_scheduler_cs") }
+};
+static CRITICAL_SECTION default_scheduler_cs = { &default_scheduler_cs_debug, -1, 0, 0, 0, 0 };
+static SchedulerPolicy default_scheduler_policy;
+static ThreadScheduler *default_scheduler;
+
+static void ExternalContextBase_ctor(ExternalContextBase*);
+static void ThreadScheduler_dtor(ThreadScheduler*);
+unsigned int __thiscall ThreadScheduler_Release(ThreadScheduler*);
+unsigned int __thiscall ScheduleGroupBase_Release(ScheduleGroupBase*);
+
+#ifdef __i386__
+static inline void call__UnrealizedChore_dtor(_UnrealizedChore *chore)
+{
+    void *this = chore;
+
+    __asm__ __volatile__("pushl $1; call *%1"
+                         : "+c" (this) : "r" (chore->vtable[0]) : "eax", "edx", "memory" );
+}
+#else
+static inline void call__UnrealizedChore_dtor(_UnrealizedChore *chore)
+{
+    ((void* (__cdecl*)(_UnrealizedChore*, unsigned int))chore->vtable[0])(chore, 1);
+}
+#endif
+
+static ExternalContextBase* try_get_current_context(void)
+{
+    if (context_tls_index == TLS_OUT_OF_INDEXES)
+        return NULL;
+    return TlsGetValue(context_tls_index);
+}
+
+static ExternalContextBase* get_current_context(void)
+{
+    ExternalContextBase *ret;
+
+    if (context_tls_index == TLS_OUT_OF_INDEXES) {
+        DWORD tls_index = TlsAlloc();
+        if (tls_index == TLS_OUT_OF_INDEXES) {
+            ERR("TlsAlloc failed\n");
+            throw_bad_alloc("not enough memory");
+        }
+
+        if(InterlockedCompareExchange((LONG*)&context_tls_index, tls_index, TLS_OUT_OF_INDEXES) != TLS_OUT_OF_INDEXES)
+            TlsFree(tls_index);
+    }
+
+    ret = TlsGetValue(context_tls_index);
+    if (!ret) {
+        ret = MSVCRT_operator_new(sizeof(*ret));
+        ExternalContextBase_ctor(ret);
+        TlsSetValue(context_tls_index, ret);
+    }
+    return ret;
+}
+
+static void context_block(ExternalContextBase *context)
+{
+    if (InterlockedDecrement(&context->blocked) < 0)
+        WaitForSingleObject(context->event, INFINITE);
+}
+
+static void context_unblock(ExternalContextBase *context)
+{
+    if (InterlockedIncrement(&context->blocked) <= 0)
+        SetEvent(context->event);
+}
+
+/* ??0SchedulerPolicy@Concurrency@@QAE@XZ */
+/* ??0SchedulerPolicy@Concurrency@@QEAA@XZ */
+DEFINE_THISCALL_WRAPPER(SchedulerPolicy_ctor, 4)
+SchedulerPolicy* __thiscall SchedulerPolicy_ctor(SchedulerPolicy *this)
+{
+    TRACE("(%p)\n", this);
+
+    this->policy_container = MSVCRT_operator_new(sizeof(*this->policy_container));
+    this->policy_container->policies[SchedulerKind] = 0;
+    this->policy_container->policies[MaxConcurrency] = MAX_EXECUTION_RESOURCES;
+    this->policy_container->policies[MinConcurrency] = 1;
+    this->policy_container->policies[TargetOversubscriptionFactor] = 1;
+    this->policy_container->policies[LocalContextCacheSize] = 8;
+    this->policy_container->policies[ContextStackSize] = 0;
+    this->policy_container->policies[ContextPriority] = THREAD_PRIORITY_NORMAL;
+    this->policy_container->policies[SchedulingProtocol] = 0;
+    this->policy_container->policies[DynamicProgressFeedback] = 1;
+    this->policy_container->policies[WinRTInitialization] = 1;
+    return this;
+}
+
+/* ??0SchedulerPolicy@Concurrency@@QAA@IZZ */
+/* ??0SchedulerPolicy@Concurrency@@QEAA@_KZZ */
+SchedulerPolicy* WINAPIV SchedulerPolicy_ctor_policies(
+        SchedulerPolicy *this, MSVCRT_size_t n, ...)
+{
+    unsigned int min_concurrency, max_concurrency;
+    __ms_va_list valist;
+    MSVCRT_size_t i;
+
+    TRACE("(%p %lu)\n", this, n);
+
+    SchedulerPolicy_ctor(this);
+    min_concurrency = this->policy_container->policies[MinConcurrency];
+    max_concurrency = this->policy_container->policies[MaxConcurrency];
+
+    __ms_va_start(valist, n);
+    for(i=0; i<n; i++) {
+        PolicyElementKey policy = va_arg(valist, PolicyElementKey);
+        unsigned int val = va_arg(valist, unsigned int);
+
+        if(policy == MinConcurrency)
+            min_concurrency = val;
+        else if(policy == MaxConcurrency)
+            max_concurrency = val;
+        else if(policy < last_policy_id)
+            this->policy_container->policies[policy] = val;
+        else
+            FIXME("throw invalid_scheduler_policy_key exception\n");
+    }
+    __ms_va_end(valist);
+
+    if(min_concurrency > max_concurrency)
+        FIXME("throw invalid_scheduler_policy_thread_specification exception\n");
+    else {
+        this->policy_container->policies[MinConcurrency] = min_concurrency;
+        this->policy_container->policies[MaxConcurrency] = max_concurrency;
+    }
+    return this;
+}
+
+/* ??4SchedulerPolicy@Concurrency@@QAEAAV01@ABV01@@Z */
+/* ??4SchedulerPolicy@Concurrency@@QEAAAEAV01@AEBV01@@Z */
+DEFINE_THISCALL_WRAPPER(SchedulerPolicy_op_assign, 8)
+SchedulerPolicy* __thiscall SchedulerPolicy_op_assign(
+        SchedulerPolicy *this, const SchedulerPolicy *rhs)
+{
+    TRACE("(%p %p)\n", this, rhs);
+    memcpy(this->policy_container->policies, rhs->policy_container->policies,
+            sizeof(this->policy_container->policies));
+    return this;
+}
+
+/* ??0SchedulerPolicy@Concurrency@@QAE@ABV01@@Z */
+/* ??0SchedulerPolicy@Concurrency@@QEAA@AEBV01@@Z */
+DEFINE_THISCALL_WRAPPER(SchedulerPolicy_copy_ctor, 8)
+SchedulerPolicy* __thiscall SchedulerPolicy_copy_ctor(
+        SchedulerPolicy *this, const SchedulerPolicy *rhs)
+{
+    TRACE("(%p %p)\n", this, rhs);
+    SchedulerPolicy_ctor(this);
+    return SchedulerPolicy_op_assign(this, rhs);
+}
+
+/* ??1SchedulerPolicy@Concurrency@@QAE@XZ */
+/* ??1SchedulerPolicy@Concurrency@@QEAA@XZ */
+DEFINE_THISCALL_WRAPPER(SchedulerPolicy_dtor, 4)
+void __thiscall SchedulerPolicy_dtor(SchedulerPolicy *this)
+{
+    TRACE("(%p)\n", this);
+    MSVCRT_operator_delete(this->policy_container);
+}
+
+/* ?GetPolicyValue@SchedulerPolicy@Concurrency@@QBEIW4PolicyElementKey@2@@Z */
+/* ?GetPolicyValue@SchedulerPolicy@Concurrency@@QEBAIW4PolicyElementKey@2@@Z */
+DEFINE_THISCALL_WRAPPER(SchedulerPolicy_GetPolicyValue, 8)
+unsigned int __thiscall SchedulerPolicy_GetPolicyValue(
+        const SchedulerPolicy *this, PolicyElementKey policy)
+{
+    TRACE("(%p %d)\n", this, policy);
+
+    if(policy >= last_policy_id) {
+        FIXME("throw invalid_scheduler_policy_key exception\n");
+        return 0;
+    }
+    return this->policy_container->policies[policy];
+}
+
+/* ?SetPolicyValue@SchedulerPolicy@Concurrency@@QAEIW4PolicyElementKey@2@I@Z */
+/* ?SetPolicyValue@SchedulerPolicy@Concurrency@@QEAAIW4PolicyElementKey@2@I@Z */
+DEFINE_THISCALL_WRAPPER(SchedulerPolicy_SetPolicyValue, 12)
+unsigned int __thiscall SchedulerPolicy_SetPolicyValue(SchedulerPolicy *this,
+        PolicyElementKey policy, unsigned int val)
+{
+    unsigned int ret;
+
+    TRACE("(%p %d %d)\n", this, policy, val);
+
+    if(policy == MinConcurrency || policy == MaxConcurrency || policy >= last_policy_id) {
+        FIXME("throw invalid_scheduler_policy_key exception\n");
+        return 0;
+    }
+
+    ret = this->policy_container->policies[policy];
+    this->policy_container->policies[policy] = val;
+    return ret;
+}
+
+/* ?SetConcurrencyLimits@SchedulerPolicy@Concurrency@@QAEXII@Z */
+/* ?SetConcurrencyLimits@SchedulerPolicy@Concurrency@@QEAAXII@Z */
+DEFINE_THISCALL_WRAPPER(SchedulerPolicy_SetConcurrencyLimits, 12)
+void __thiscall SchedulerPolicy_SetConcurrencyLimits(SchedulerPolicy *this,
+        unsigned int min_concurrency, unsigned int max_concurrency)
+{
+    TRACE("(%p %d %d)\n", this, min_concurrency, max_concurrency);
+
+    if(min_concurrency > max_concurrency) {
+        FIXME("throw invalid_scheduler_policy_thread_specification exception\n");
+        return;
+    }
+
+    this->policy_container->policies[MinConcurrency] = min_concurrency;
+    this->policy_container->policies[MaxConcurrency] = max_concurrency;
+}
+
+static BOOL task_queue_push(task_queue *queue, const sched_task *task)
+{
+    EnterCriticalSection(&queue->cs);
+    if(queue->count == queue->size) {
+        unsigned int size = queue->size ? queue->size*2 : 64;
+        sched_task *tasks;
+
+        if(!(tasks = HeapAlloc(GetProcessHeap(), 0, size*sizeof(*tasks)))) {
+            LeaveCriticalSection(&queue->cs);
+            return FALSE;
+        }
+        if(queue->size) {
+            memcpy(tasks, queue->tasks+queue->head, (queue->size-queue->head)*sizeof(*tasks));
+            memcpy(tasks+queue->size-queue->head, queue->tasks, queue->head*sizeof(*tasks));
+        }
+        HeapFree(GetProcessHeap(), 0, queue->tasks);
+        queue->tasks = tasks;
+        queue->head = 0;
+        queue->size = size;
+    }
+    queue->tasks[(queue->head+queue->count++) % queue->size] = *task;
+    LeaveCriticalSection(&queue->cs);
+    return TRUE;
+}
+
+static BOOL task_queue_pop(task_queue *queue, sched_task *task, BOOL steal)
+{
+    if(!queue->count)
+        return FALSE;
+
+    EnterCriticalSection(&queue->cs);
+    if(!queue->count) {
+        LeaveCriticalSection(&queue->cs);
+        return FALSE;
+    }
+
+    if(steal) {
+        *task = queue->tasks[queue->head];
+        queue->head = (queue->head+1) % queue->size;
+    }else {
+        *task = queue->tasks[(queue->head+queue->count-1) % queue->size];
+    }
+    queue->count--;
+    LeaveCriticalSection(&queue->cs);
+    return TRUE;
+}
+
+/* Takes a task from the worker's own queue, or steals one from another
+ * virtual processor. External contexts only steal. */
+static BOOL scheduler_get_task(ThreadScheduler *this, ExternalContextBase *context, sched_task *task)
+{
+    unsigned int i, start;
+
+    if(!this->queued)
+        return FALSE;
+
+    if(context->worker == this) {
+        if(task_queue_pop(&this->queues[context->virt_proc], task, FALSE))
+            goto done;
+        start = context->virt_proc + 1;
+    }else {
+        start = this->next_queue;
+    }
+
+    for(i=0; i<this->virt_proc_no; i++) {
+        if(task_queue_pop(&this->queues[(start+i) % this->virt_proc_no], task, TRUE))
+            goto done;
+    }
+    return FALSE;
+
+done:
+    InterlockedDecrement(&this->queued);
+    return TRUE;
+}
+
+static BOOL scheduler_run_task(ThreadScheduler *this, ExternalContextBase *context)
+{
+    ScheduleGroupBase *group;
+    sched_task task;
+
+    if(!scheduler_get_task(this, context, &task))
+        return FALSE;
+
+    group = context->group;
+    context->group = task.group;
+    task.proc(task.data);
+    context->group = group;
+
+    if(task.group)
+        ScheduleGroupBase_Release(task.group);
+    return TRUE;
+}
+
+static void scheduler_release_internal(ThreadScheduler *this)
+{
+    if(!InterlockedDecrement(&this->internal_ref)) {
+        ThreadScheduler_dtor(this);
+        MSVCRT_operator_delete(this);
+    }
+}
+
+struct worker_args
+{
+    ThreadScheduler *scheduler;
+    unsigned int virt_proc;
+};
+
+static DWORD WINAPI worker_thread_proc(void *arg)
+{
+    struct worker_args args = *(struct worker_args*)arg;
+    ThreadScheduler *scheduler = args.scheduler;
+    ExternalContextBase *context;
+    BOOL exit;
+
+    HeapFree(GetProcessHeap(), 0, arg);
+
+    context = get_current_context();
+    context->scheduler.scheduler = &scheduler->scheduler;
+    context->worker = scheduler;
+    context->virt_proc = args.virt_proc;
+
+    while(1) {
+        unsigned int spin;
+
+        if(scheduler_run_task(scheduler, context))
+            continue;
+
+        for(spin=0; spin<1000 && !scheduler->queued && !scheduler->shutdown; spin++) {
+#if defined(__i386__) || defined(__x86_64__)
+            __asm__ __volatile__( "rep;nop" : : : "memory" );
+#else
+            __asm__ __volatile__( "" : : : "memory" );
+#endif
+        }
+        if(scheduler->queued)
+            continue;
+
+        EnterCriticalSection(&scheduler->cs);
+        InterlockedIncrement(&scheduler->sleeping);
+        while(!scheduler->queued && !scheduler->shutdown)
+            SleepConditionVariableCS(&scheduler->cv, &scheduler->cs, INFINITE);
+        InterlockedDecrement(&scheduler->sleeping);
+        exit = scheduler->shutdown && !scheduler->queued;
+        LeaveCriticalSection(&scheduler->cs);
+
+        if(exit)
+            break;
+    }
+
+    context->scheduler.scheduler = NULL;
+    context->worker = NULL;
+    context->virt_proc = -1;
+    scheduler_release_internal(scheduler);
+    return 0;
+}
+
+static void scheduler_start_workers(ThreadScheduler *this)
+{
+    unsigned int stack_size = this->policy.policy_container->policies[ContextStackSize];
+    unsigned int priority = this->policy.policy_container->policies[ContextPriority];
+    unsigned int i;
+
+    EnterCriticalSection(&this->cs);
+    for(i=this->threads_no; i<this->virt_proc_no; i++) {
+        struct worker_args *args;
+        HANDLE thread;
+
+        if(!(args = HeapAlloc(GetProcessHeap(), 0, sizeof(*args))))
+            break;
+        args->scheduler = this;
+        args->virt_proc = i;
+
+        InterlockedIncrement(&this->internal_ref);
+        thread = CreateThread(NULL, stack_size*1024, worker_thread_proc, args,
+                stack_size ? STACK_SIZE_PARAM_IS_A_RESERVATION : 0, NULL);
+        if(!thread) {
+            ERR("failed to create worker thread: %u\n", GetLastError());
+            InterlockedDecrement(&this->internal_ref);
+            HeapFree(GetProcessHeap(), 0, args);
+            break;
+        }
+        if(priority != INHERIT_THREAD_PRIORITY)
+            SetThreadPriority(thread, priority);
+        CloseHandle(thread);
+        this->threads_no++;
+    }
+    LeaveCriticalSection(&this->cs);
+}
+
+static void scheduler_push_task(ThreadScheduler *this, proc_t proc, void *data, ScheduleGroupBase *group)
+{
+    ExternalContextBase *context = get_current_context();
+    sched_task task;
+    task_queue *queue;
+
+    task.proc = proc;
+    task.data = data;
+    task.group = group;
+    if(group)
+        InterlockedIncrement(&group->ref);
+
+    if(context->worker == this)
+        queue = &this->queues[context->virt_proc];
+    else
+        queue = &this->queues[(unsigned int)InterlockedIncrement(&this->next_queue) % this->virt_proc_no];
+
+    if(this->threads_no < this->virt_proc_no)
+        scheduler_start_workers(this);
+
+    if(!this->threads_no || !task_queue_push(queue, &task)) {
+        WARN("running task %p synchronously\n", proc);
+        context->group = group;
+        proc(data);
+        context->group = NULL;
+        if(group)
+            ScheduleGroupBase_Release(group);
+        return;
+    }
+
+    InterlockedIncrement(&this->queued);
+    if(this->sleeping) {
+        EnterCriticalSection(&this->cs);
+        WakeConditionVariable(&this->cv);
+        LeaveCriticalSection(&this->cs);
+    }
+}
+
+static void ExternalContextBase_ctor(ExternalContextBase *this)
+{
+    static LONG context_id = -1;
+
+    TRACE("(%p)->()\n", this);
+
+    memset(this, 0, sizeof(*this));
+    this->context.vtable = &MSVCRT_ExternalContextBase_vtable;
+    this->id = InterlockedIncrement(&context_id);
+    this->event = CreateEventW(NULL, FALSE, FALSE, NULL);
+    this->virt_proc = -1;
+}
+
+static void ExternalContextBase_dtor(ExternalContextBase *this)
+{
+    struct scheduler_list *scheduler_cur, *scheduler_next;
+
+    TRACE("(%p)\n", this);
+
+    /* workers don't hold a reference to their own scheduler */
+    if(this->worker && !this->scheduler.next)
+        this->scheduler.scheduler = NULL;
+
+    if(this->scheduler.scheduler) {
+        ThreadScheduler_Release((ThreadScheduler*)this->scheduler.scheduler);
+
+        for(scheduler_cur=this->scheduler.next; scheduler_cur; scheduler_cur=scheduler_next) {
+            scheduler_next = scheduler_cur->next;
+            ThreadScheduler_Release((ThreadScheduler*)scheduler_cur->scheduler);
+            MSVCRT_operator_delete(scheduler_cur);
+        }
+    }
+    CloseHandle(this->event);
+}
+
+DEFINE_THISCALL_WRAPPER(ExternalContextBase_GetId, 4)
+unsigned int __thiscall ExternalContextBase_GetId(const ExternalContextBase *this)
+{
+    TRACE("(%p)->()\n", this);
+    return this->id;
+}
+
+DEFINE_THISCALL_WRAPPER(ExternalContextBase_GetVirtualProcessorId, 4)
+unsigned int __thiscall ExternalContextBase_GetVirtualProcessorId(const ExternalContextBase *this)
+{
+    TRACE("(%p)->()\n", this);
+    return this->virt_proc;
+}
+
+DEFINE_THISCALL_WRAPPER(ExternalContextBase_GetScheduleGroupId, 4)
+unsigned int __thiscall ExternalContextBase_GetScheduleGroupId(const ExternalContextBase *this)
+{
+    TRACE("(%p)->()\n", this);
+    return this->group ? this->group->id : -1;
+}
+
+DEFINE_THISCALL_WRAPPER(ExternalContextBase_Unblock, 4)
+void __thiscall ExternalContextBase_Unblock(ExternalContextBase *this)
+{
+    TRACE("(%p)->()\n", this);
+
+    if(this->blocked > 0)
+        FIXME("throw context_unblock_unbalanced exception\n");
+    context_unblock(this);
+}
+
+DEFINE_THISCALL_WRAPPER(ExternalContextBase_IsSynchronouslyBlocked, 4)
+MSVCRT_bool __thiscall ExternalContextBase_IsSynchronouslyBlocked(const ExternalContextBase *this)
+{
+    TRACE("(%p)->()\n", this);
+    return this->blocked < 0;
+}
+
+DEFINE_THISCALL_WRAPPER(ExternalContextBase_vector_dtor, 8)
+Context* __thiscall ExternalContextBase_vector_dtor(ExternalContextBase *this, unsigned int flags)
+{
+    TRACE("(%p %x)\n", this, flags);
+    if(flags & 2) {
+        /* we have an array, with the number of elements stored before the first object */
+        INT_PTR i, *ptr = (INT_PTR *)this-1;
+
+        for(i=*ptr-1; i>=0; i--)
+            ExternalContextBase_dtor(this+i);
+        MSVCRT_operator_delete(ptr);
+    } else {
+        ExternalContextBase_dtor(this);
+        if(flags & 1)
+            MSVCRT_operator_delete(this);
+    }
+
+    return &this->context;
+}
+
+/* ?CurrentContext@Context@Concurrency@@SAPAV12@XZ */
+/* ?CurrentContext@Context@Concurrency@@SAPEAV12@XZ */
+Context* __cdecl Context_CurrentContext(void)
+{
+    TRACE("()\n");
+    return &get_current_context()->context;
+}
+
+/* ?Id@Context@Concurrency@@SAIXZ */
+unsigned int __cdecl Context_Id(void)
+{
+    ExternalContextBase *ctx = try_get_current_context();
+    TRACE("()\n");
+    return ctx ? ctx->id : -1;
+}
+
+/* ?VirtualProcessorId@Context@Concurrency@@SAIXZ */
+unsigned int __cdecl Context_VirtualProcessorId(void)
+{
+    ExternalContextBase *ctx = try_get_current_context();
+    TRACE("()\n");
+    return ctx ? ctx->virt_proc : -1;
+}
+
+/* ?ScheduleGroupId@Context@Concurrency@@SAIXZ */
+unsigned int __cdecl Context_ScheduleGroupId(void)
+{
+    ExternalContextBase *ctx = try_get_current_context();
+    TRACE("()\n");
+    return ctx && ctx->group ? ctx->group->id : -1;
+}
+
+/* ?Block@Context@Concurrency@@SAXXZ */
+void __cdecl Context_Block(void)
+{
+    TRACE("()\n");
+    context_block(get_current_context());
+}
+
+/* ?Yield@Context@Concurrency@@SAXXZ */
+/* ?_Yield@_Context@details@Concurrency@@SAXXZ */
+void __cdecl Context_Yield(void)
+{
+    TRACE("()\n");
+    SwitchToThread();
+}
+
+/* ?_SpinYield@Context@Concurrency@@SAXXZ */
+void __cdecl Context__SpinYield(void)
+{
+    TRACE("()\n");
+    Sleep(0);
+}
+
+/* ?IsCurrentTaskCollectionCanceling@Context@Concurrency@@SA_NXZ */
+MSVCRT_bool __cdecl Context_IsCurrentTaskCollectionCanceling(void)
+{
+    ExternalContextBase *ctx = try_get_current_context();
+    TRACE("()\n");
+    return ctx && ctx->task_collection && ctx->task_collection->canceled;
+}
+
+/* ?Oversubscribe@Context@Concurrency@@SAX_N@Z */
+/* ?_Oversubscribe@_Context@details@Concurrency@@SAX_N@Z */
+void __cdecl Context_Oversubscribe(MSVCRT_bool begin)
+{
+    FIXME("(%x)\n", begin);
+}
+
+#if _MSVCR_VER >= 110
+/* ??0_Context@details@Concurrency@@QAE@PAVContext@2@@Z */
+/* ??0_Context@details@Concurrency@@QEAA@PEAVContext@2@@Z */
+DEFINE_THISCALL_WRAPPER(_Context_ctor, 8)
+_Context* __thiscall _Context_ctor(_Context *this, Context *context)
+{
+    TRACE("(%p %p)\n", this, context);
+    this->context = context;
+    return this;
+}
+
+/* ??_F_Context@details@Concurrency@@QAEXXZ */
+/* ??_F_Context@details@Concurrency@@QEAAXXZ */
+DEFINE_THISCALL_WRAPPER(_Context_ctor_default, 4)
+_Context* __thiscall _Context_ctor_default(_Context *this)
+{
+    return _Context_ctor(this, NULL);
+}
+
+/* ?_CurrentContext@_Context@details@Concurrency@@SA?AV123@XZ */
+_Context* __cdecl _Context__CurrentContext(_Context *ret)
+{
+    TRACE("(%p)\n", ret);
+    return _Context_ctor(ret, Context_CurrentContext());
+}
+
+/* ?_IsSynchronouslyBlocked@_Context@details@Concurrency@@QBE_NXZ */
+/* ?_IsSynchronouslyBlocked@_Context@details@Concurrency@@QEBA_NXZ */
+DEFINE_THISCALL_WRAPPER(_Context__IsSynchronouslyBlocked, 4)
+MSVCRT_bool __thiscall _Context__IsSynchronouslyBlocked(const _Context *this)
+{
+    TRACE("(%p)\n", this);
+    return ExternalContextBase_IsSynchronouslyBlocked((ExternalContextBase*)this->context);
+}
+#endif
+
+/* ?Alloc@Concurrency@@YAPAXI@Z */
+/* ?Alloc@Concurrency@@YAPEAX_K@Z */
+void * CDECL Concurrency_Alloc(MSVCRT_size_t size)
+{
+    TRACE("(%lu)\n", size);
+    return MSVCRT_operator_new(size);
+}
+
+/* ?Free@Concurrency@@YAXPAX@Z */
+/* ?Free@Concurrency@@YAXPEAX@Z */
+void CDECL Concurrency_Free(void* mem)
+{
+    TRACE("(%p)\n", mem);
+    MSVCRT_operator_delete(mem);
+}
+
+static ThreadScheduler* ThreadScheduler_ctor(ThreadScheduler *this,
+        const SchedulerPolicy *policy)
+{
+    static LONG scheduler_id = -1;
+    unsigned int i;
+
+    TRACE("(%p)->()\n", this);
+
+    memset(this, 0, sizeof(*this));
+    this->scheduler.vtable = &MSVCRT_ThreadScheduler_vtable;
+    this->ref = 1;
+    this->internal_ref = 1;
+    this->id = InterlockedIncrement(&scheduler_id);
+    SchedulerPolicy_copy_ctor(&this->policy, policy);
+
+    this->virt_proc_no = SchedulerPolicy_GetPolicyValue(&this->policy, MaxConcurrency);
+    if(this->virt_proc_no == MAX_EXECUTION_RESOURCES)
+        this->virt_proc_no = _GetConcurrency();
+    if(!this->virt_proc_no)
+        this->virt_proc_no = 1;
+
+    InitializeCriticalSection(&this->cs);
+    this->cs.DebugInfo->Spare[0] = (DWORD_PTR)(__FILE__ ": ThreadScheduler");
+    InitializeConditionVariable(&this->cv);
+
+    this->queues = MSVCRT_operator_new(this->virt_proc_no * sizeof(*this->queues));
+    for(i=0; i<this->virt_proc_no; i++) {
+        memset(&this->queues[i], 0, sizeof(this->queues[i]));
+        InitializeCriticalSectionAndSpinCount(&this->queues[i].cs, 4000);
+    }
+    return this;
+}
+
+static void ThreadScheduler_dtor(ThreadScheduler *this)
+{
+    unsigned int i;
+
+    TRACE("(%p)\n", this);
+
+    for(i=0; i<this->shutdown_count; i++)
+        SetEvent(this->shutdown_events[i]);
+    MSVCRT_operator_delete(this->shutdown_events);
+
+    for(i=0; i<this->virt_proc_no; i++) {
+        DeleteCriticalSection(&this->queues[i].cs);
+        HeapFree(GetProcessHeap(), 0, this->queues[i].tasks);
+    }
+    MSVCRT_operator_delete(this->queues);
+
+    this->cs.DebugInfo->Spare[0] = 0;
+    DeleteCriticalSection(&this->cs);
+    SchedulerPolicy_dtor(&this->policy);
+}
+
+DEFINE_THISCALL_WRAPPER(ThreadScheduler_Id, 4)
+unsigned int __thiscall ThreadScheduler_Id(const ThreadScheduler *this)
+{
+    TRACE("(%p)\n", this);
+    return this->id;
+}
+
+DEFINE_THISCALL_WRAPPER(ThreadScheduler_GetNumberOfVirtualProcessors, 4)
+unsigned int __thiscall ThreadScheduler_GetNumberOfVirtualProcessors(const ThreadScheduler *this)
+{
+    TRACE("(%p)\n", this);
+    return this->virt_proc_no;
+}
+
+DEFINE_THISCALL_WRAPPER(ThreadScheduler_GetPolicy, 8)
+SchedulerPolicy* __thiscall ThreadScheduler_GetPolicy(
+        const ThreadScheduler *this, SchedulerPolicy *ret)
+{
+    TRACE("(%p %p)\n", this, ret);
+    return SchedulerPolicy_copy_ctor(ret, &this->policy);
+}
+
+DEFINE_THISCALL_WRAPPER(ThreadScheduler_Reference, 4)
+unsigned int __thiscall ThreadScheduler_Reference(ThreadScheduler *this)
+{
+    TRACE("(%p)\n", this);
+    return InterlockedIncrement(&this->ref);
+}
+
+DEFINE_THISCALL_WRAPPER(ThreadScheduler_Release, 4)
+unsigned int __thiscall ThreadScheduler_Release(ThreadScheduler *this)
+{
+    unsigned int ret = InterlockedDecrement(&this->ref);
+
+    TRACE("(%p)\n", this);
+
+    if(!ret) {
+        /* the workers finish the queued tasks before exiting */
+        EnterCriticalSection(&this->cs);
+        this->shutdown = TRUE;
+        WakeAllConditionVariable(&this->cv);
+        LeaveCriticalSection(&this->cs);
+
+        scheduler_release_internal(this);
+    }
+    return ret;
+}
+
+DEFINE_THISCALL_WRAPPER(ThreadScheduler_RegisterShutdownEvent, 8)
+void __thiscall ThreadScheduler_RegisterShutdownEvent(ThreadScheduler *this, HANDLE event)
+{
+    HANDLE *shutdown_events;
+    int size;
+
+    TRACE("(%p %p)\n", this, event);
+
+    EnterCriticalSection(&this->cs);
+
+    size = this->shutdown_size ? this->shutdown_size * 2 : 1;
+    shutdown_events = MSVCRT_operator_new(size * sizeof(*shutdown_events));
+    memcpy(shutdown_events, this->shutdown_events,
+            this->shutdown_count * sizeof(*shutdown_events));
+    MSVCRT_operator_delete(this->shutdown_events);
+    this->shutdown_size = size;
+    this->shutdown_events = shutdown_events;
+    this->shutdown_events[this->shutdown_count++] = event;
+
+    LeaveCriticalSection(&this->cs);
+}
+
+DEFINE_THISCALL_WRAPPER(ThreadScheduler_Attach, 4)
+void __thiscall ThreadScheduler_Attach(ThreadScheduler *this)
+{
+    ExternalContextBase *context = get_current_context();
+
+    TRACE("(%p)\n", this);
+
+    if(context->scheduler.scheduler == &this->scheduler) {
+        FIXME("throw improper_scheduler_attach exception\n");
+        return;
+    }
+
+    if(context->scheduler.scheduler) {
+        struct scheduler_list *l = MSVCRT_operator_new(sizeof(*l));
+        *l = context->scheduler;
+        context->scheduler.next = l;
+    }
+    context->scheduler.scheduler = &this->scheduler;
+    ThreadScheduler_Reference(this);
+}
+
+static ScheduleGroupBase* ScheduleGroupBase_ctor(ScheduleGroupBase *this, ThreadScheduler *scheduler)
+{
+    static LONG group_id = -1;
+
+    TRACE("(%p %p)\n", this, scheduler);
+
+    this->group.vtable = &MSVCRT_ScheduleGroupBase_vtable;
+    this->ref = 1;
+    this->id = InterlockedIncrement(&group_id);
+    this->scheduler = scheduler;
+    ThreadScheduler_Reference(scheduler);
+    return this;
+}
+
+DEFINE_THISCALL_WRAPPER(ThreadScheduler_CreateScheduleGroup_loc, 8)
+ScheduleGroup* __thiscall ThreadScheduler_CreateScheduleGroup_loc(
+        ThreadScheduler *this, /*location*/void *placement)
+{
+    ScheduleGroupBase *group;
+
+    TRACE("(%p %p)\n", this, placement);
+
+    group = MSVCRT_operator_new(sizeof(*group));
+    return &ScheduleGroupBase_ctor(group, this)->group;
+}
+
+DEFINE_THISCALL_WRAPPER(ThreadScheduler_CreateScheduleGroup, 4)
+ScheduleGroup* __thiscall ThreadScheduler_CreateScheduleGroup(ThreadScheduler *this)
+{
+    TRACE("(%p)\n", this);
+    return ThreadScheduler_CreateScheduleGroup_loc(this, NULL);
+}
+
+DEFINE_THISCALL_WRAPPER(ThreadScheduler_ScheduleTask_loc, 16)
+void __thiscall ThreadScheduler_ScheduleTask_loc(ThreadScheduler *this,
+        void (__cdecl *proc)(void*), void* data, /*location*/void *placement)
+{
+    TRACE("(%p %p %p %p)\n", this, proc, data, placement);
+    scheduler_push_task(this, proc, data, NULL);
+}
+
+DEFINE_THISCALL_WRAPPER(ThreadScheduler_ScheduleTask, 12)
+void __thiscall ThreadScheduler_ScheduleTask(ThreadScheduler *this,
+        void (__cdecl *proc)(void*), void* data)
+{
+    TRACE("(%p %p %p)\n", this, proc, data);
+    scheduler_push_task(this, proc, data, NULL);
+}
+
+DEFINE_THISCALL_WRAPPER(ThreadScheduler_IsAvailableLocation, 8)
+MSVCRT_bool __thiscall ThreadScheduler_IsAvailableLocation(
+        const ThreadScheduler *this, const /*location*/void *placement)
+{
+    FIXME("(%p %p) stub\n", this, placement);
+    return FALSE;
+}
+
+DEFINE_THISCALL_WRAPPER(ThreadScheduler_vector_dtor, 8)
+Scheduler* __thiscall ThreadScheduler_vector_dtor(ThreadScheduler *this, unsigned int flags)
+{
+    TRACE("(%p %x)\n", this, flags);
+    if(flags & 2) {
+        /* we have an array, with the number of elements stored before the first object */
+        INT_PTR i, *ptr = (INT_PTR *)this-1;
+
+        for(i=*ptr-1; i>=0; i--)
+            ThreadScheduler_dtor(this+i);
+        MSVCRT_operator_delete(ptr);
+    } else {
+        ThreadScheduler_dtor(this);
+        if(flags & 1)
+            MSVCRT_operator_delete(this);
+    }
+
+    return &this->scheduler;
+}
+
+DEFINE_THISCALL_WRAPPER(ScheduleGroupBase_ScheduleTask, 12)
+void __thiscall ScheduleGroupBase_ScheduleTask(ScheduleGroupBase *this,
+        void (__cdecl *proc)(void*), void* data)
+{
+    TRACE("(%p %p %p)\n", this, proc, data);
+    scheduler_push_task(this->scheduler, proc, data, this);
+}
+
+DEFINE_THISCALL_WRAPPER(ScheduleGroupBase_Id, 4)
+unsigned int __thiscall ScheduleGroupBase_Id(const ScheduleGroupBase *this)
+{
+    TRACE("(%p)\n", this);
+    return this->id;
+}
+
+DEFINE_THISCALL_WRAPPER(ScheduleGroupBase_Reference, 4)
+unsigned int __thiscall ScheduleGroupBase_Reference(ScheduleGroupBase *this)
+{
+    TRACE("(%p)\n", this);
+    return InterlockedIncrement(&this->ref);
+}
+
+DEFINE_THISCALL_WRAPPER(ScheduleGroupBase_Release, 4)
+unsigned int __thiscall ScheduleGroupBase_Release(ScheduleGroupBase *this)
+{
+    unsigned int ret = InterlockedDecrement(&this->ref);
+
+    TRACE("(%p)\n", this);
+
+    if(!ret) {
+        ThreadScheduler_Release(this->scheduler);
+        MSVCRT_operator_delete(this);
+    }
+    return ret;
+}
+
+DEFINE_THISCALL_WRAPPER(ScheduleGroupBase_vector_dtor, 8)
+ScheduleGroup* __thiscall ScheduleGroupBase_vector_dtor(ScheduleGroupBase *this, unsigned int flags)
+{
+    TRACE("(%p %x)\n", this, flags);
+    if(flags & 2) {
+        /* we have an array, with the number of elements stored before the first object */
+        INT_PTR i, *ptr = (INT_PTR *)this-1;
+
+        for(i=*ptr-1; i>=0; i--)
+            ThreadScheduler_Release(this[i].scheduler);
+        MSVCRT_operator_delete(ptr);
+    } else {
+        ThreadScheduler_Release(this->scheduler);
+        if(flags & 1)
+            MSVCRT_operator_delete(this);
+    }
+
+    return &this->group;
+}
+
+/* ?Create@Scheduler@Concurrency@@SAPAV12@ABVSchedulerPolicy@2@@Z */
+/* ?Create@Scheduler@Concurrency@@SAPEAV12@AEBVSchedulerPolicy@2@@Z */
+Scheduler* __cdecl Scheduler_Create(const SchedulerPolicy *policy)
+{
+    ThreadScheduler *ret;
+
+    TRACE("(%p)\n", policy);
+
+    ret = MSVCRT_operator_new(sizeof(*ret));
+    return &ThreadScheduler_ctor(ret, policy)->scheduler;
+}
+
+/* ?ResetDefaultSchedulerPolicy@Scheduler@Concurrency@@SAXXZ */
+void __cdecl Scheduler_ResetDefaultSchedulerPolicy(void)
+{
+    TRACE("()\n");
+
+    EnterCriticalSection(&default_scheduler_cs);
+    if(default_scheduler_policy.policy_container)
+        SchedulerPolicy_dtor(&default_scheduler_policy);
+    SchedulerPolicy_ctor(&default_scheduler_policy);
+    LeaveCriticalSection(&default_scheduler_cs);
+}
+
+/* ?SetDefaultSchedulerPolicy@Scheduler@Concurrency@@SAXABVSchedulerPolicy@2@@Z */
+/* ?SetDefaultSchedulerPolicy@Scheduler@Concurrency@@SAXAEBVSchedulerPolicy@2@@Z */
+void __cdecl Scheduler_SetDefaultSchedulerPolicy(const SchedulerPolicy *policy)
+{
+    TRACE("(%p)\n", policy);
+
+    EnterCriticalSection(&default_scheduler_cs);
+    if(!default_scheduler_policy.policy_container)
+        SchedulerPolicy_copy_ctor(&default_scheduler_policy, policy);
+    else
+        SchedulerPolicy_op_assign(&default_scheduler_policy, policy);
+    LeaveCriticalSection(&default_scheduler_cs);
+}
+
+static ThreadScheduler* get_default_scheduler(void)
+{
+    if(default_scheduler)
+        return default_scheduler;
+
+    EnterCriticalSection(&default_scheduler_cs);
+    if(!default_scheduler) {
+        ThreadScheduler *scheduler;
+
+        if(!default_scheduler_policy.policy_container)
+            SchedulerPolicy_ctor(&default_scheduler_policy);
+
+        scheduler = MSVCRT_operator_new(sizeof(*scheduler));
+        ThreadScheduler_ctor(scheduler, &default_scheduler_policy);
+        default_scheduler = scheduler;
+    }
+    LeaveCriticalSection(&default_scheduler_cs);
+    return default_scheduler;
+}
+
+static ThreadScheduler* get_current_scheduler(void)
+{
+    ExternalContextBase *context = get_current_context();
+
+    if(context->scheduler.scheduler)
+        return (ThreadScheduler*)context->scheduler.scheduler;
+    return get_default_scheduler();
+}
+
+/* ?Create@CurrentScheduler@Concurrency@@SAXABVSchedulerPolicy@2@@Z */
+/* ?Create@CurrentScheduler@Concurrency@@SAXAEBVSchedulerPolicy@2@@Z */
+void __cdecl CurrentScheduler_Create(const SchedulerPolicy *policy)
+{
+    ThreadScheduler *scheduler;
+
+    TRACE("(%p)\n", policy);
+
+    scheduler = (ThreadScheduler*)Scheduler_Create(policy);
+    ThreadScheduler_Attach(scheduler);
+    ThreadScheduler_Release(scheduler);
+}
+
+/* ?Detach@CurrentScheduler@Concurrency@@SAXXZ */
+void __cdecl CurrentScheduler_Detach(void)
+{
+    ExternalContextBase *context = try_get_current_context();
+
+    TRACE("()\n");
+
+    if(!context || !context->scheduler.scheduler ||
+            (context->worker && !context->scheduler.next)) {
+        FIXME("throw improper_scheduler_detach exception\n");
+        return;
+    }
+
+    ThreadScheduler_Release((ThreadScheduler*)context->scheduler.scheduler);
+    if(!context->scheduler.next) {
+        context->scheduler.scheduler = NULL;
+    }else {
+        struct scheduler_list *entry = context->scheduler.next;
+        context->scheduler.scheduler = entry->scheduler;
+        context->scheduler.next = entry->next;
+        MSVCRT_operator_delete(entry);
+    }
+}
+
+/* ?Get@CurrentScheduler@Concurrency@@SAPAVScheduler@2@XZ */
+/* ?Get@CurrentScheduler@Concurrency@@SAPEAVScheduler@2@XZ */
+Scheduler* __cdecl CurrentScheduler_Get(void)
+{
+    TRACE("()\n");
+    return &get_current_scheduler()->scheduler;
+}
+
+#if _MSVCR_VER > 100
+/* ?CreateScheduleGroup@CurrentScheduler@Concurrency@@SAPAVScheduleGroup@2@AAVlocation@2@@Z */
+/* ?CreateScheduleGroup@CurrentScheduler@Concurrency@@SAPEAVScheduleGroup@2@AEAVlocation@2@@Z */
+ScheduleGroup* __cdecl CurrentScheduler_CreateScheduleGroup_loc(/*location*/void *placement)
+{
+    TRACE("(%p)\n", placement);
+    return ThreadScheduler_CreateScheduleGroup_loc(get_current_scheduler(), placement);
+}
+#endif
+
+/* ?CreateScheduleGroup@CurrentScheduler@Concurrency@@SAPAVScheduleGroup@2@XZ */
+/* ?CreateScheduleGroup@CurrentScheduler@Concurrency@@SAPEAVScheduleGroup@2@XZ */
+ScheduleGroup* __cdecl CurrentScheduler_CreateScheduleGroup(void)
+{
+    TRACE("()\n");
+    return ThreadScheduler_CreateScheduleGroup(get_current_scheduler());
+}
+
+/* ?GetNumberOfVirtualProcessors@CurrentScheduler@Concurrency@@SAIXZ */
+unsigned int __cdecl CurrentScheduler_GetNumberOfVirtualProcessors(void)
+{
+    ExternalContextBase *context = try_get_current_context();
+
+    TRACE("()\n");
+
+    if(!context || !context->scheduler.scheduler)
+        return -1;
+    return ThreadScheduler_GetNumberOfVirtualProcessors((ThreadScheduler*)context->scheduler.scheduler);
+}
+
+/* ?GetPolicy@CurrentScheduler@Concurrency@@SA?AVSchedulerPolicy@2@XZ */
+SchedulerPolicy* __cdecl CurrentScheduler_GetPolicy(SchedulerPolicy *policy)
+{
+    TRACE("(%p)\n", policy);
+    return ThreadScheduler_GetPolicy(get_current_scheduler(), policy);
+}
+
+/* ?Id@CurrentScheduler@Concurrency@@SAIXZ */
+unsigned int __cdecl CurrentScheduler_Id(void)
+{
+    ExternalContextBase *context = try_get_current_context();
+
+    TRACE("()\n");
+
+    if(!context || !context->scheduler.scheduler)
+        return -1;
+    return ThreadScheduler_Id((ThreadScheduler*)context->scheduler.scheduler);
+}
+
+#if _MSVCR_VER > 100
+/* ?IsAvailableLocation@CurrentScheduler@Concurrency@@SA_NABVlocation@2@@Z */
+/* ?IsAvailableLocation@CurrentScheduler@Concurrency@@SA_NAEBVlocation@2@@Z */
+MSVCRT_bool __cdecl CurrentScheduler_IsAvailableLocation(const /*location*/void *placement)
+{
+    ExternalContextBase *context = try_get_current_context();
+
+    TRACE("(%p)\n", placement);
+
+    if(!context || !context->scheduler.scheduler)
+        return FALSE;
+    return ThreadScheduler_IsAvailableLocation((ThreadScheduler*)context->scheduler.scheduler, placement);
+}
+#endif
+
+/* ?RegisterShutdownEvent@CurrentScheduler@Concurrency@@SAXPAX@Z */
+/* ?RegisterShutdownEvent@CurrentScheduler@Concurrency@@SAXPEAX@Z */
+void __cdecl CurrentScheduler_RegisterShutdownEvent(HANDLE event)
+{
+    ExternalContextBase *context = try_get_current_context();
+
+    TRACE("(%p)\n", event);
+
+    if(!context || !context->scheduler.scheduler) {
+        FIXME("throw scheduler_not_attached exception\n");
+        return;
+    }
+    ThreadScheduler_RegisterShutdownEvent((ThreadScheduler*)context->scheduler.scheduler, event);
+}
+
+#if _MSVCR_VER > 100
+/* ?ScheduleTask@CurrentScheduler@Concurrency@@SAXP6AXPAX@Z0AAVlocation@2@@Z */
+/* ?ScheduleTask@CurrentScheduler@Concurrency@@SAXP6AXPEAX@Z0AEAVlocation@2@@Z */
+void __cdecl CurrentScheduler_ScheduleTask_loc(void (__cdecl *proc)(void*),
+        void *data, /*location*/void *placement)
+{
+    TRACE("(%p %p %p)\n", proc, data, placement);
+    ThreadScheduler_ScheduleTask_loc(get_current_scheduler(), proc, data, placement);
+}
+#endif
+
+/* ?ScheduleTask@CurrentScheduler@Concurrency@@SAXP6AXPAX@Z0@Z */
+/* ?ScheduleTask@CurrentScheduler@Concurrency@@SAXP6AXPEAX@Z0@Z */
+void __cdecl CurrentScheduler_ScheduleTask(void (__cdecl *proc)(void*), void *data)
+{
+    TRACE("(%p %p)\n", proc, data);
+    ThreadScheduler_ScheduleTask(get_current_scheduler(), proc, data);
+}
+
+#if _MSVCR_VER >= 110
+/* ??0_Scheduler@details@Concurrency@@QAE@PAVScheduler@2@@Z */
+/* ??0_Scheduler@details@Concurrency@@QEAA@PEAVScheduler@2@@Z */
+DEFINE_THISCALL_WRAPPER(_Scheduler_ctor_sched, 8)
+_Scheduler* __thiscall _Scheduler_ctor_sched(_Scheduler *this, Scheduler *scheduler)
+{
+    TRACE("(%p %p)\n", this, scheduler);
+    this->scheduler = scheduler;
+    return this;
+}
+
+/* ??_F_Scheduler@details@Concurrency@@QAEXXZ */
+/* ??_F_Scheduler@details@Concurrency@@QEAAXXZ */
+DEFINE_THISCALL_WRAPPER(_Scheduler_ctor, 4)
+_Scheduler* __thiscall _Scheduler_ctor(_Scheduler *this)
+{
+    return _Scheduler_ctor_sched(this, NULL);
+}
+
+/* ?_GetScheduler@_Scheduler@details@Concurrency@@QAEPAVScheduler@3@XZ */
+/* ?_GetScheduler@_Scheduler@details@Concurrency@@QEAAPEAVScheduler@3@XZ */
+DEFINE_THISCALL_WRAPPER(_Scheduler__GetScheduler, 4)
+Scheduler* __thiscall _Scheduler__GetScheduler(_Scheduler *this)
+{
+    TRACE("(%p)\n", this);
+    return this->scheduler;
+}
+
+/* ?_Reference@_Scheduler@details@Concurrency@@QAEIXZ */
+/* ?_Reference@_Scheduler@details@Concurrency@@QEAAIXZ */
+DEFINE_THISCALL_WRAPPER(_Scheduler__Reference, 4)
+unsigned int __thiscall _Scheduler__Reference(_Scheduler *this)
+{
+    TRACE("(%p)\n", this);
+    return ThreadScheduler_Reference((ThreadScheduler*)this->scheduler);
+}
+
+/* ?_Release@_Scheduler@details@Concurrency@@QAEIXZ */
+/* ?_Release@_Scheduler@details@Concurrency@@QEAAIXZ */
+DEFINE_THISCALL_WRAPPER(_Scheduler__Release, 4)
+unsigned int __thiscall _Scheduler__Release(_Scheduler *this)
+{
+    TRACE("(%p)\n", this);
+    return ThreadScheduler_Release((ThreadScheduler*)this->scheduler);
+}
+
+/* ?_Get@_CurrentScheduler@details@Concurrency@@SA?AV_Scheduler@23@XZ */
+_Scheduler* __cdecl _CurrentScheduler__Get(_Scheduler *ret)
+{
+    TRACE("()\n");
+    return _Scheduler_ctor_sched(ret, CurrentScheduler_Get());
+}
+
+/* ?_GetNumberOfVirtualProcessors@_CurrentScheduler@details@Concurrency@@SAIXZ */
+unsigned int __cdecl _CurrentScheduler__GetNumberOfVirtualProcessors(void)
+{
+    TRACE("()\n");
+    return ThreadScheduler_GetNumberOfVirtualProcessors(get_current_scheduler());
+}
+
+/* ?_Id@_CurrentScheduler@details@Concurrency@@SAIXZ */
+unsigned int __cdecl _CurrentScheduler__Id(void)
+{
+    TRACE("()\n");
+    return ThreadScheduler_Id(get_current_scheduler());
+}
+
+/* ?_ScheduleTask@_CurrentScheduler@details@Concurrency@@SAXP6AXPAX@Z0@Z */
+/* ?_ScheduleTask@_CurrentScheduler@details@Concurrency@@SAXP6AXPEAX@Z0@Z */
+void __cdecl _CurrentScheduler__ScheduleTask(void (__cdecl *proc)(void*), void *data)
+{
+    TRACE("(%p %p)\n", proc, data);
+    CurrentScheduler_ScheduleTask(proc, data);
+}
+#endif
+
+static void task_collection_init(_StructuredTaskCollection *this)
+{
+    /* one reference is owned by the thread waiting for the collection */
+    if(this->finished == FINISHED_INITIAL) {
+        this->waiter = NULL;
+        this->canceled = FALSE;
+        this->count = 1;
+        this->finished = 0;
+    }
+}
+
+static void task_collection_chore_done(_StructuredTaskCollection *this)
+{
+    /* the collection may be gone as soon as the counter drops to zero,
+     * except for the final decrement which has to wake the waiter */
+    if(!InterlockedDecrement(&this->count))
+        context_unblock(this->waiter);
+}
+
+static void run_chore(_UnrealizedChore *chore, ExternalContextBase *context)
+{
+    _StructuredTaskCollection *prev = context->task_collection;
+
+    context->task_collection = chore->task_collection;
+    if(!chore->task_collection->canceled)
+        chore->chore_proc(chore);
+    context->task_collection = prev;
+}
+
+static void __cdecl execute_chore(void *data)
+{
+    _UnrealizedChore *chore = data;
+    _StructuredTaskCollection *collection = chore->task_collection;
+
+    /* FIXME: exceptions thrown by the chore are not transferred to the waiting thread */
+    run_chore(chore, get_current_context());
+    if(chore->runtime_owns_lifetime)
+        call__UnrealizedChore_dtor(chore);
+    task_collection_chore_done(collection);
+}
+
+static void task_collection_schedule(_StructuredTaskCollection *this, _UnrealizedChore *chore)
+{
+    task_collection_init(this);
+    if(!this->context)
+        this->context = &get_current_context()->context;
+
+    chore->task_collection = this;
+    chore->chore_wrapper = execute_chore;
+    InterlockedIncrement(&this->count);
+    scheduler_push_task(get_current_scheduler(), execute_chore, chore, NULL);
+}
+
+static _TaskCollectionStatus task_collection_run_and_wait(
+        _StructuredTaskCollection *this, _UnrealizedChore *chore)
+{
+    ExternalContextBase *context = get_current_context();
+    ThreadScheduler *scheduler = get_current_scheduler();
+    _TaskCollectionStatus status;
+
+    task_collection_init(this);
+
+    if(chore) {
+        chore->task_collection = this;
+        run_chore(chore, context);
+    }
+
+    /* help running the queued tasks while the chores are not finished */
+    while(this->count > 1 && scheduler_run_task(scheduler, context));
+
+    this->waiter = context;
+    if(InterlockedDecrement(&this->count))
+        context_block(context);
+
+    status = this->canceled ? TASK_COLLECTION_CANCELLED : TASK_COLLECTION_SUCCESS;
+    this->finished = FINISHED_INITIAL;
+    this->count = 0;
+    return status;
+}
+
+#if _MSVCR_VER >= 110
+/* ??0_StructuredTaskCollection@details@Concurrency@@QAE@PAV_CancellationTokenState@12@@Z */
+/* ??0_StructuredTaskCollection@details@Concurrency@@QEAA@PEAV_CancellationTokenState@12@@Z */
+DEFINE_THISCALL_WRAPPER(_StructuredTaskCollection_ctor, 8)
+_StructuredTaskCollection* __thiscall _StructuredTaskCollection_ctor(
+        _StructuredTaskCollection *this, /*_CancellationTokenState*/void *token)
+{
+    TRACE("(%p %p)\n", this, token);
+
+    if(token)
+        FIXME("_StructuredTaskCollection with cancellation token not implemented!\n");
+
+    memset(this, 0, sizeof(*this));
+    this->finished = FINISHED_INITIAL;
+    return this;
+}
+#endif
+
+/* ?_Schedule@_StructuredTaskCollection@details@Concurrency@@QAEXPAV_UnrealizedChore@23@@Z */
+/* ?_Schedule@_StructuredTaskCollection@details@Concurrency@@QEAAXPEAV_UnrealizedChore@23@@Z */
+DEFINE_THISCALL_WRAPPER(_StructuredTaskCollection__Schedule, 8)
+void __thiscall _StructuredTaskCollection__Schedule(
+        _StructuredTaskCollection *this, _UnrealizedChore *chore)
+{
+    TRACE("(%p %p)\n", this, chore);
+    task_collection_schedule(this, chore);
+}
+
+#if _MSVCR_VER >= 110
+/* ?_Schedule@_StructuredTaskCollection@details@Concurrency@@QAEXPAV_UnrealizedChore@23@PAVlocation@3@@Z */
+/* ?_Schedule@_StructuredTaskCollection@details@Concurrency@@QEAAXPEAV_UnrealizedChore@23@PEAVlocation@3@@Z */
+DEFINE_THISCALL_WRAPPER(_StructuredTaskCollection__Schedule_loc, 12)
+void __thiscall _StructuredTaskCollection__Schedule_loc(
+        _StructuredTaskCollection *this, _UnrealizedChore *chore,
+        /*location*/void *placement)
+{
+    TRACE("(%p %p %p)\n", this, chore, placement);
+    task_collection_schedule(this, chore);
+}
+#endif
+
+/* ?_RunAndWait@_StructuredTaskCollection@details@Concurrency@@QAG?AW4_TaskCollectionStatus@23@PAV_UnrealizedChore@23@@Z */
+/* ?_RunAndWait@_StructuredTaskCollection@details@Concurrency@@QEAA?AW4_TaskCollectionStatus@23@PEAV_UnrealizedChore@23@@Z */
+_TaskCollectionStatus __stdcall _StructuredTaskCollection__RunAndWait(
+        _StructuredTaskCollection *this, _UnrealizedChore *chore)
+{
+    TRACE("(%p %p)\n", this, chore);
+    return task_collection_run_and_wait(this, chore);
+}
+
+/* ?_Cancel@_StructuredTaskCollection@details@Concurrency@@QAEXXZ */
+/* ?_Cancel@_StructuredTaskCollection@details@Concurrency@@QEAAXXZ */
+DEFINE_THISCALL_WRAPPER(_StructuredTaskCollection__Cancel, 4)
+void __thiscall _StructuredTaskCollection__Cancel(_StructuredTaskCollection *this)
+{
+    TRACE("(%p)\n", this);
+    task_collection_init(this);
+    this->canceled = TRUE;
+}
+
+/* ?_IsCanceling@_StructuredTaskCollection@details@Concurrency@@QAE_NXZ */
+/* ?_IsCanceling@_StructuredTaskCollection@details@Concurrency@@QEAA_NXZ */
+DEFINE_THISCALL_WRAPPER(_StructuredTaskCollection__IsCanceling, 4)
+MSVCRT_bool __thiscall _StructuredTaskCollection__IsCanceling(_StructuredTaskCollection *this)
+{
+    TRACE("(%p)\n", this);
+    return this->finished != FINISHED_INITIAL && this->canceled;
+}
+
+/* ?_Abort@_StructuredTaskCollection@details@Concurrency@@AAEXXZ */
+/* ?_Abort@_StructuredTaskCollection@details@Concurrency@@AEAAXXZ */
+DEFINE_THISCALL_WRAPPER(_StructuredTaskCollection__Abort, 4)
+void __thiscall _StructuredTaskCollection__Abort(_StructuredTaskCollection *this)
+{
+    TRACE("(%p)\n", this);
+    if(this->finished == FINISHED_INITIAL)
+        return;
+    _StructuredTaskCollection__Cancel(this);
+    task_collection_run_and_wait(this, NULL);
+}
+
+#if _MSVCR_VER >= 120
+/* ??1_StructuredTaskCollection@details@Concurrency@@QAE@XZ */
+/* ??1_StructuredTaskCollection@details@Concurrency@@QEAA@XZ */
+DEFINE_THISCALL_WRAPPER(_StructuredTaskCollection_dtor, 4)
+void __thiscall _StructuredTaskCollection_dtor(_StructuredTaskCollection *this)
+{
+    TRACE("(%p)\n", this);
+
+    if(this->finished != FINISHED_INITIAL) {
+        FIXME("throw missing_wait exception\n");
+        _StructuredTaskCollection__Abort(this);
+    }
+}
+#endif
+
+/* ??0_TaskCollection@details@Concurrency@@QAE@XZ */
+/* ??0_TaskCollection@details@Concurrency@@QEAA@XZ */
+DEFINE_THISCALL_WRAPPER(_TaskCollection_ctor, 4)
+_TaskCollection* __thiscall _TaskCollection_ctor(_TaskCollection *this)
+{
+    TRACE("(%p)\n", this);
+
+    memset(this, 0, sizeof(*this));
+    this->finished = FINISHED_INITIAL;
+    return this;
+}
+
+#if _MSVCR_VER >= 110
+/* ??0_TaskCollection@details@Concurrency@@QAE@PAV_CancellationTokenState@12@@Z */
+/* ??0_TaskCollection@details@Concurrency@@QEAA@PEAV_CancellationTokenState@12@@Z */
+DEFINE_THISCALL_WRAPPER(_TaskCollection_ctor_token, 8)
+_TaskCollection* __thiscall _TaskCollection_ctor_token(_TaskCollection *this,
+        /*_CancellationTokenState*/void *token)
+{
+    TRACE("(%p %p)\n", this, token);
+
+    if(token)
+        FIXME("_TaskCollection with cancellation token not implemented!\n");
+    return _TaskCollection_ctor(this);
+}
+#endif
+
+/* ??1_TaskCollection@details@Concurrency@@QAE@XZ */
+/* ??1_TaskCollection@details@Concurrency@@QEAA@XZ */
+DEFINE_THISCALL_WRAPPER(_TaskCollection_dtor, 4)
+void __thiscall _TaskCollection_dtor(_TaskCollection *this)
+{
+    TRACE("(%p)\n", this);
+
+    /* chores still running reference the collection */
+    if(this->finished != FINISHED_INITIAL)
+        task_collection_run_and_wait(this, NULL);
+}
+
+/* ?_Schedule@_TaskCollection@details@Concurrency@@QAEXPAV_UnrealizedChore@23@@Z */
+/* ?_Schedule@_TaskCollection@details@Concurrency@@QEAAXPEAV_UnrealizedChore@23@@Z */
+DEFINE_THISCALL_WRAPPER(_TaskCollection__Schedule, 8)
+void __thiscall _TaskCollection__Schedule(_TaskCollection *this, _UnrealizedChore *chore)
+{
+    TRACE("(%p %p)\n", this, chore);
+    task_collection_schedule(this, chore);
+}
+
+#if _MSVCR_VER >= 110
+/* ?_Schedule@_TaskCollection@details@Concurrency@@QAEXPAV_UnrealizedChore@23@PAVlocation@3@@Z */
+/* ?_Schedule@_TaskCollection@details@Concurrency@@QEAAXPEAV_UnrealizedChore@23@PEAVlocation@3@@Z */
+DEFINE_THISCALL_WRAPPER(_TaskCollection__Schedule_loc, 12)
+void __thiscall _TaskCollection__Schedule_loc(_TaskCollection *this,
+        _UnrealizedChore *chore, /*location*/void *placement)
+{
+    TRACE("(%p %p %p)\n", this, chore, placement);
+    task_collection_schedule(this, chore);
+}
+#endif
+
+/* ?_RunAndWait@_TaskCollection@details@Concurrency@@QAG?AW4_TaskCollectionStatus@23@PAV_UnrealizedChore@23@@Z */
+/* ?_RunAndWait@_TaskCollection@details@Concurrency@@QEAA?AW4_TaskCollectionStatus@23@PEAV_UnrealizedChore@23@@Z */
+_TaskCollectionStatus __stdcall _TaskCollection__RunAndWait(
+        _TaskCollection *this, _UnrealizedChore *chore)
+{
+    TRACE("(%p %p)\n", this, chore);
+    return task_collection_run_and_wait(this, chore);
+}
+
+/* ?_Cancel@_TaskCollection@details@Concurrency@@QAEXXZ */
+/* ?_Cancel@_TaskCollection@details@Concurrency@@QEAAXXZ */
+DEFINE_THISCALL_WRAPPER(_TaskCollection__Cancel, 4)
+void __thiscall _TaskCollection__Cancel(_TaskCollection *this)
+{
+    TRACE("(%p)\n", this);
+    _StructuredTaskCollection__Cancel(this);
+}
+
+/* ?_IsCanceling@_TaskCollection@details@Concurrency@@QAE_NXZ */
+/* ?_IsCanceling@_TaskCollection@details@Concurrency@@QEAA_NXZ */
+DEFINE_THISCALL_WRAPPER(_TaskCollection__IsCanceling, 4)
+MSVCRT_bool __thiscall _TaskCollection__IsCanceling(_TaskCollection *this)
+{
+    TRACE("(%p)\n", this);
+    return _StructuredTaskCollection__IsCanceling(this);
+}
+
+#ifndef __GNUC__
+void __asm_dummy_vtables(void) {
+#endif
+
+__ASM_VTABLE(ExternalContextBase,
+        VTABLE_ADD_FUNC(ExternalContextBase_GetId)
+        VTABLE_ADD_FUNC(ExternalContextBase_GetVirtualProcessorId)
+        VTABLE_ADD_FUNC(ExternalContextBase_GetScheduleGroupId)
+        VTABLE_ADD_FUNC(ExternalContextBase_Unblock)
+        VTABLE_ADD_FUNC(ExternalContextBase_IsSynchronouslyBlocked)
+        VTABLE_ADD_FUNC(ExternalContextBase_vector_dtor));
+__ASM_VTABLE(ThreadScheduler,
+        VTABLE_ADD_FUNC(ThreadScheduler_vector_dtor)
+        VTABLE_ADD_FUNC(ThreadScheduler_Id)
+        VTABLE_ADD_FUNC(ThreadScheduler_GetNumberOfVirtualProcessors)
+        VTABLE_ADD_FUNC(ThreadScheduler_GetPolicy)
+        VTABLE_ADD_FUNC(ThreadScheduler_Reference)
+        VTABLE_ADD_FUNC(ThreadScheduler_Release)
+        VTABLE_ADD_FUNC(ThreadScheduler_RegisterShutdownEvent)
+        VTABLE_ADD_FUNC(ThreadScheduler_Attach)
+#if _MSVCR_VER > 100
+        VTABLE_ADD_FUNC(ThreadScheduler_CreateScheduleGroup_loc)
+#endif
+        VTABLE_ADD_FUNC(ThreadScheduler_CreateScheduleGroup)
+#if _MSVCR_VER > 100
+        VTABLE_ADD_FUNC(ThreadScheduler_ScheduleTask_loc)
+#endif
+        VTABLE_ADD_FUNC(ThreadScheduler_ScheduleTask)
+#if _MSVCR_VER > 100
+        VTABLE_ADD_FUNC(ThreadScheduler_IsAvailableLocation)
+#endif
+        );
+__ASM_VTABLE(ScheduleGroupBase,
+        VTABLE_ADD_FUNC(ScheduleGroupBase_ScheduleTask)
+        VTABLE_ADD_FUNC(ScheduleGroupBase_Id)
+        VTABLE_ADD_FUNC(ScheduleGroupBase_Reference)
+        VTABLE_ADD_FUNC(ScheduleGroupBase_Release)
+        VTABLE_ADD_FUNC(ScheduleGroupBase_vector_dtor));
+
+#ifndef __GNUC__
+}
+#endif
+
+DEFINE_RTTI_DATA0(Context, 0, ".?AVContext@Concurrency@@")
+DEFINE_RTTI_DATA1(ContextBase, 0, &Context_rtti_base_descriptor, ".?AVContextBase@details@Concurrency@@")
+DEFINE_RTTI_DATA2(ExternalContextBase, 0, &ContextBase_rtti_base_descriptor,
+        &Context_rtti_base_descriptor, ".?AVExternalContextBase@details@Concurrency@@")
+DEFINE_RTTI_DATA0(Scheduler, 0, ".?AVScheduler@Concurrency@@")
+DEFINE_RTTI_DATA1(SchedulerBase, 0, &Scheduler_rtti_base_descriptor, ".?AVSchedulerBase@details@Concurrency@@")
+DEFINE_RTTI_DATA2(ThreadScheduler, 0, &SchedulerBase_rtti_base_descriptor,
+        &Scheduler_rtti_base_descriptor, ".?AVThreadScheduler@details@Concurrency@@")
+DEFINE_RTTI_DATA0(ScheduleGroup, 0, ".?AVScheduleGroup@Concurrency@@")
+DEFINE_RTTI_DATA1(ScheduleGroupBase, 0, &ScheduleGroup_rtti_base_descriptor,
+        ".?AVScheduleGroupBase@details@Concurrency@@")
+
+#endif /* _MSVCR_VER >= 100 */
+
+void msvcrt_init_scheduler(void *base)
+{
+#if _MSVCR_VER >= 100
+#ifdef __x86_64__
+    init_Context_rtti(base);
+    init_ContextBase_rtti(base);
+    init_ExternalContextBase_rtti(base);
+    init_Scheduler_rtti(base);
+    init_SchedulerBase_rtti(base);
+    init_ThreadScheduler_rtti(base);
+    init_ScheduleGroup_rtti(base);
+    init_ScheduleGroupBase_rtti(base);
+#endif
+#endif
+}
+
+void msvcrt_free_scheduler(void)
+{
+#if _MSVCR_VER >= 100
+    if (context_tls_index != TLS_OUT_OF_INDEXES)
+        TlsFree(context_tls_index);
+    if(default_scheduler_policy.policy_container)
+        SchedulerPolicy_dtor(&default_scheduler_policy);
+    if(default_scheduler) {
+        ThreadScheduler_dtor(default_scheduler);
+        MSVCRT_operator_delete(default_scheduler);
+    }
+#endif
+}
+
+void msvcrt_free_scheduler_thread(void)
+{
+#if _MSVCR_VER >= 100
+    ExternalContextBase *context = try_get_current_context();
+    if (!context) return;
+    ExternalContextBase_dtor(context);
+    MSVCRT_operator_delete(context);
+    TlsSetValue(context_tls_index, NULL);
+#endif
+}
@@ -32,10 +32,449 @@
 #include <errno.h>
 #include "msvcrt.h"
 #include "winnls.h"
+#include "wine/unicode.h"
 #include "wine/debug.h"
 
 WINE_DEFAULT_DEBUG_CHANNEL(msvcrt);
 
+#if (defined(__i386__) || defined(__x86_64__)) && \
+    (defined(__clang__) || __GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 9))
+#define HAVE_SIMD_STRING
+#include <immintrin.h>
+
+#define SSE2_FUNC __attribute__((target("sse2")))
+#define AVX2_FUNC __attribute__((target("avx2")))
+
+/* unaligned loads are only done when they can't cross into the next page */
+#define PAGE_CROSS(p, n) ((((UINT_PTR)(p)) & 0xfff) > 0x1000 - (n))
+
+static BOOL sse2_supported;
+static BOOL avx2_supported;
+
+static inline void do_cpuid(unsigned int ax, unsigned int cx, unsigned int *p)
+{
+#ifdef __i386__
+    __asm__ __volatile__( "pushl %%ebx\n\t"
+                          "cpuid\n\t"
+                          "movl %%ebx, %%esi\n\t"
+                          "popl %%ebx"
+                          : "=a" (p[0]), "=S" (p[1]), "=c" (p[2]), "=d" (p[3])
+                          : "0" (ax), "2" (cx) );
+#else
+    __asm__ __volatile__( "cpuid"
+                          : "=a" (p[0]), "=b" (p[1]), "=c" (p[2]), "=d" (p[3])
+                          : "0" (ax), "2" (cx) );
+#endif
+}
+
+static BOOL avx2_available(void)
+{
+    unsigned int regs[4], eax, edx;
+
+    do_cpuid(0, 0, regs);
+    if (regs[0] < 7) return FALSE;
+    do_cpuid(1, 0, regs);
+    /* OSXSAVE and AVX */
+    if ((regs[2] & (3 << 27)) != (3 << 27)) return FALSE;
+    /* xgetbv, the OS has to save the ymm registers */
+    __asm__ __volatile__( ".byte 0x0f,0x01,0xd0" : "=a" (eax), "=d" (edx) : "c" (0) );
+    if ((eax & 6) != 6) return FALSE;
+    do_cpuid(7, 0, regs);
+    return (regs[1] & (1 << 5)) != 0;
+}
+
+void msvcrt_init_string(void)
+{
+    sse2_supported = IsProcessorFeaturePresent( PF_XMMI64_INSTRUCTIONS_AVAILABLE );
+    avx2_supported = sse2_supported && avx2_available();
+    TRACE("sse2 %d avx2 %d\n", sse2_supported, avx2_supported);
+}
+
+/* The scanning functions only use aligned loads, an aligned block never
+ * crosses a page boundary so reading past the terminator is safe. */
+static MSVCRT_size_t SSE2_FUNC sse2_strnlen(const char *s, MSVCRT_size_t maxlen)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const char *p = (const char *)((UINT_PTR)s & ~15);
+    unsigned int mask;
+
+    mask = _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_load_si128((const __m128i *)p), zero));
+    mask &= ~0u << ((UINT_PTR)s & 15);
+    for (;;)
+    {
+        if (mask)
+            return min((MSVCRT_size_t)(p + __builtin_ctz(mask) - s), maxlen);
+        p += 16;
+        if ((MSVCRT_size_t)(p - s) >= maxlen) return maxlen;
+        mask = _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_load_si128((const __m128i *)p), zero));
+    }
+}
+
+static MSVCRT_size_t AVX2_FUNC avx2_strnlen(const char *s, MSVCRT_size_t maxlen)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    const char *p = (const char *)((UINT_PTR)s & ~31);
+    unsigned int mask;
+
+    mask = _mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_load_si256((const __m256i *)p), zero));
+    mask &= ~0u << ((UINT_PTR)s & 31);
+    for (;;)
+    {
+        if (mask)
+            return min((MSVCRT_size_t)(p + __builtin_ctz(mask) - s), maxlen);
+        p += 32;
+        if ((MSVCRT_size_t)(p - s) >= maxlen) return maxlen;
+        mask = _mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_load_si256((const __m256i *)p), zero));
+    }
+}
+
+/* wide strings have to be at least 2 bytes aligned */
+static MSVCRT_size_t SSE2_FUNC sse2_wcsnlen(const MSVCRT_wchar_t *s, MSVCRT_size_t maxlen)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const char *p = (const char *)((UINT_PTR)s & ~15);
+    unsigned int mask;
+
+    mask = _mm_movemask_epi8(_mm_cmpeq_epi16(_mm_load_si128((const __m128i *)p), zero));
+    mask &= ~0u << ((UINT_PTR)s & 15);
+    for (;;)
+    {
+        if (mask)
+            return min((MSVCRT_size_t)(p + __builtin_ctz(mask) - (const char *)s) / 2, maxlen);
+        p += 16;
+        if ((MSVCRT_size_t)(p - (const char *)s) / 2 >= maxlen) return maxlen;
+        mask = _mm_movemask_epi8(_mm_cmpeq_epi16(_mm_load_si128((const __m128i *)p), zero));
+    }
+}
+
+static MSVCRT_size_t AVX2_FUNC avx2_wcsnlen(const MSVCRT_wchar_t *s, MSVCRT_size_t maxlen)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    const char *p = (const char *)((UINT_PTR)s & ~31);
+    unsigned int mask;
+
+    mask = _mm256_movemask_epi8(_mm256_cmpeq_epi16(_mm256_load_si256((const __m256i *)p), zero));
+    mask &= ~0u << ((UINT_PTR)s & 31);
+    for (;;)
+    {
+        if (mask)
+            return min((MSVCRT_size_t)(p + __builtin_ctz(mask) - (const char *)s) / 2, maxlen);
+        p += 32;
+        if ((MSVCRT_size_t)(p - (const char *)s) / 2 >= maxlen) return maxlen;
+        mask = _mm256_movemask_epi8(_mm256_cmpeq_epi16(_mm256_load_si256((const __m256i *)p), zero));
+    }
+}
+
+static MSVCRT_wchar_t* SSE2_FUNC sse2_wcschr(const MSVCRT_wchar_t *s, MSVCRT_wchar_t ch)
+{
+    const __m128i zero = _mm_setzero_si128(), c = _mm_set1_epi16(ch);
+    const char *p = (const char *)((UINT_PTR)s & ~15);
+    unsigned int mask;
+    __m128i v;
+
+    v = _mm_load_si128((const __m128i *)p);
+    mask = _mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi16(v, zero), _mm_cmpeq_epi16(v, c)));
+    mask &= ~0u << ((UINT_PTR)s & 15);
+    while (!mask)
+    {
+        p += 16;
+        v = _mm_load_si128((const __m128i *)p);
+        mask = _mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi16(v, zero), _mm_cmpeq_epi16(v, c)));
+    }
+    s = (const MSVCRT_wchar_t *)(p + __builtin_ctz(mask));
+    return *s == ch ? (MSVCRT_wchar_t *)s : NULL;
+}
+
+static MSVCRT_wchar_t* AVX2_FUNC avx2_wcschr(const MSVCRT_wchar_t *s, MSVCRT_wchar_t ch)
+{
+    const __m256i zero = _mm256_setzero_si256(), c = _mm256_set1_epi16(ch);
+    const char *p = (const char *)((UINT_PTR)s & ~31);
+    unsigned int mask;
+    __m256i v;
+
+    v = _mm256_load_si256((const __m256i *)p);
+    mask = _mm256_movemask_epi8(_mm256_or_si256(_mm256_cmpeq_epi16(v, zero), _mm256_cmpeq_epi16(v, c)));
+    mask &= ~0u << ((UINT_PTR)s & 31);
+    while (!mask)
+    {
+        p += 32;
+        v = _mm256_load_si256((const __m256i *)p);
+        mask = _mm256_movemask_epi8(_mm256_or_si256(_mm256_cmpeq_epi16(v, zero), _mm256_cmpeq_epi16(v, c)));
+    }
+    s = (const MSVCRT_wchar_t *)(p + __builtin_ctz(mask));
+    return *s == ch ? (MSVCRT_wchar_t *)s : NULL;
+}
+
+/* lower cases the ASCII letters, all other characters are left unchanged */
+static inline __m128i SSE2_FUNC sse2_tolower8(__m128i v)
+{
+    __m128i upper = _mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8('A' - 1)),
+                                  _mm_cmplt_epi8(v, _mm_set1_epi8('Z' + 1)));
+    return _mm_or_si128(v, _mm_and_si128(upper, _mm_set1_epi8(0x20)));
+}
+
+static inline __m128i SSE2_FUNC sse2_tolower16(__m128i v)
+{
+    __m128i upper = _mm_and_si128(_mm_cmpgt_epi16(v, _mm_set1_epi16('A' - 1)),
+                                  _mm_cmplt_epi16(v, _mm_set1_epi16('Z' + 1)));
+    return _mm_or_si128(v, _mm_and_si128(upper, _mm_set1_epi16(0x20)));
+}
+
+/* Returns the number of leading characters that are equal and not the
+ * terminator. When icase is set ASCII letters are compared case insensitively;
+ * the caller has to recheck the character at the returned position. */
+static MSVCRT_size_t SSE2_FUNC sse2_wcsprefix(const MSVCRT_wchar_t *s1, const MSVCRT_wchar_t *s2,
+        MSVCRT_size_t count, BOOL icase)
+{
+    const __m128i zero = _mm_setzero_si128();
+    MSVCRT_size_t i = 0;
+    unsigned int mask;
+    __m128i v1, v2;
+
+    while (count - i >= 8)
+    {
+        if (PAGE_CROSS(s1 + i, 16) || PAGE_CROSS(s2 + i, 16))
+        {
+            if (!s1[i] || s1[i] != s2[i]) return i;
+            i++;
+            continue;
+        }
+        v1 = _mm_loadu_si128((const __m128i *)(s1 + i));
+        v2 = _mm_loadu_si128((const __m128i *)(s2 + i));
+        mask = _mm_movemask_epi8(_mm_cmpeq_epi16(v1, zero));
+        if (icase)
+        {
+            v1 = sse2_tolower16(v1);
+            v2 = sse2_tolower16(v2);
+        }
+        mask |= ~_mm_movemask_epi8(_mm_cmpeq_epi16(v1, v2)) & 0xffff;
+        if (mask) return i + __builtin_ctz(mask) / 2;
+        i += 8;
+    }
+    return i;
+}
+
+/* Same as sse2_wcsprefix for bytes, when ascii is set the prefix also stops
+ * at the first non ASCII character. */
+static MSVCRT_size_t SSE2_FUNC sse2_strprefix(const char *s1, const char *s2,
+        MSVCRT_size_t count, BOOL icase, BOOL ascii)
+{
+    const __m128i zero = _mm_setzero_si128();
+    MSVCRT_size_t i = 0;
+    unsigned int mask;
+    __m128i v1, v2;
+
+    while (count - i >= 16)
+    {
+        if (PAGE_CROSS(s1 + i, 16) || PAGE_CROSS(s2 + i, 16))
+        {
+            if (!s1[i] || s1[i] != s2[i] || (ascii && (s1[i] & 0x80))) return i;
+            i++;
+            continue;
+        }
+        v1 = _mm_loadu_si128((const __m128i *)(s1 + i));
+        v2 = _mm_loadu_si128((const __m128i *)(s2 + i));
+        mask = _mm_movemask_epi8(_mm_cmpeq_epi8(v1, zero));
+        if (ascii) mask |= _mm_movemask_epi8(v1);
+        if (icase)
+        {
+            v1 = sse2_tolower8(v1);
+            v2 = sse2_tolower8(v2);
+        }
+        mask |= ~_mm_movemask_epi8(_mm_cmpeq_epi8(v1, v2)) & 0xffff;
+        if (mask) return i + __builtin_ctz(mask);
+        i += 16;
+    }
+    return i;
+}
+
+static MSVCRT_size_t SSE2_FUNC sse2_text_run(const char *buf, MSVCRT_size_t len, BOOL utf16)
+{
+    MSVCRT_size_t i;
+    unsigned int mask;
+    __m128i v;
+
+    for (i = 0; i + 16 <= len; i += 16)
+    {
+        v = _mm_loadu_si128((const __m128i *)(buf + i));
+        if (utf16)
+            mask = _mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi16(v, _mm_set1_epi16('\r')),
+                                                  _mm_cmpeq_epi16(v, _mm_set1_epi16(0x1a))));
+        else
+            mask = _mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8('\r')),
+                                                  _mm_cmpeq_epi8(v, _mm_set1_epi8(0x1a))));
+        if (mask) return i + __builtin_ctz(mask);
+    }
+    return i;
+}
+
+static MSVCRT_size_t SSE2_FUNC sse2_ascii_widen(MSVCRT_wchar_t *dst, const char *src, MSVCRT_size_t len)
+{
+    const __m128i zero = _mm_setzero_si128();
+    MSVCRT_size_t i;
+    __m128i v;
+
+    for (i = 0; i + 16 <= len; i += 16)
+    {
+        v = _mm_loadu_si128((const __m128i *)(src + i));
+        if (_mm_movemask_epi8(v)) break;
+        _mm_storeu_si128((__m128i *)(dst + i), _mm_unpacklo_epi8(v, zero));
+        _mm_storeu_si128((__m128i *)(dst + i + 8), _mm_unpackhi_epi8(v, zero));
+    }
+    return i;
+}
+#else
+void msvcrt_init_string(void)
+{
+}
+#endif
+
+/* The helpers below are used by the str*, wcs* and mbs* functions, they pick
+ * the vectorized implementation supported by the CPU. */
+MSVCRT_size_t msvcrt_strnlen(const char *s, MSVCRT_size_t maxlen)
+{
+    MSVCRT_size_t i;
+
+    if (!maxlen) return 0;
+#ifdef HAVE_SIMD_STRING
+    if (avx2_supported) return avx2_strnlen(s, maxlen);
+    if (sse2_supported) return sse2_strnlen(s, maxlen);
+#endif
+    for (i = 0; i < maxlen; i++)
+        if (!s[i]) break;
+    return i;
+}
+
+MSVCRT_size_t msvcrt_wcsnlen(const MSVCRT_wchar_t *s, MSVCRT_size_t maxlen)
+{
+    MSVCRT_size_t i;
+
+    if (!maxlen) return 0;
+#ifdef HAVE_SIMD_STRING
+    if (!((UINT_PTR)s & 1))
+    {
+        if (avx2_supported) return avx2_wcsnlen(s, maxlen);
+        if (sse2_supported) return sse2_wcsnlen(s, maxlen);
+    }
+#endif
+    for (i = 0; i < maxlen; i++)
+        if (!s[i]) break;
+    return i;
+}
+
+MSVCRT_wchar_t* msvcrt_wcschr(const MSVCRT_wchar_t *s, MSVCRT_wchar_t ch)
+{
+#ifdef HAVE_SIMD_STRING
+    if (!((UINT_PTR)s & 1))
+    {
+        if (avx2_supported) return avx2_wcschr(s, ch);
+        if (sse2_supported) return sse2_wcschr(s, ch);
+    }
+#endif
+    return strchrW(s, ch);
+}
+
+int msvcrt_wcsncmp(const MSVCRT_wchar_t *s1, const MSVCRT_wchar_t *s2, MSVCRT_size_t count, BOOL icase)
+{
+    int ret;
+
+    for (;;)
+    {
+#ifdef HAVE_SIMD_STRING
+        if (sse2_supported)
+        {
+            MSVCRT_size_t i = sse2_wcsprefix(s1, s2, count, icase);
+            s1 += i;
+            s2 += i;
+            count -= i;
+        }
+#endif
+        if (!count) return 0;
+        ret = icase ? tolowerW(*s1) - tolowerW(*s2) : *s1 - *s2;
+        if (ret || !*s1) return ret;
+        s1++;
+        s2++;
+        count--;
+    }
+}
+
+/* compares the strings in the C locale */
+int msvcrt_strncmp_ascii(const char *s1, const char *s2, MSVCRT_size_t count, BOOL icase)
+{
+    int c1, c2;
+
+    for (;;)
+    {
+#ifdef HAVE_SIMD_STRING
+        if (sse2_supported)
+        {
+            MSVCRT_size_t i = sse2_strprefix(s1, s2, count, icase, FALSE);
+            s1 += i;
+            s2 += i;
+            count -= i;
+        }
+#endif
+        if (!count) return 0;
+        c1 = (unsigned char)*s1++;
+        c2 = (unsigned char)*s2++;
+        if (icase)
+        {
+            if (c1 >= 'A' && c1 <= 'Z') c1 += 'a' - 'A';
+            if (c2 >= 'A' && c2 <= 'Z') c2 += 'a' - 'A';
+        }
+        if (c1 != c2 || !c1) return c1 - c2;
+        count--;
+    }
+}
+
+/* Returns the length of the common prefix made of ASCII characters, the
+ * position after it is a character boundary in all multibyte code pages. */
+MSVCRT_size_t msvcrt_ascii_prefix(const char *s1, const char *s2)
+{
+    MSVCRT_size_t i = 0;
+
+#ifdef HAVE_SIMD_STRING
+    if (sse2_supported) i = sse2_strprefix(s1, s2, ~(MSVCRT_size_t)0, FALSE, TRUE);
+#endif
+    while (s1[i] && s1[i] == s2[i] && !(s1[i] & 0x80)) i++;
+    return i;
+}
+
+/* Returns the length of the leading part of a text mode buffer that doesn't
+ * need the \r\n and ^Z handling. In UTF-16 mode len has to be even. */
+MSVCRT_size_t msvcrt_text_run(const char *buf, MSVCRT_size_t len, BOOL utf16)
+{
+    MSVCRT_size_t i = 0;
+
+#ifdef HAVE_SIMD_STRING
+    if (sse2_supported) i = sse2_text_run(buf, len, utf16);
+#endif
+    if (utf16)
+    {
+        for (; i < len; i += 2)
+            if ((buf[i] == '\r' || buf[i] == 0x1a) && !buf[i + 1]) break;
+    }
+    else
+    {
+        for (; i < len; i++)
+            if (buf[i] == '\r' || buf[i] == 0x1a) break;
+    }
+    return i;
+}
+
+/* Converts the leading ASCII characters, returns the number of converted bytes. */
+MSVCRT_size_t msvcrt_ascii_widen(MSVCRT_wchar_t *dst, const char *src, MSVCRT_size_t len)
+{
+    MSVCRT_size_t i = 0;
+
+#ifdef HAVE_SIMD_STRING
+    if (sse2_supported) i = sse2_ascii_widen(dst, src, len);
+#endif
+    for (; i < len && !(src[i] & 0x80); i++)
+        dst[i] = src[i];
+    return i;
+}
+
 /*********************************************************************
  *		_mbsdup (MSVCRT.@)
  *		_strdup (MSVCRT.@)
@@ -701,7 +1140,7 @@ char* __cdecl MSVCRT_strncpy(char *dst, const char *src, MSVCRT_size_t len)
  */
 int CDECL MSVCRT_strcpy_s( char* dst, MSVCRT_size_t elem, const char* src )
 {
-    MSVCRT_size_t i;
+    MSVCRT_size_t len;
     if(!elem) return MSVCRT_EINVAL;
     if(!dst) return MSVCRT_EINVAL;
     if(!src)
@@ -710,10 +1149,13 @@ int CDECL MSVCRT_strcpy_s( char* dst, MSVCRT_size_t elem, const char* src )
         return MSVCRT_EINVAL;
     }
 
-    for(i = 0; i < elem; i++)
+    len = msvcrt_strnlen(src, elem);
+    if(len < elem)
     {
-        if((dst[i] = src[i]) == '\0') return 0;
+        memcpy(dst, src, len + 1);
+        return 0;
     }
+    memcpy(dst, src, elem);
     dst[0] = '\0';
     return MSVCRT_ERANGE;
 }
@@ -723,7 +1165,7 @@ int CDECL MSVCRT_strcpy_s( char* dst, MSVCRT_size_t elem, const char* src )
  */
 int CDECL MSVCRT_strcat_s( char* dst, MSVCRT_size_t elem, const char* src )
 {
-    MSVCRT_size_t i, j;
+    MSVCRT_size_t i, len;
     if(!dst) return MSVCRT_EINVAL;
     if(elem == 0) return MSVCRT_EINVAL;
     if(!src)
@@ -732,15 +1174,16 @@ int CDECL MSVCRT_strcat_s( char* dst, MSVCRT_size_t elem, const char* src )
         return MSVCRT_EINVAL;
     }
 
-    for(i = 0; i < elem; i++)
+    i = msvcrt_strnlen(dst, elem);
+    if(i < elem)
     {
-        if(dst[i] == '\0')
+        len = msvcrt_strnlen(src, elem - i);
+        if(len < elem - i)
         {
-            for(j = 0; (j + i) < elem; j++)
-            {
-                if((dst[j + i] = src[j]) == '\0') return 0;
-            }
+            memcpy(dst + i, src, len + 1);
+            return 0;
         }
+        memcpy(dst + i, src, len);
     }
     /* Set the first element to 0, not the first element after the skipped part */
     dst[0] = '\0';
@@ -894,12 +1337,7 @@ MSVCRT_size_t __cdecl MSVCRT_strlen(const char *str)
  */
 MSVCRT_size_t CDECL MSVCRT_strnlen(const char *s, MSVCRT_size_t maxlen)
 {
-    MSVCRT_size_t i;
-
-    for(i=0; i<maxlen; i++)
-        if(!s[i]) break;
-
-    return i;
+    return msvcrt_strnlen(s, maxlen);
 }
 
 /*********************************************************************
@@ -1889,7 +2327,7 @@ int __cdecl MSVCRT__strnicmp_l(const char *s1, const char *s2,
         locinfo = locale->locinfo;
 
     if(!locinfo->lc_handle[MSVCRT_LC_CTYPE])
-        return strncasecmp(s1, s2, count);
+        return msvcrt_strncmp_ascii(s1, s2, count, TRUE);
 
     do {
         c1 = MSVCRT__tolower_l(*s1++, locale);
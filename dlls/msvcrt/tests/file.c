@@ -2327,6 +2327,207 @@ static void test_write_flush(void)
     free(tempf);
 }
 
+static int make_text(char *text, int size, int line_len)
+{
+    int len = 0, i = 0;
+
+    while (len < size - line_len - 2)
+    {
+        int n = i % line_len;
+
+        for (; n; n--, len++) text[len] = 'a' + (len + i) % 26;
+        if (i % 7 == 3) text[len++] = '\r';
+        if (i % 5) text[len++] = '\r';
+        text[len++] = '\n';
+        i++;
+    }
+    return len;
+}
+
+static void test_text_large(void)
+{
+    static const WCHAR wide_chars[] = {'a', 'b', 0xe9, 0x3042, ' ', 'z'};
+    char temppath[MAX_PATH], tempfile[MAX_PATH];
+    char *text, *expect, *buf;
+    WCHAR *wtext, *wexpect, *wbuf;
+    int len, exp_len, i, j, ret;
+    FILE *f;
+
+    GetTempPathA(MAX_PATH, temppath);
+    GetTempFileNameA(temppath, "", 0, tempfile);
+
+    text = malloc(0x20000);
+    expect = malloc(0x20000);
+    buf = malloc(0x20000);
+    len = make_text(text, 0x20000, 150);
+    for (i = 0, exp_len = 0; i < len; i++)
+        if (text[i] != '\r' || i + 1 == len || text[i + 1] != '\n') expect[exp_len++] = text[i];
+
+    f = fopen(tempfile, "wb");
+    ok(f != NULL, "can't open tempfile\n");
+    ok(fwrite(text, 1, len, f) == len, "fwrite failed\n");
+    fclose(f);
+
+    /* fgets with lines longer than the buffer */
+    f = fopen(tempfile, "rt");
+    ok(f != NULL, "can't open tempfile\n");
+    j = 0;
+    while (fgets(buf + j, 64, f))
+        j += strlen(buf + j);
+    ok(j == exp_len, "read %d bytes, expected %d\n", j, exp_len);
+    ok(!memcmp(buf, expect, exp_len), "fgets returned wrong data\n");
+    ok(feof(f), "feof not set\n");
+    fclose(f);
+
+    /* a buffer size set with setvbuf is kept */
+    f = fopen(tempfile, "rt");
+    ok(f != NULL, "can't open tempfile\n");
+    ok(!setvbuf(f, NULL, _IOFBF, 1024), "setvbuf failed\n");
+    j = 0;
+    while (fgets(buf + j, 64, f))
+        j += strlen(buf + j);
+    ok(j == exp_len, "read %d bytes, expected %d\n", j, exp_len);
+    ok(f->_bufsiz == 1024, "_bufsiz = %d\n", f->_bufsiz);
+    fclose(f);
+
+    /* alternating small and large reads */
+    f = fopen(tempfile, "rt");
+    ok(f != NULL, "can't open tempfile\n");
+    j = 0;
+    for (i = 0; (ret = fread(buf + j, 1, i % 2 ? 3000 : 100, f)); i++)
+        j += ret;
+    ok(j == exp_len, "read %d bytes, expected %d\n", j, exp_len);
+    ok(!memcmp(buf, expect, exp_len), "fread returned wrong data\n");
+    fclose(f);
+
+    /* text mode writes */
+    f = fopen(tempfile, "wt");
+    ok(f != NULL, "can't open tempfile\n");
+    ok(fwrite(expect, 1, exp_len, f) == exp_len, "fwrite failed\n");
+    fclose(f);
+    f = fopen(tempfile, "rb");
+    ok(f != NULL, "can't open tempfile\n");
+    ret = fread(buf, 1, 0x20000, f);
+    fclose(f);
+    for (i = 0, j = 0; i < exp_len; i++)
+    {
+        if (expect[i] == '\n') j += buf[j] == '\r';
+        if (buf[j++] != expect[i]) break;
+    }
+    ok(i == exp_len && j == ret, "fwrite wrote wrong data at %d\n", i);
+
+    if (!p_fopen_s)
+    {
+        win_skip("ccs is not supported\n");
+        free(text);
+        free(expect);
+        free(buf);
+        unlink(tempfile);
+        return;
+    }
+
+    wtext = malloc(0x40000);
+    wexpect = malloc(0x40000);
+    wbuf = malloc(0x40000);
+    wtext[0] = 0xfeff;
+    for (i = 0, len = 1; i < exp_len; i++)
+    {
+        if (expect[i] == '\n') wtext[len++] = '\r';
+        wtext[len++] = expect[i] == 'c' ? wide_chars[i % (sizeof(wide_chars)/sizeof(wide_chars[0]))] : expect[i];
+    }
+    for (i = 1, exp_len = 0; i < len; i++)
+        if (wtext[i] != '\r' || i + 1 == len || wtext[i + 1] != '\n') wexpect[exp_len++] = wtext[i];
+
+    f = fopen(tempfile, "wb");
+    ok(f != NULL, "can't open tempfile\n");
+    ok(fwrite(wtext, sizeof(WCHAR), len, f) == len, "fwrite failed\n");
+    fclose(f);
+
+    f = fopen(tempfile, "rt,ccs=unicode");
+    ok(f != NULL, "can't open tempfile\n");
+    j = 0;
+    while (fgetws(wbuf + j, 64, f))
+        j += lstrlenW(wbuf + j);
+    ok(j == exp_len, "read %d characters, expected %d\n", j, exp_len);
+    ok(!memcmp(wbuf, wexpect, exp_len * sizeof(WCHAR)), "fgetws returned wrong data\n");
+    fclose(f);
+
+    ret = WideCharToMultiByte(CP_UTF8, 0, wtext, len, buf, 0x20000, NULL, NULL);
+    ok(ret > 0, "utf-8 conversion failed\n");
+    f = fopen(tempfile, "wb");
+    ok(f != NULL, "can't open tempfile\n");
+    ok(fwrite(buf, 1, ret, f) == ret, "fwrite failed\n");
+    fclose(f);
+
+    f = fopen(tempfile, "rt, ccs=UTF-8");
+    ok(f != NULL, "can't open tempfile\n");
+    j = 0;
+    while (fgetws(wbuf + j, 64, f))
+        j += lstrlenW(wbuf + j);
+    ok(j == exp_len, "read %d characters, expected %d\n", j, exp_len);
+    ok(!memcmp(wbuf, wexpect, exp_len * sizeof(WCHAR)), "fgetws returned wrong data\n");
+    fclose(f);
+
+    free(text);
+    free(expect);
+    free(buf);
+    free(wtext);
+    free(wexpect);
+    free(wbuf);
+    unlink(tempfile);
+}
+
+static void benchmark_text(void)
+{
+    char temppath[MAX_PATH], tempfile[MAX_PATH];
+    char *text, line[256];
+    WCHAR wline[256];
+    DWORD start;
+    int i, len;
+    FILE *f;
+
+    GetTempPathA(MAX_PATH, temppath);
+    GetTempFileNameA(temppath, "", 0, tempfile);
+
+    text = malloc(0x100000);
+    len = make_text(text, 0x100000, 120);
+    f = fopen(tempfile, "wb");
+    for (i = 0; i < 32; i++)
+        fwrite(text, 1, len, f);
+    fclose(f);
+
+    start = GetTickCount();
+    f = fopen(tempfile, "rt");
+    while (fgets(line, sizeof(line), f));
+    fclose(f);
+    trace("fgets: %u ms for %u MB\n", GetTickCount() - start, 32 * len >> 20);
+
+    start = GetTickCount();
+    f = fopen(tempfile, "rt");
+    while (fread(text, 1, 0x10000, f));
+    fclose(f);
+    trace("fread: %u ms for %u MB\n", GetTickCount() - start, 32 * len >> 20);
+
+    if (p_fopen_s)
+    {
+        start = GetTickCount();
+        f = fopen(tempfile, "rt, ccs=UTF-8");
+        while (fgetws(wline, sizeof(wline)/sizeof(wline[0]), f));
+        fclose(f);
+        trace("fgetws (UTF-8): %u ms for %u MB\n", GetTickCount() - start, 32 * len >> 20);
+    }
+
+    start = GetTickCount();
+    f = fopen(tempfile, "wt");
+    for (i = 0; i < 32; i++)
+        fwrite(text, 1, len, f);
+    fclose(f);
+    trace("fwrite: %u ms for %u MB\n", GetTickCount() - start, 32 * len >> 20);
+
+    free(text);
+    unlink(tempfile);
+}
+
 static void test_close(void)
 {
     ioinfo *stdout_info, stdout_copy, *stderr_info, stderr_copy;
@@ -2453,6 +2654,9 @@ START_TEST(file)
     test__open_osfhandle();
     test_write_flush();
     test_close();
+    test_text_large();
+    if (winetest_interactive)
+        benchmark_text();
 
     /* Wait for the (_P_NOWAIT) spawned processes to finish to make sure the report
      * file contains lines in the correct order
@@ -18,9 +18,12 @@
  * Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301, USA
  */
 
+#include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <malloc.h>
 #include <errno.h>
+#include <process.h>
 #include "wine/test.h"
 
 static void (__cdecl *p_aligned_free)(void*) = NULL;
@@ -479,9 +482,187 @@ static void test_calloc(void)
     free(ptr);
 }
 
+static unsigned __stdcall heap_cache_free_thread(void *arg)
+{
+    void **blocks = arg;
+    int i;
+
+    for (i = 0; i < 256; i++)
+    {
+        ok(_msize(blocks[i]) == i, "_msize(%p) = %d, expected %d\n", blocks[i], (int)_msize(blocks[i]), i);
+        free(blocks[i]);
+    }
+    return 0;
+}
+
+static void test_heap_cache_child(void)
+{
+    struct _heapinfo hi;
+    void *blocks[256];
+    unsigned char *mem, *mem2;
+    HANDLE thread;
+    int i, ret, found;
+
+    for (i = 0; i < 600; i++)
+    {
+        mem = malloc(i);
+        ok(mem != NULL, "malloc(%d) failed\n", i);
+        ok(!((UINT_PTR)mem & (2*sizeof(void*)-1)), "incorrect alignment (%p)\n", mem);
+        ok(_msize(mem) == i, "_msize(%p) = %d, expected %d\n", mem, (int)_msize(mem), i);
+        memset(mem, 0xcc, i);
+        free(mem);
+    }
+
+    mem = calloc(1, 100);
+    ok(mem != NULL, "calloc failed\n");
+    for (i = 0; i < 100; i++)
+        if (mem[i]) break;
+    ok(i == 100, "memory not zeroed at %d\n", i);
+    for (i = 0; i < 100; i++) mem[i] = i;
+
+    mem2 = _expand(mem, 50);
+    ok(mem2 == mem, "_expand returned %p, expected %p\n", mem2, mem);
+    ok(_msize(mem) == 50, "_msize(%p) = %d\n", mem, (int)_msize(mem));
+
+    mem = realloc(mem, 1000);
+    ok(mem != NULL, "realloc failed\n");
+    ok(_msize(mem) == 1000, "_msize(%p) = %d\n", mem, (int)_msize(mem));
+    for (i = 0; i < 50; i++)
+        if (mem[i] != i) break;
+    ok(i == 50, "realloc didn't preserve data at %d\n", i);
+    mem = realloc(mem, 20);
+    ok(mem != NULL, "realloc failed\n");
+    for (i = 0; i < 20; i++)
+        if (mem[i] != i) break;
+    ok(i == 20, "realloc didn't preserve data at %d\n", i);
+
+    found = 0;
+    memset(&hi, 0, sizeof(hi));
+    while ((ret = _heapwalk(&hi)) == _HEAPOK)
+    {
+        if (hi._pentry != (int*)mem) continue;
+        ok(hi._useflag == _USEDENTRY, "_useflag = %d\n", hi._useflag);
+        ok(hi._size == 20, "_size = %d\n", (int)hi._size);
+        found++;
+    }
+    ok(ret == _HEAPEND, "_heapwalk returned %d\n", ret);
+    ok(found == 1, "block %p found %d times\n", mem, found);
+    free(mem);
+
+    /* blocks freed by another thread */
+    for (i = 0; i < 256; i++)
+        blocks[i] = malloc(i);
+    thread = (HANDLE)_beginthreadex(NULL, 0, heap_cache_free_thread, blocks, 0, NULL);
+    ok(thread != NULL, "_beginthreadex failed\n");
+    WaitForSingleObject(thread, INFINITE);
+    CloseHandle(thread);
+    for (i = 0; i < 256; i++)
+    {
+        blocks[i] = malloc(i);
+        ok(blocks[i] != NULL, "malloc(%d) failed\n", i);
+    }
+    for (i = 0; i < 256; i++)
+        free(blocks[i]);
+}
+
+#define BENCH_NODES 4096
+
+/* Mimics STL containers: node based containers allocate and free lots of
+ * small blocks while vectors and strings grow with realloc. */
+static unsigned __stdcall heap_bench_thread(void *arg)
+{
+    void **nodes = malloc(BENCH_NODES * sizeof(*nodes));
+    unsigned int i, j, seed = 1;
+    char *vec;
+
+    memset(nodes, 0, BENCH_NODES * sizeof(*nodes));
+    for (i = 0; i < 200; i++)
+    {
+        for (j = 0; j < BENCH_NODES; j++)
+        {
+            unsigned int k = (seed = seed * 1103515245 + 12345) % BENCH_NODES;
+            free(nodes[k]);
+            nodes[k] = malloc(16 + (seed >> 16) % 112);
+        }
+
+        vec = NULL;
+        for (j = 16; j <= 4096; j *= 2)
+            vec = realloc(vec, j);
+        free(vec);
+    }
+
+    for (j = 0; j < BENCH_NODES; j++)
+        free(nodes[j]);
+    free(nodes);
+    return 0;
+}
+
+static void benchmark_heap_child(void)
+{
+    HANDLE threads[4];
+    DWORD start;
+    int i;
+
+    start = GetTickCount();
+    heap_bench_thread(NULL);
+    trace("single thread: %u ms\n", GetTickCount() - start);
+
+    start = GetTickCount();
+    for (i = 0; i < sizeof(threads)/sizeof(*threads); i++)
+        threads[i] = (HANDLE)_beginthreadex(NULL, 0, heap_bench_thread, NULL, 0, NULL);
+    WaitForMultipleObjects(sizeof(threads)/sizeof(*threads), threads, TRUE, INFINITE);
+    trace("%d threads: %u ms\n", (int)(sizeof(threads)/sizeof(*threads)), GetTickCount() - start);
+    for (i = 0; i < sizeof(threads)/sizeof(*threads); i++)
+        CloseHandle(threads[i]);
+}
+
+static void run_child(const char *name, const char *test, const char *cache)
+{
+    char cmdline[MAX_PATH];
+    STARTUPINFOA startup;
+    PROCESS_INFORMATION proc;
+
+    SetEnvironmentVariableA("WINE_MSVCRT_HEAP_CACHE", cache);
+    sprintf(cmdline, "%s heap %s", name, test);
+    memset(&startup, 0, sizeof(startup));
+    startup.cb = sizeof(startup);
+    CreateProcessA(NULL, cmdline, NULL, NULL, TRUE, CREATE_DEFAULT_ERROR_MODE|NORMAL_PRIORITY_CLASS, NULL, NULL, &startup, &proc);
+    winetest_wait_child_process(proc.hProcess);
+    CloseHandle(proc.hProcess);
+    CloseHandle(proc.hThread);
+    SetEnvironmentVariableA("WINE_MSVCRT_HEAP_CACHE", NULL);
+}
+
+static void test_heap_cache(const char *name)
+{
+    run_child(name, "cache", "1");
+
+    if (winetest_interactive)
+    {
+        trace("heap cache disabled:\n");
+        run_child(name, "bench", NULL);
+        trace("heap cache enabled:\n");
+        run_child(name, "bench", "1");
+    }
+}
+
 START_TEST(heap)
 {
     void *mem;
+    int arg_c;
+    char **arg_v;
+
+    arg_c = winetest_get_mainargs(&arg_v);
+    if (arg_c >= 3)
+    {
+        if (!strcmp(arg_v[2], "cache"))
+            test_heap_cache_child();
+        else if (!strcmp(arg_v[2], "bench"))
+            benchmark_heap_child();
+        else
+            ok(0, "invalid argument '%s'\n", arg_v[2]);
+        return;
+    }
 
     mem = malloc(0);
     ok(mem != NULL, "memory not allocated for size 0\n");
@@ -504,4 +685,5 @@ START_TEST(heap)
     test_aligned();
     test_sbheap();
     test_calloc();
+    test_heap_cache(arg_v[0]);
 }
@@ -26,6 +26,8 @@
 #define _CRT_NON_CONFORMING_SWPRINTFS
  
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 #include <errno.h>
 
 #include "windef.h"
@@ -1450,6 +1452,162 @@ static void test_vsprintf_p(void)
     /* ret = _vsprintf_p_wrapper(buf, sizeof(buf), "%d %1$d", 1234); */
 }
 
+static ULONGLONG rand64(void)
+{
+    return ((ULONGLONG)rand() << 60) ^ ((ULONGLONG)rand() << 45) ^
+        ((ULONGLONG)rand() << 30) ^ ((ULONGLONG)rand() << 15) ^ rand();
+}
+
+static void ref_ulonglong(char *buf, ULONGLONG v, unsigned int base)
+{
+    char tmp[70];
+    int i = 0;
+
+    do {
+        tmp[i++] = "0123456789abcdef"[v % base];
+        v /= base;
+    } while (v);
+    while (i) *buf++ = tmp[--i];
+    *buf = 0;
+}
+
+static void test_format_roundtrip(void)
+{
+    static const wchar_t format_u[] = {'%','I','6','4','u',0};
+    static const wchar_t format_f[] = {'%','.','*','f',0};
+    char buf[128], expect[128], digits[32];
+    wchar_t wbuf[128], wexpect[128];
+    ULONGLONG v, n;
+    double val, back;
+    int i, j, k, m, prec, len;
+
+    for (i = 0; i < 5000; i++)
+    {
+        v = rand64() >> (rand() % 64);
+
+        sprintf(buf, "%I64u", v);
+        ref_ulonglong(expect, v, 10);
+        ok(!strcmp(buf, expect), "got %s, expected %s\n", buf, expect);
+
+        sprintf(buf, "%I64d", (LONGLONG)v);
+        if ((LONGLONG)v < 0)
+        {
+            expect[0] = '-';
+            ref_ulonglong(expect + 1, -v, 10);
+        }
+        else ref_ulonglong(expect, v, 10);
+        ok(!strcmp(buf, expect), "got %s, expected %s\n", buf, expect);
+
+        sprintf(buf, "%I64x", v);
+        ref_ulonglong(expect, v, 16);
+        ok(!strcmp(buf, expect), "got %s, expected %s\n", buf, expect);
+
+        sprintf(buf, "%I64o", v);
+        ref_ulonglong(expect, v, 8);
+        ok(!strcmp(buf, expect), "got %s, expected %s\n", buf, expect);
+
+        sprintf(buf, "%40u|%-12u|%012u", (unsigned int)v, (unsigned int)v, (unsigned int)v);
+        ok(strlen(buf) == 66, "got %s\n", buf);
+        ok(strtoul(buf, NULL, 10) == (unsigned int)v, "got %s\n", buf);
+
+        swprintf(wbuf, format_u, v);
+        ref_ulonglong(expect, v, 10);
+        for (j = 0; expect[j]; j++) wexpect[j] = expect[j];
+        wexpect[j] = 0;
+        ok(!wcscmp(wbuf, wexpect), "got %s, expected %s\n", wine_dbgstr_w(wbuf), expect);
+    }
+
+    /* m/2^k has an exact decimal representation, so there's no rounding */
+    for (i = 0; i < 5000; i++)
+    {
+        m = rand() * 32 + rand() % 32;
+        k = rand() % 11;
+        prec = k + rand() % 4;
+        val = (double)m / (1 << k);
+
+        for (n = m, j = 0; j < k; j++) n *= 5;
+        len = sprintf(digits, "%I64u", n);
+        while (len <= k) /* leading zeros */
+        {
+            memmove(digits + 1, digits, len + 1);
+            digits[0] = '0';
+            len++;
+        }
+        sprintf(expect, "%.*s.%s", len - k, digits, digits + len - k);
+        for (j = k; j < prec; j++) strcat(expect, "0");
+        if (!prec) expect[len - k] = 0;
+
+        sprintf(buf, "%.*f", prec, val);
+        ok(!strcmp(buf, expect), "%d/2^%d: got %s, expected %s\n", m, k, buf, expect);
+        swprintf(wbuf, format_f, prec, val);
+        for (j = 0; expect[j]; j++) wexpect[j] = expect[j];
+        wexpect[j] = 0;
+        ok(!wcscmp(wbuf, wexpect), "%d/2^%d: got %s, expected %s\n", m, k, wine_dbgstr_w(wbuf), expect);
+
+        if (!m) continue;
+        len = sprintf(digits, "%I64u", n);
+        prec = len - 1 + rand() % 4;
+        sprintf(expect, "%c.%s", digits[0], digits + 1);
+        for (j = len - 1; j < prec; j++) strcat(expect, "0");
+        if (!prec) expect[1] = 0;
+        j = len - 1 - k;
+        sprintf(expect + strlen(expect), "e%c%03d", j < 0 ? '-' : '+', j < 0 ? -j : j);
+
+        sprintf(buf, "%.*e", prec, val);
+        ok(!strcmp(buf, expect), "%d/2^%d: got %s, expected %s\n", m, k, buf, expect);
+    }
+
+    for (i = 0; i < 5000; i++)
+    {
+        v = (rand64() & 0x000fffffffffffff) | ((ULONGLONG)(1023 + rand() % 121 - 60) << 52);
+        memcpy(&val, &v, sizeof(val));
+
+        sprintf(expect, "%.15e", val);
+        back = 0;
+        ok(sscanf(expect, "%lf", &back) == 1, "sscanf failed for %s\n", expect);
+        sprintf(buf, "%.15e", back);
+        ok(!strcmp(buf, expect), "got %s, expected %s\n", buf, expect);
+
+        val = (double)(rand64() >> 11) / (ULONGLONG)1000000;
+        _snprintf(expect, sizeof(expect), "%.6f", val);
+        back = 0;
+        ok(sscanf(expect, "%lf", &back) == 1, "sscanf failed for %s\n", expect);
+        _snprintf(buf, sizeof(buf), "%.6f", back);
+        ok(!strcmp(buf, expect), "got %s, expected %s\n", buf, expect);
+    }
+}
+
+static void benchmark_format(void)
+{
+    static const wchar_t format[] = {'%','d',' ','%','.','3','f',0};
+    char buf[64];
+    wchar_t wbuf[64];
+    volatile int sink = 0;
+    DWORD start;
+    double d;
+    int i, x;
+
+    start = GetTickCount();
+    for (i = 0; i < 1000000; i++) sink += sprintf(buf, "%d %8x", -i, i * 7919u);
+    trace("sprintf %%d: %u ms\n", GetTickCount() - start);
+
+    start = GetTickCount();
+    for (i = 0; i < 1000000; i++) sink += _snprintf(buf, sizeof(buf), "%.6f", i * 0.001);
+    trace("_snprintf %%f: %u ms\n", GetTickCount() - start);
+
+    start = GetTickCount();
+    for (i = 0; i < 1000000; i++) sink += sprintf(buf, "%.10e", i * 1.1);
+    trace("sprintf %%e: %u ms\n", GetTickCount() - start);
+
+    start = GetTickCount();
+    for (i = 0; i < 1000000; i++) sink += swprintf(wbuf, format, i, i * 0.5);
+    trace("swprintf: %u ms\n", GetTickCount() - start);
+
+    start = GetTickCount();
+    for (i = 0; i < 1000000; i++) sink += sscanf("12345 678.25", "%d %lf", &x, &d);
+    trace("sscanf: %u ms\n", GetTickCount() - start);
+}
+
 static void test__get_output_format(void)
 {
     unsigned int ret;
@@ -1500,4 +1658,8 @@ START_TEST(printf)
     test_vsnwprintf_s();
     test_vsprintf_p();
     test__get_output_format();
+    test_format_roundtrip();
+
+    if (winetest_interactive)
+        benchmark_format();
 }
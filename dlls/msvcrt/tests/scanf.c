@@ -20,6 +20,8 @@
 
 #include <stdio.h>
 
+#include "windef.h"
+#include "winbase.h"
 #include "wine/test.h"
 
 static void test_sscanf( void )
@@ -310,9 +312,49 @@ static void test_swscanf( void )
         "swscanf returns %x instead of %x\n", ret, WEOF );
 }
 
+static void test_fscanf( void )
+{
+    char name[MAX_PATH], buffer[16];
+    double d;
+    FILE *file;
+    int i, ret, x;
+    char c;
+
+    GetTempFileNameA(".", "sca", 0, name);
+    file = fopen(name, "w");
+    ok(file != NULL, "fopen failed\n");
+    for (i = 0; i < 2000; i++)
+        fprintf(file, "%d %.2f word%d;", i, i + 0.25, i);
+    fclose(file);
+
+    file = fopen(name, "r");
+    for (i = 0; i < 2000; i++)
+    {
+        ret = fscanf(file, "%d %lf %15[a-z0-9]%c", &x, &d, buffer, &c);
+        ok(ret == 4, "%d: ret = %d\n", i, ret);
+        ok(x == i, "%d: x = %d\n", i, x);
+        ok(d == i + 0.25, "%d: d = %f\n", i, d);
+        ok(c == ';', "%d: c = %c\n", i, c);
+        if (ret != 4) break;
+    }
+    ret = fscanf(file, "%d", &x);
+    ok(ret == EOF, "ret = %d\n", ret);
+    fclose(file);
+
+    /* the character that ends a number is pushed back */
+    file = fopen(name, "r");
+    ret = fscanf(file, "%d", &x);
+    ok(ret == 1 && !x, "ret = %d, x = %d\n", ret, x);
+    ok(fgetc(file) == ' ', "wrong character\n");
+    ok(ftell(file) == 2, "ftell returned %d\n", ftell(file));
+    fclose(file);
+    DeleteFileA(name);
+}
+
 START_TEST(scanf)
 {
     test_sscanf();
     test_sscanf_s();
     test_swscanf();
+    test_fscanf();
 }
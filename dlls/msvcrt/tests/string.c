@@ -67,6 +67,7 @@ static int (__cdecl *p_wcsncpy_s)(wchar_t *wcDest, size_t size, const wchar_t *w
 static int (__cdecl *p_wcsncat_s)(wchar_t *dst, size_t elem, const wchar_t *src, size_t count);
 static int (__cdecl *p_wcsupr_s)(wchar_t *str, size_t size);
 static size_t (__cdecl *p_strnlen)(const char *, size_t);
+static size_t (__cdecl *p_wcsnlen)(const wchar_t *, size_t);
 static __int64 (__cdecl *p_strtoi64)(const char *, char **, int);
 static unsigned __int64 (__cdecl *p_strtoui64)(const char *, char **, int);
 static __int64 (__cdecl *p_wcstoi64)(const wchar_t *, wchar_t **, int);
@@ -3113,6 +3114,239 @@ static void test__mbscmp(void)
     ok(ret == 1, "got %d\n", ret);
 }
 
+static int sign(int v)
+{
+    return v > 0 ? 1 : (v < 0 ? -1 : 0);
+}
+
+static int ref_wcsicmp(const wchar_t *s1, const wchar_t *s2)
+{
+    wchar_t c1, c2;
+
+    do
+    {
+        c1 = *s1++;
+        c2 = *s2++;
+        if (c1 >= 'A' && c1 <= 'Z') c1 += 'a' - 'A';
+        if (c2 >= 'A' && c2 <= 'Z') c2 += 'a' - 'A';
+    } while (c1 && c1 == c2);
+    return sign(c1 - c2);
+}
+
+static int ref_stricmp(const char *s1, const char *s2)
+{
+    unsigned char c1, c2;
+
+    do
+    {
+        c1 = *s1++;
+        c2 = *s2++;
+        if (c1 >= 'A' && c1 <= 'Z') c1 += 'a' - 'A';
+        if (c2 >= 'A' && c2 <= 'Z') c2 += 'a' - 'A';
+    } while (c1 && c1 == c2);
+    return sign(c1 - c2);
+}
+
+static int ref_strcmp(const char *s1, const char *s2)
+{
+    while (*s1 && *s1 == *s2) s1++, s2++;
+    return sign((unsigned char)*s1 - (unsigned char)*s2);
+}
+
+/* Fills the string so that it ends on the last byte before the guard page,
+ * the vectorized implementations must not read past the terminator. */
+static wchar_t *make_wstr(char *guard, int len, BOOL misalign, BOOL mutate, const wchar_t *src)
+{
+    static const wchar_t chars[] = {'a','A','z','Z','@','[','`','{','0',0x3042,0x4e00,0x7f};
+    wchar_t *str = (wchar_t *)(guard - (len + 1) * sizeof(wchar_t) - (misalign ? 1 : 0));
+    int i;
+
+    for (i = 0; i < len; i++)
+        str[i] = src ? src[i] : chars[rand() % (sizeof(chars)/sizeof(chars[0]))];
+    str[len] = 0;
+    if (mutate && len)
+    {
+        i = rand() % len;
+        switch (rand() % 3)
+        {
+        case 0: str[i] ^= 0x20; break;
+        case 1: str[i] = chars[rand() % (sizeof(chars)/sizeof(chars[0]))]; break;
+        case 2: str[i] = 0; break;
+        }
+    }
+    return str;
+}
+
+static char *make_str(char *guard, int len, BOOL mutate, const char *src)
+{
+    static const char chars[] = "aAzZ@[`{0\x7f\xc0\xe0";
+    char *str = guard - len - 1;
+    int i;
+
+    for (i = 0; i < len; i++)
+        str[i] = src ? src[i] : chars[rand() % (sizeof(chars) - 1)];
+    str[len] = 0;
+    if (mutate && len)
+    {
+        i = rand() % len;
+        switch (rand() % 3)
+        {
+        case 0: str[i] ^= 0x20; break;
+        case 1: str[i] = chars[rand() % (sizeof(chars) - 1)]; break;
+        case 2: str[i] = 0; break;
+        }
+    }
+    return str;
+}
+
+static void test_string_fuzz(void)
+{
+    wchar_t *wstr1, *wstr2, ch;
+    char *buf, *str1, *str2;
+    int i, len, ret, exp;
+    size_t max;
+    SYSTEM_INFO si;
+    DWORD prot;
+
+    GetSystemInfo(&si);
+    buf = VirtualAlloc(NULL, 4 * si.dwPageSize, MEM_COMMIT, PAGE_READWRITE);
+    ok(buf != NULL, "VirtualAlloc failed\n");
+    VirtualProtect(buf + si.dwPageSize, si.dwPageSize, PAGE_NOACCESS, &prot);
+    VirtualProtect(buf + 3 * si.dwPageSize, si.dwPageSize, PAGE_NOACCESS, &prot);
+
+    srand(0x2a);
+    for (i = 0; i < 5000; i++)
+    {
+        len = rand() % 200;
+        wstr1 = make_wstr(buf + si.dwPageSize, len, rand() % 2, FALSE, NULL);
+        wstr2 = make_wstr(buf + 3 * si.dwPageSize, len, rand() % 2, TRUE, wstr1);
+
+        ok(wcslen(wstr1) == len, "%d: wcslen returned %d\n", i, (int)wcslen(wstr1));
+        if (p_wcsnlen)
+        {
+            max = rand() % (len + 2);
+            ok(p_wcsnlen(wstr1, max) == min(max, len), "%d: wcsnlen(%d) returned %d, len %d\n",
+               i, (int)max, (int)p_wcsnlen(wstr1, max), len);
+        }
+
+        ch = len && rand() % 2 ? wstr1[rand() % len] : rand() % 2 ? 'a' : 0;
+        for (exp = 0; exp < len && wstr1[exp] != ch; exp++);
+        ok(wcschr(wstr1, ch) == (exp < len || !ch ? wstr1 + exp : NULL),
+           "%d: wcschr(%x) returned %p\n", i, ch, wcschr(wstr1, ch));
+
+        ret = sign(wcscmp(wstr1, wstr2));
+        for (exp = 0; exp < len + 1 && wstr1[exp] == wstr2[exp]; exp++);
+        exp = exp == len + 1 ? 0 : sign(wstr1[exp] - wstr2[exp]);
+        ok(ret == exp, "%d: wcscmp returned %d, expected %d\n", i, ret, exp);
+
+        ret = sign(_wcsicmp(wstr1, wstr2));
+        exp = ref_wcsicmp(wstr1, wstr2);
+        ok(ret == exp, "%d: _wcsicmp(%s, %s) returned %d, expected %d\n",
+           i, wine_dbgstr_w(wstr1), wine_dbgstr_w(wstr2), ret, exp);
+        ret = sign(_wcsicmp(wstr2, wstr1));
+        ok(ret == -exp, "%d: _wcsicmp returned %d, expected %d\n", i, ret, -exp);
+
+        str1 = make_str(buf + si.dwPageSize, len, FALSE, NULL);
+        str2 = make_str(buf + 3 * si.dwPageSize, len, TRUE, str1);
+
+        ok(strlen(str1) == len, "%d: strlen returned %d\n", i, (int)strlen(str1));
+        if (p_strnlen)
+        {
+            max = rand() % (len + 2);
+            ok(p_strnlen(str1, max) == min(max, len), "%d: strnlen(%d) returned %d, len %d\n",
+               i, (int)max, (int)p_strnlen(str1, max), len);
+        }
+
+        ret = sign(_stricmp(str1, str2));
+        exp = ref_stricmp(str1, str2);
+        ok(ret == exp, "%d: _stricmp(%s, %s) returned %d, expected %d\n", i, str1, str2, ret, exp);
+    }
+
+    /* the characters differing in the trail byte must be compared as a whole */
+    _setmbcp(932);
+    for (i = 0; i < 2000; i++)
+    {
+        static const char *chars[] = {"a", "A", "z", "\x82\xa0", "\x82\x61", "\x83\x61", "\x82\x7a"};
+        char tmp[256];
+        int pos = 0;
+
+        len = rand() % 120;
+        while (pos < len)
+        {
+            const char *c = chars[rand() % (sizeof(chars)/sizeof(chars[0]))];
+            if (pos + strlen(c) > len) break;
+            memcpy(tmp + pos, c, strlen(c));
+            pos += strlen(c);
+        }
+        tmp[pos] = 0;
+        str1 = make_str(buf + si.dwPageSize, pos, FALSE, tmp);
+        if (pos && rand() % 2)
+        {
+            int j = rand() % pos;
+            /* only replace complete characters */
+            if (!(tmp[j] & 0x80) && (!j || !(tmp[j - 1] & 0x80)))
+                tmp[j] = rand() % 2 ? 'b' : 0;
+        }
+        str2 = make_str(buf + 3 * si.dwPageSize, pos, FALSE, tmp);
+
+        ret = _mbscmp((unsigned char *)str1, (unsigned char *)str2);
+        exp = ref_strcmp(str1, str2);
+        ok(ret == exp, "%d: _mbscmp(%s, %s) returned %d, expected %d\n", i, str1, str2, ret, exp);
+    }
+    _setmbcp(_MB_CP_SBCS);
+
+    VirtualFree(buf, 0, MEM_RELEASE);
+}
+
+static void benchmark_string(void)
+{
+    wchar_t wstr1[1024], wstr2[1024];
+    char str1[1024], str2[1024];
+    volatile int sink = 0;
+    DWORD start;
+    int i;
+
+    for (i = 0; i < 1023; i++)
+    {
+        wstr1[i] = wstr2[i] = 'a' + i % 26;
+        str1[i] = str2[i] = 'a' + i % 26;
+    }
+    wstr1[i] = wstr2[i] = 0;
+    str1[i] = str2[i] = 0;
+    wstr2[1000] = str2[1000] = 'A';
+
+    start = GetTickCount();
+    for (i = 0; i < 200000; i++) sink += wcslen(wstr1);
+    trace("wcslen: %u ms\n", GetTickCount() - start);
+
+    start = GetTickCount();
+    for (i = 0; i < 200000; i++) sink += wcschr(wstr1, '!') != NULL;
+    trace("wcschr: %u ms\n", GetTickCount() - start);
+
+    start = GetTickCount();
+    for (i = 0; i < 200000; i++) sink += wcscmp(wstr1, wstr2);
+    trace("wcscmp: %u ms\n", GetTickCount() - start);
+
+    start = GetTickCount();
+    for (i = 0; i < 200000; i++) sink += _wcsicmp(wstr1, wstr2);
+    trace("_wcsicmp: %u ms\n", GetTickCount() - start);
+
+    start = GetTickCount();
+    for (i = 0; i < 200000; i++) sink += strlen(str1);
+    trace("strlen: %u ms\n", GetTickCount() - start);
+
+    start = GetTickCount();
+    for (i = 0; i < 200000; i++) sink += _stricmp(str1, str2);
+    trace("_stricmp: %u ms\n", GetTickCount() - start);
+
+    _setmbcp(932);
+    start = GetTickCount();
+    for (i = 0; i < 200000; i++) sink += _mbscmp((unsigned char *)str1, (unsigned char *)str2);
+    trace("_mbscmp: %u ms\n", GetTickCount() - start);
+    _setmbcp(_MB_CP_SBCS);
+}
+
+
 START_TEST(string)
 {
     char mem[100];
@@ -3140,6 +3374,7 @@ START_TEST(string)
     p_wcsncat_s = (void *)GetProcAddress( hMsvcrt,"wcsncat_s" );
     p_wcsupr_s = (void *)GetProcAddress( hMsvcrt,"_wcsupr_s" );
     p_strnlen = (void *)GetProcAddress( hMsvcrt,"strnlen" );
+    p_wcsnlen = (void *)GetProcAddress( hMsvcrt,"wcsnlen" );
     p_strtoi64 = (void *)GetProcAddress(hMsvcrt, "_strtoi64");
     p_strtoui64 = (void *)GetProcAddress(hMsvcrt, "_strtoui64");
     p_wcstoi64 = (void *)GetProcAddress(hMsvcrt, "_wcstoi64");
@@ -3227,4 +3462,7 @@ START_TEST(string)
     test__strnset_s();
     test__wcsset_s();
     test__mbscmp();
+    test_string_fuzz();
+    if (winetest_interactive)
+        benchmark_string();
 }
@@ -78,7 +78,7 @@ INT CDECL MSVCRT__wcsicmp_l(const MSVCRT_wchar_t *str1, const MSVCRT_wchar_t *st
     if(!MSVCRT_CHECK_PMT(str1 != NULL) || !MSVCRT_CHECK_PMT(str2 != NULL))
         return MSVCRT__NLSCMPERROR;
 
-    return strcmpiW(str1, str2);
+    return msvcrt_wcsncmp(str1, str2, ~(MSVCRT_size_t)0, TRUE);
 }
 
 /*********************************************************************
@@ -86,7 +86,7 @@ INT CDECL MSVCRT__wcsicmp_l(const MSVCRT_wchar_t *str1, const MSVCRT_wchar_t *st
  */
 INT CDECL MSVCRT__wcsicmp( const MSVCRT_wchar_t* str1, const MSVCRT_wchar_t* str2 )
 {
-    return strcmpiW( str1, str2 );
+    return msvcrt_wcsncmp(str1, str2, ~(MSVCRT_size_t)0, TRUE);
 }
 
 /*********************************************************************
@@ -94,7 +94,8 @@ INT CDECL MSVCRT__wcsicmp( const MSVCRT_wchar_t* str1, const MSVCRT_wchar_t* str
  */
 INT CDECL MSVCRT__wcsnicmp_l(const MSVCRT_wchar_t *str1, const MSVCRT_wchar_t *str2, INT n, MSVCRT__locale_t locale)
 {
-    return strncmpiW(str1, str2, n);
+    if (n <= 0) return 0;
+    return msvcrt_wcsncmp(str1, str2, n, TRUE);
 }
 
 /*********************************************************************
@@ -1871,7 +1872,7 @@ INT CDECL MSVCRT_wcscpy_s( MSVCRT_wchar_t* wcDest, MSVCRT_size_t numElement, con
 
     if(!MSVCRT_CHECK_PMT(wcSrc)) return MSVCRT_EINVAL;
 
-    size = strlenW(wcSrc) + 1;
+    size = msvcrt_wcsnlen(wcSrc, numElement) + 1;
 
     if(!MSVCRT_CHECK_PMT_ERR(size <= numElement, MSVCRT_ERANGE))
         return MSVCRT_ERANGE;
@@ -1954,10 +1955,17 @@ INT CDECL MSVCRT_wcscat_s(MSVCRT_wchar_t* dst, MSVCRT_size_t elem, const MSVCRT_
     }
 
     /* seek to end of dst string (or elem if no end of string is found */
-    while (ptr < dst + elem && *ptr != '\0') ptr++;
-    while (ptr < dst + elem)
+    ptr += msvcrt_wcsnlen(dst, elem);
+    if (ptr < dst + elem)
     {
-        if ((*ptr++ = *src++) == '\0') return 0;
+        MSVCRT_size_t avail = dst + elem - ptr, len = msvcrt_wcsnlen(src, avail);
+
+        if (len < avail)
+        {
+            memcpy(ptr, src, (len + 1) * sizeof(MSVCRT_wchar_t));
+            return 0;
+        }
+        memcpy(ptr, src, len * sizeof(MSVCRT_wchar_t));
     }
     /* not enough space */
     dst[0] = '\0';
@@ -2283,11 +2291,7 @@ MSVCRT_ulong __cdecl MSVCRT_wcstoul(const MSVCRT_wchar_t *s, MSVCRT_wchar_t **en
  */
 MSVCRT_size_t CDECL MSVCRT_wcsnlen(const MSVCRT_wchar_t *s, MSVCRT_size_t maxlen)
 {
-    MSVCRT_size_t i;
-
-    for (i = 0; i < maxlen; i++)
-        if (!s[i]) break;
-    return i;
+    return msvcrt_wcsnlen(s, maxlen);
 }
 
 /*********************************************************************
@@ -2327,7 +2331,7 @@ int CDECL MSVCRT_towlower(MSVCRT_wint_t c)
  */
 MSVCRT_wchar_t* CDECL MSVCRT_wcschr(const MSVCRT_wchar_t *str, MSVCRT_wchar_t ch)
 {
-    return strchrW(str, ch);
+    return msvcrt_wcschr(str, ch);
 }
 
 /***********************************************************************
@@ -2335,7 +2339,7 @@ MSVCRT_wchar_t* CDECL MSVCRT_wcschr(const MSVCRT_wchar_t *str, MSVCRT_wchar_t ch
  */
 int CDECL MSVCRT_wcslen(const MSVCRT_wchar_t *str)
 {
-    return strlenW(str);
+    return msvcrt_wcsnlen(str, ~(MSVCRT_size_t)0);
 }
 
 /*********************************************************************
@@ -2386,7 +2390,16 @@ __int64 CDECL MSVCRT__wtoi64(const MSVCRT_wchar_t *str)
  */
 int CDECL MSVCRT_wcsncmp(const MSVCRT_wchar_t *str1, const MSVCRT_wchar_t *str2, int n)
 {
-    return strncmpW(str1, str2, n);
+    if (n <= 0) return 0;
+    return msvcrt_wcsncmp(str1, str2, n, FALSE);
+}
+
+/*********************************************************************
+ *           wcscmp    (MSVCRT.@)
+ */
+int CDECL MSVCRT_wcscmp(const MSVCRT_wchar_t *str1, const MSVCRT_wchar_t *str2)
+{
+    return msvcrt_wcsncmp(str1, str2, ~(MSVCRT_size_t)0, FALSE);
 }
 
 /*********************************************************************
@@ -3383,6 +3383,25 @@ NTSTATUS WINAPI NtSetEaFile( HANDLE hFile, PIO_STATUS_BLOCK iosb, PVOID buffer,
 }
 
 
+/* check whether all the data written to a pipe has been read by the other end,
+ * waiting a little for it to be consumed before having to ask the server */
+static BOOL pipe_is_flushed( int fd )
+{
+#if defined(__linux__) && defined(TIOCOUTQ)
+    int i, pending;
+
+    /* on Linux SIOCOUTQ (same value as TIOCOUTQ) returns the amount of data
+     * queued on a unix socket that has not been consumed by its peer yet */
+    for (i = 0; i < 64; i++)
+    {
+        if (ioctl( fd, TIOCOUTQ, &pending ) == -1) return FALSE;
+        if (!pending) return TRUE;
+        NtYieldExecution();
+    }
+#endif
+    return FALSE;
+}
+
 /******************************************************************
  *		NtFlushBuffersFile  (NTDLL.@)
  *
@@ -3409,7 +3428,7 @@ NTSTATUS WINAPI NtFlushBuffersFile( HANDLE hFile, IO_STATUS_BLOCK* IoStatusBlock
     {
         ret = COMM_FlushBuffersFile( fd );
     }
-    else
+    else if (ret || type != FD_TYPE_PIPE || !pipe_is_flushed( fd ))
     {
         SERVER_START_REQ( flush )
         {
@@ -67,6 +67,7 @@
 
 #include "wine/unicode.h"
 #include "wine/debug.h"
+#include "wine/rbtree.h"
 
 WINE_DEFAULT_DEBUG_CHANNEL(ole);
 
@@ -150,6 +151,21 @@ struct progidredirect_data
     ULONG clsid_offset;
 };
 
+/* in-process class registration resolved from the registry */
+struct inproc_class_info
+{
+    enum comclass_threadingmodel model;
+    DWORD path_ret;
+    WCHAR path[MAX_PATH+1];
+};
+
+enum class_reg_data_origin
+{
+    CLASS_REG_ACTCTX,
+    CLASS_REG_REGISTRY,
+    CLASS_REG_CACHE,
+};
+
 struct class_reg_data
 {
     union
@@ -161,9 +177,53 @@ struct class_reg_data
             HANDLE hactctx;
         } actctx;
         HKEY hkey;
+        const struct inproc_class_info *info;
     } u;
-    BOOL hkey;
+    enum class_reg_data_origin origin;
+};
+
+/*
+ * Cache of the InprocServer32 and InprocHandler32 registrations, so that
+ * activating the same class again doesn't need to go through the registry.
+ * It is flushed whenever something changes under HKCR\CLSID.
+ */
+struct inproc_class_cache_key
+{
+    CLSID clsid;
+    BOOL handler;
+};
+
+struct inproc_class_cache_entry
+{
+    struct wine_rb_entry entry;
+    struct inproc_class_cache_key key;
+    HRESULT hr;
+    struct inproc_class_info info;
+};
+
+static int inproc_class_cache_compare(const void *key, const struct wine_rb_entry *entry)
+{
+    const struct inproc_class_cache_key *k = key;
+    const struct inproc_class_cache_entry *cached = WINE_RB_ENTRY_VALUE(entry, const struct inproc_class_cache_entry, entry);
+    int ret = memcmp(&k->clsid, &cached->key.clsid, sizeof(k->clsid));
+
+    if (ret) return ret;
+    return k->handler - cached->key.handler;
+}
+
+static struct wine_rb_tree inproc_class_cache = { inproc_class_cache_compare };
+static HKEY inproc_class_cache_key;
+static HANDLE inproc_class_cache_event;
+static LONG inproc_class_cache_generation;
+
+static CRITICAL_SECTION csInprocClassCache;
+static CRITICAL_SECTION_DEBUG inproc_class_cache_cs_debug =
+{
+    0, 0, &csInprocClassCache,
+    { &inproc_class_cache_cs_debug.ProcessLocksList, &inproc_class_cache_cs_debug.ProcessLocksList },
+      0, 0, { (DWORD_PTR)(__FILE__ ": csInprocClassCache") }
 };
+static CRITICAL_SECTION csInprocClassCache = { &inproc_class_cache_cs_debug, -1, 0, 0, 0, 0 };
 
 struct registered_psclsid
 {
@@ -1387,7 +1447,13 @@ static DWORD COM_RegReadPath(const struct class_reg_data *regdata, WCHAR *dst, D
 {
     DWORD ret;
 
-    if (regdata->hkey)
+    if (regdata->origin == CLASS_REG_CACHE)
+    {
+        if (!(ret = regdata->u.info->path_ret))
+            lstrcpynW(dst, regdata->u.info->path, dstlen);
+        return ret;
+    }
+    else if (regdata->origin == CLASS_REG_REGISTRY)
     {
 	DWORD keytype;
 	WCHAR src[MAX_PATH];
@@ -2853,7 +2919,9 @@ HRESULT WINAPI CoRegisterClassObject(
 
 static enum comclass_threadingmodel get_threading_model(const struct class_reg_data *data)
 {
-    if (data->hkey)
+    if (data->origin == CLASS_REG_CACHE)
+        return data->u.info->model;
+    else if (data->origin == CLASS_REG_REGISTRY)
     {
         static const WCHAR wszThreadingModel[] = {'T','h','r','e','a','d','i','n','g','M','o','d','e','l',0};
         static const WCHAR wszApartment[] = {'A','p','a','r','t','m','e','n','t',0};
@@ -2880,6 +2948,123 @@ static enum comclass_threadingmodel get_threading_model(const struct class_reg_d
         return data->u.actctx.data->model;
 }
 
+static void inproc_class_cache_free_entry(struct wine_rb_entry *entry, void *context)
+{
+    HeapFree(GetProcessHeap(), 0, WINE_RB_ENTRY_VALUE(entry, struct inproc_class_cache_entry, entry));
+}
+
+/* flushes the cache if the registry has changed since the last lookup,
+ * returns FALSE if changes can't be tracked; called with csInprocClassCache held */
+static BOOL inproc_class_cache_check(void)
+{
+    static const WCHAR wszCLSID[] = {'C','L','S','I','D',0};
+
+    if (!inproc_class_cache_event)
+    {
+        if (open_classes_key(HKEY_CLASSES_ROOT, wszCLSID, KEY_NOTIFY, &inproc_class_cache_key))
+            return FALSE;
+        inproc_class_cache_event = CreateEventW(NULL, TRUE, TRUE, NULL);
+    }
+    else if (WaitForSingleObject(inproc_class_cache_event, 0) != WAIT_OBJECT_0)
+        return TRUE;
+
+    TRACE("registry changed, flushing cache\n");
+
+    wine_rb_clear(&inproc_class_cache, inproc_class_cache_free_entry, NULL);
+    inproc_class_cache_generation++;
+
+    ResetEvent(inproc_class_cache_event);
+    if (RegNotifyChangeKeyValue(inproc_class_cache_key, TRUE,
+                                REG_NOTIFY_CHANGE_NAME | REG_NOTIFY_CHANGE_LAST_SET,
+                                inproc_class_cache_event, TRUE))
+    {
+        /* keep the event signaled, so that the next lookup tries again */
+        SetEvent(inproc_class_cache_event);
+        return FALSE;
+    }
+    return TRUE;
+}
+
+/* reads the in-process server or handler registration of a class */
+static HRESULT get_inproc_class_info(REFCLSID rclsid, BOOL handler, struct inproc_class_info *info)
+{
+    static const WCHAR wszInprocServer32[] = {'I','n','p','r','o','c','S','e','r','v','e','r','3','2',0};
+    static const WCHAR wszInprocHandler32[] = {'I','n','p','r','o','c','H','a','n','d','l','e','r','3','2',0};
+    struct inproc_class_cache_key key;
+    struct inproc_class_cache_entry *entry;
+    struct wine_rb_entry *cached;
+    struct class_reg_data regdata;
+    BOOL cacheable;
+    LONG generation;
+    HRESULT hr;
+    HKEY hkey;
+
+    key.clsid = *rclsid;
+    key.handler = handler;
+
+    EnterCriticalSection(&csInprocClassCache);
+
+    cacheable = inproc_class_cache_check();
+    generation = inproc_class_cache_generation;
+
+    if ((cached = wine_rb_get(&inproc_class_cache, &key)))
+    {
+        entry = WINE_RB_ENTRY_VALUE(cached, struct inproc_class_cache_entry, entry);
+        *info = entry->info;
+        hr = entry->hr;
+        LeaveCriticalSection(&csInprocClassCache);
+        return hr;
+    }
+
+    LeaveCriticalSection(&csInprocClassCache);
+
+    hr = COM_OpenKeyForCLSID(rclsid, handler ? wszInprocHandler32 : wszInprocServer32, KEY_READ, &hkey);
+    if (SUCCEEDED(hr))
+    {
+        regdata.u.hkey = hkey;
+        regdata.origin = CLASS_REG_REGISTRY;
+        info->model = get_threading_model(&regdata);
+        info->path_ret = COM_RegReadPath(&regdata, info->path, ARRAYSIZE(info->path));
+        RegCloseKey(hkey);
+    }
+    else if (hr == REGDB_E_READREGDB)
+        return hr;
+    else
+    {
+        info->model = ThreadingModel_No;
+        info->path_ret = ERROR_FILE_NOT_FOUND;
+        info->path[0] = 0;
+    }
+
+    if (cacheable && (entry = HeapAlloc(GetProcessHeap(), 0, sizeof(*entry))))
+    {
+        entry->key = key;
+        entry->hr = hr;
+        entry->info = *info;
+
+        EnterCriticalSection(&csInprocClassCache);
+        /* don't add stale data if the cache was flushed in the meantime,
+         * another thread may also have added the class already */
+        if (generation != inproc_class_cache_generation ||
+            wine_rb_put(&inproc_class_cache, &entry->key, &entry->entry))
+            HeapFree(GetProcessHeap(), 0, entry);
+        LeaveCriticalSection(&csInprocClassCache);
+    }
+
+    return hr;
+}
+
+static void inproc_class_cache_free(void)
+{
+    EnterCriticalSection(&csInprocClassCache);
+    wine_rb_clear(&inproc_class_cache, inproc_class_cache_free_entry, NULL);
+    if (inproc_class_cache_key) RegCloseKey(inproc_class_cache_key);
+    if (inproc_class_cache_event) CloseHandle(inproc_class_cache_event);
+    inproc_class_cache_key = NULL;
+    inproc_class_cache_event = NULL;
+    LeaveCriticalSection(&csInprocClassCache);
+}
+
 static HRESULT get_inproc_class_object(APARTMENT *apt, const struct class_reg_data *regdata,
                                        REFCLSID rclsid, REFIID riid,
                                        BOOL hostifnecessary, void **ppv)
@@ -3013,7 +3198,7 @@ HRESULT WINAPI DECLSPEC_HOTPATCH CoGetClassObject(
             clsreg.u.actctx.hactctx = data.hActCtx;
             clsreg.u.actctx.data = data.lpData;
             clsreg.u.actctx.section = data.lpSectionBase;
-            clsreg.hkey = FALSE;
+            clsreg.origin = CLASS_REG_ACTCTX;
 
             hres = get_inproc_class_object(apt, &clsreg, &comclass->clsid, iid, !(dwClsContext & WINE_CLSCTX_DONT_HOST), ppv);
             ReleaseActCtx(data.hActCtx);
@@ -3045,10 +3230,9 @@ HRESULT WINAPI DECLSPEC_HOTPATCH CoGetClassObject(
     /* First try in-process server */
     if (CLSCTX_INPROC_SERVER & dwClsContext)
     {
-        static const WCHAR wszInprocServer32[] = {'I','n','p','r','o','c','S','e','r','v','e','r','3','2',0};
-        HKEY hkey;
+        struct inproc_class_info info;
 
-        hres = COM_OpenKeyForCLSID(rclsid, wszInprocServer32, KEY_READ, &hkey);
+        hres = get_inproc_class_info(rclsid, FALSE, &info);
         if (FAILED(hres))
         {
             if (hres == REGDB_E_CLASSNOTREG)
@@ -3062,11 +3246,10 @@ HRESULT WINAPI DECLSPEC_HOTPATCH CoGetClassObject(
 
         if (SUCCEEDED(hres))
         {
-            clsreg.u.hkey = hkey;
-            clsreg.hkey = TRUE;
+            clsreg.u.info = &info;
+            clsreg.origin = CLASS_REG_CACHE;
 
             hres = get_inproc_class_object(apt, &clsreg, rclsid, iid, !(dwClsContext & WINE_CLSCTX_DONT_HOST), ppv);
-            RegCloseKey(hkey);
         }
 
         /* return if we got a class, otherwise fall through to one of the
@@ -3081,10 +3264,9 @@ HRESULT WINAPI DECLSPEC_HOTPATCH CoGetClassObject(
     /* Next try in-process handler */
     if (CLSCTX_INPROC_HANDLER & dwClsContext)
     {
-        static const WCHAR wszInprocHandler32[] = {'I','n','p','r','o','c','H','a','n','d','l','e','r','3','2',0};
-        HKEY hkey;
+        struct inproc_class_info info;
 
-        hres = COM_OpenKeyForCLSID(rclsid, wszInprocHandler32, KEY_READ, &hkey);
+        hres = get_inproc_class_info(rclsid, TRUE, &info);
         if (FAILED(hres))
         {
             if (hres == REGDB_E_CLASSNOTREG)
@@ -3098,11 +3280,10 @@ HRESULT WINAPI DECLSPEC_HOTPATCH CoGetClassObject(
 
         if (SUCCEEDED(hres))
         {
-            clsreg.u.hkey = hkey;
-            clsreg.hkey = TRUE;
+            clsreg.u.info = &info;
+            clsreg.origin = CLASS_REG_CACHE;
 
             hres = get_inproc_class_object(apt, &clsreg, rclsid, iid, !(dwClsContext & WINE_CLSCTX_DONT_HOST), ppv);
-            RegCloseKey(hkey);
         }
 
         /* return if we got a class, otherwise fall through to one of the
@@ -5024,7 +5205,7 @@ HRESULT Handler_DllGetClassObject(REFCLSID rclsid, REFIID riid, LPVOID *ppv)
         WCHAR dllpath[MAX_PATH+1];
 
         regdata.u.hkey = hkey;
-        regdata.hkey = TRUE;
+        regdata.origin = CLASS_REG_REGISTRY;
 
         if (COM_RegReadPath(&regdata, dllpath, ARRAYSIZE(dllpath)) == ERROR_SUCCESS)
         {
@@ -5090,6 +5271,8 @@ BOOL WINAPI DllMain(HINSTANCE hinstDLL, DWORD fdwReason, LPVOID reserved)
         UnregisterClassW( wszAptWinClass, hProxyDll );
         RPC_UnregisterAllChannelHooks();
         COMPOBJ_DllList_Free();
+        inproc_class_cache_free();
+        DeleteCriticalSection(&csInprocClassCache);
         DeleteCriticalSection(&csRegisteredClassList);
         DeleteCriticalSection(&csApartment);
 	break;
@@ -672,6 +672,56 @@ static HRESULT ifproxy_release_public_refs(struct ifproxy * This)
     return hr;
 }
 
+/* releases the public references of all interface proxies with a single
+ * IRemUnknown::RemRelease call instead of one round trip per interface */
+static void proxy_manager_release_public_refs(struct proxy_manager * This)
+{
+    ULONG count = 0, total = list_count(&This->interfaces), i;
+    struct ifproxy *ifproxy, **ifproxies;
+    REMINTERFACEREF *rifs;
+    IRemUnknown *remunk;
+    HRESULT hr;
+
+    if (total < 2)
+        return;
+
+    if (WAIT_OBJECT_0 != WaitForSingleObject(This->remoting_mutex, INFINITE))
+    {
+        ERR("Wait failed for proxy manager %p\n", This);
+        return;
+    }
+
+    rifs = HeapAlloc(GetProcessHeap(), 0, total * (sizeof(*rifs) + sizeof(*ifproxies)));
+    if (rifs)
+    {
+        ifproxies = (struct ifproxy **)(rifs + total);
+        LIST_FOR_EACH_ENTRY(ifproxy, &This->interfaces, struct ifproxy, entry)
+        {
+            if (!ifproxy->refs) continue;
+            ifproxies[count] = ifproxy;
+            rifs[count].ipid = ifproxy->stdobjref.ipid;
+            rifs[count].cPublicRefs = ifproxy->refs;
+            rifs[count].cPrivateRefs = 0;
+            count++;
+        }
+    }
+
+    /* leave single interfaces and failures to ifproxy_release_public_refs */
+    if (count > 1 && proxy_manager_get_remunknown(This, &remunk) == S_OK)
+    {
+        TRACE("releasing refs of %u interfaces\n", count);
+
+        hr = IRemUnknown_RemRelease(remunk, count, rifs);
+        IRemUnknown_Release(remunk);
+        if (hr == S_OK)
+            for (i = 0; i < count; i++)
+                InterlockedExchangeAdd((LONG *)&ifproxies[i]->refs, -(LONG)rifs[i].cPublicRefs);
+    }
+
+    HeapFree(GetProcessHeap(), 0, rifs);
+    ReleaseMutex(This->remoting_mutex);
+}
+
 /* should be called inside This->parent->cs critical section */
 static void ifproxy_disconnect(struct ifproxy * This)
 {
@@ -986,6 +1036,8 @@ static void proxy_manager_disconnect(struct proxy_manager * This)
      * working */
     if (!(This->sorflags & SORFP_NOLIFETIMEMGMT))
     {
+        proxy_manager_release_public_refs(This);
+
         LIST_FOR_EACH(cursor, &This->interfaces)
         {
             struct ifproxy * ifproxy = LIST_ENTRY(cursor, struct ifproxy, entry);
@@ -1090,6 +1142,8 @@ static void proxy_manager_destroy(struct proxy_manager * This)
         LeaveCriticalSection(&This->parent->cs);
     }
 
+    proxy_manager_release_public_refs(This);
+
     /* destroy all of the interface proxies */
     while ((cursor = list_head(&This->interfaces)))
     {
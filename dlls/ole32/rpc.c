@@ -688,26 +688,17 @@ static HRESULT WINAPI ClientRpcChannelBuffer_GetBuffer(LPRPCCHANNELBUFFER iface,
                                   &message_state->params.iface);
     if (hr == S_OK)
     {
-        /* stub, chan, iface and iid are unneeded in multi-threaded case as we go
-         * via the RPC runtime */
-        if (apt->multi_threaded)
+        /* the object lives in this process, so the call is executed directly
+         * in the target apartment: on the thread pool for the multi-threaded
+         * apartment or on the apartment thread for single-threaded ones */
+        if (!apt->multi_threaded)
         {
-            IRpcStubBuffer_Release(message_state->params.stub);
-            message_state->params.stub = NULL;
-            IRpcChannelBuffer_Release(message_state->params.chan);
-            message_state->params.chan = NULL;
-            message_state->params.iface = NULL;
-        }
-        else
-        {
-            message_state->params.bypass_rpcrt = TRUE;
             message_state->target_hwnd = apartment_getwindow(apt);
             message_state->target_tid = apt->tid;
-            /* we assume later on that this being non-NULL is the indicator that
-             * means call directly instead of going through RPC runtime */
             if (!message_state->target_hwnd)
                 ERR("window for apartment %s is NULL\n", wine_dbgstr_longlong(apt->oxid));
         }
+        message_state->params.bypass_rpcrt = apt->multi_threaded || message_state->target_hwnd;
     }
     if (apt) apartment_release(apt);
     message_state->params.handle = ClientRpcChannelBuffer_GetEventHandle(This);
@@ -715,7 +706,7 @@ static HRESULT WINAPI ClientRpcChannelBuffer_GetBuffer(LPRPCCHANNELBUFFER iface,
      * ClientRpcChannelBuffer_SendReceive */
 
     /* shortcut the RPC runtime */
-    if (message_state->target_hwnd)
+    if (message_state->params.bypass_rpcrt)
     {
         msg->Buffer = HeapAlloc(GetProcessHeap(), 0, msg->BufferLength);
         if (msg->Buffer)
@@ -806,6 +797,27 @@ static DWORD WINAPI rpc_sendreceive_thread(LPVOID param)
     return 0;
 }
 
+/* this thread runs an in-process call to an object in the multi-threaded apartment */
+static DWORD WINAPI rpc_execute_mta_call_thread(LPVOID param)
+{
+    struct dispatch_params *data = param;
+    BOOL joined = FALSE;
+
+    if (!COM_CurrentInfo()->apt)
+    {
+        apartment_joinmta();
+        joined = TRUE;
+    }
+    RPC_ExecuteCall(data);
+    if (joined)
+    {
+        apartment_release(COM_CurrentInfo()->apt);
+        COM_CurrentInfo()->apt = NULL;
+    }
+
+    return 0;
+}
+
 static inline HRESULT ClientRpcChannelBuffer_IsCorrectApartment(ClientRpcChannelBuffer *This, APARTMENT *apt)
 {
     OXID oxid;
@@ -867,7 +879,21 @@ static HRESULT WINAPI ClientRpcChannelBuffer_SendReceive(LPRPCCHANNELBUFFER ifac
      * from DllMain */
 
     message_state->params.msg = olemsg;
-    if (message_state->params.bypass_rpcrt)
+    if (message_state->params.bypass_rpcrt && !message_state->target_hwnd)
+    {
+        TRACE("Calling multi-threaded apartment...\n");
+
+        msg->ProcNum &= ~RPC_FLAGS_VALID_BIT;
+
+        if (!QueueUserWorkItem(rpc_execute_mta_call_thread, &message_state->params, WT_EXECUTEDEFAULT))
+        {
+            ERR("QueueUserWorkItem failed with error %u\n", GetLastError());
+            hr = E_UNEXPECTED;
+        }
+        else
+            hr = S_OK;
+    }
+    else if (message_state->params.bypass_rpcrt)
     {
         TRACE("Calling apartment thread 0x%08x...\n", message_state->target_tid);
 
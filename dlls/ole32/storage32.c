@@ -3827,6 +3827,13 @@ static SmallBlockChainStream* Storage32Impl_BigBlocksToSmallBlocks(
     return SmallBlockChainStream_Construct(This, NULL, streamEntryRef);
 }
 
+enum depot_cache_state
+{
+  DEPOT_CACHE_EMPTY,
+  DEPOT_CACHE_VALID,
+  DEPOT_CACHE_DIRTY
+};
+
 /******************************************************************************
  *      Storage32Impl_AddBlockDepot
  *
@@ -3852,6 +3859,9 @@ static void Storage32Impl_AddBlockDepot(StorageImpl* This, ULONG blockIndex, ULO
   }
 
   StorageImpl_WriteBigBlock(This, blockIndex, blockBuffer);
+
+  if (depotIndex < This->blockDepotCacheSize)
+    This->blockDepotCacheState[depotIndex] = DEPOT_CACHE_EMPTY;
 }
 
 /******************************************************************************
@@ -3995,6 +4005,111 @@ static ULONG Storage32Impl_AddExtBlockDepot(StorageImpl* This)
   return index;
 }
 
+/******************************************************************************
+ *      StorageImpl_GetDepotCacheBlock
+ *
+ * Returns the cached entries of the specified depot block, reading the
+ * block if it isn't cached yet.
+ */
+static ULONG *StorageImpl_GetDepotCacheBlock(StorageImpl* This, ULONG depotIndex)
+{
+  ULONG blocksPerDepot = This->bigBlockSize / sizeof(ULONG);
+  BYTE depotBuffer[MAX_BIG_BLOCK_SIZE];
+  ULONG *entries;
+  ULONG read, depotBlockIndexPos, index;
+
+  if (depotIndex >= This->blockDepotCacheSize)
+  {
+    ULONG new_size = max(max(This->blockDepotCacheSize * 2, depotIndex + 1), 16);
+    ULONG *new_cache;
+    BYTE *new_state;
+
+    if (This->blockDepotCache)
+    {
+      new_cache = HeapReAlloc(GetProcessHeap(), 0, This->blockDepotCache,
+                              new_size * blocksPerDepot * sizeof(ULONG));
+      if (!new_cache) return NULL;
+      This->blockDepotCache = new_cache;
+      new_state = HeapReAlloc(GetProcessHeap(), HEAP_ZERO_MEMORY, This->blockDepotCacheState, new_size);
+    }
+    else
+    {
+      new_cache = HeapAlloc(GetProcessHeap(), 0, new_size * blocksPerDepot * sizeof(ULONG));
+      if (!new_cache) return NULL;
+      This->blockDepotCache = new_cache;
+      new_state = HeapAlloc(GetProcessHeap(), HEAP_ZERO_MEMORY, new_size);
+    }
+    if (!new_state) return NULL;
+    This->blockDepotCacheState = new_state;
+    This->blockDepotCacheSize = new_size;
+  }
+
+  entries = This->blockDepotCache + depotIndex * blocksPerDepot;
+
+  if (This->blockDepotCacheState[depotIndex] == DEPOT_CACHE_EMPTY)
+  {
+    if (depotIndex < COUNT_BBDEPOTINHEADER)
+      depotBlockIndexPos = This->bigBlockDepotStart[depotIndex];
+    else
+      depotBlockIndexPos = Storage32Impl_GetExtDepotBlock(This, depotIndex);
+
+    StorageImpl_ReadBigBlock(This, depotBlockIndexPos, depotBuffer, &read);
+    if (!read)
+      return NULL;
+
+    for (index = 0; index < blocksPerDepot; index++)
+      StorageUtl_ReadDWord(depotBuffer, index*sizeof(ULONG), &entries[index]);
+
+    This->blockDepotCacheState[depotIndex] = DEPOT_CACHE_VALID;
+  }
+
+  return entries;
+}
+
+/******************************************************************************
+ *      StorageImpl_FlushDepotCache
+ *
+ * Writes the modified depot blocks back to the file.
+ */
+static HRESULT StorageImpl_FlushDepotCache(StorageImpl* This)
+{
+  ULONG blocksPerDepot = This->bigBlockSize / sizeof(ULONG);
+  BYTE depotBuffer[MAX_BIG_BLOCK_SIZE];
+  ULONG depotIndex, depotBlockIndexPos, index;
+
+  for (depotIndex = 0; depotIndex < This->blockDepotCacheSize; depotIndex++)
+  {
+    const ULONG *entries = This->blockDepotCache + depotIndex * blocksPerDepot;
+
+    if (This->blockDepotCacheState[depotIndex] != DEPOT_CACHE_DIRTY)
+      continue;
+
+    if (depotIndex < COUNT_BBDEPOTINHEADER)
+      depotBlockIndexPos = This->bigBlockDepotStart[depotIndex];
+    else
+      depotBlockIndexPos = Storage32Impl_GetExtDepotBlock(This, depotIndex);
+
+    for (index = 0; index < blocksPerDepot; index++)
+      StorageUtl_WriteDWord(depotBuffer, index*sizeof(ULONG), entries[index]);
+
+    if (!StorageImpl_WriteBigBlock(This, depotBlockIndexPos, depotBuffer))
+      return STG_E_WRITEFAULT;
+
+    This->blockDepotCacheState[depotIndex] = DEPOT_CACHE_VALID;
+  }
+
+  return S_OK;
+}
+
+/******************************************************************************
+ *      StorageImpl_DiscardDepotCache
+ */
+static void StorageImpl_DiscardDepotCache(StorageImpl* This)
+{
+  if (This->blockDepotCacheState)
+    memset(This->blockDepotCacheState, DEPOT_CACHE_EMPTY, This->blockDepotCacheSize);
+}
+
 /************************************************************************
  * StorageImpl_GetNextBlockInChain
  *
@@ -4027,10 +4142,7 @@ static HRESULT StorageImpl_GetNextBlockInChain(
   ULONG offsetInDepot    = blockIndex * sizeof (ULONG);
   ULONG depotBlockCount  = offsetInDepot / This->bigBlockSize;
   ULONG depotBlockOffset = offsetInDepot % This->bigBlockSize;
-  BYTE depotBuffer[MAX_BIG_BLOCK_SIZE];
-  ULONG read;
-  ULONG depotBlockIndexPos;
-  int index, num_blocks;
+  ULONG *entries;
 
   *nextBlockIndex   = BLOCK_SPECIAL;
 
@@ -4041,40 +4153,10 @@ static HRESULT StorageImpl_GetNextBlockInChain(
     return STG_E_READFAULT;
   }
 
-  /*
-   * Cache the currently accessed depot block.
-   */
-  if (depotBlockCount != This->indexBlockDepotCached)
-  {
-    This->indexBlockDepotCached = depotBlockCount;
-
-    if (depotBlockCount < COUNT_BBDEPOTINHEADER)
-    {
-      depotBlockIndexPos = This->bigBlockDepotStart[depotBlockCount];
-    }
-    else
-    {
-      /*
-       * We have to look in the extended depot.
-       */
-      depotBlockIndexPos = Storage32Impl_GetExtDepotBlock(This, depotBlockCount);
-    }
-
-    StorageImpl_ReadBigBlock(This, depotBlockIndexPos, depotBuffer, &read);
-
-    if (!read)
-      return STG_E_READFAULT;
-
-    num_blocks = This->bigBlockSize / 4;
-
-    for (index = 0; index < num_blocks; index++)
-    {
-      StorageUtl_ReadDWord(depotBuffer, index*sizeof(ULONG), nextBlockIndex);
-      This->blockDepotCached[index] = *nextBlockIndex;
-    }
-  }
+  if (!(entries = StorageImpl_GetDepotCacheBlock(This, depotBlockCount)))
+    return STG_E_READFAULT;
 
-  *nextBlockIndex = This->blockDepotCached[depotBlockOffset/sizeof(ULONG)];
+  *nextBlockIndex = entries[depotBlockOffset/sizeof(ULONG)];
 
   return S_OK;
 }
@@ -4128,6 +4210,7 @@ static void StorageImpl_SetNextBlockInChain(
   ULONG depotBlockCount  = offsetInDepot / This->bigBlockSize;
   ULONG depotBlockOffset = offsetInDepot % This->bigBlockSize;
   ULONG depotBlockIndexPos;
+  ULONG *entries;
 
   assert(depotBlockCount < This->bigBlockDepotCount);
   assert(blockIndex != nextBlock);
@@ -4139,6 +4222,16 @@ static void StorageImpl_SetNextBlockInChain(
      * happens in a newly-created file. */
     ERR("Using range lock page\n");
 
+  /*
+   * Update the cached block depot, it is written back on flush.
+   */
+  if ((entries = StorageImpl_GetDepotCacheBlock(This, depotBlockCount)))
+  {
+    entries[depotBlockOffset/sizeof(ULONG)] = nextBlock;
+    This->blockDepotCacheState[depotBlockCount] = DEPOT_CACHE_DIRTY;
+    return;
+  }
+
   if (depotBlockCount < COUNT_BBDEPOTINHEADER)
   {
     depotBlockIndexPos = This->bigBlockDepotStart[depotBlockCount];
@@ -4153,13 +4246,6 @@ static void StorageImpl_SetNextBlockInChain(
 
   StorageImpl_WriteDWordToBigBlock(This, depotBlockIndexPos, depotBlockOffset,
                         nextBlock);
-  /*
-   * Update the cached block depot, if necessary.
-   */
-  if (depotBlockCount == This->indexBlockDepotCached)
-  {
-    This->blockDepotCached[depotBlockOffset/sizeof(ULONG)] = nextBlock;
-  }
 }
 
 /******************************************************************************
@@ -4173,13 +4259,12 @@ static ULONG StorageImpl_GetNextFreeBigBlock(
   StorageImpl* This)
 {
   ULONG depotBlockIndexPos;
-  BYTE depotBuffer[MAX_BIG_BLOCK_SIZE];
+  const ULONG *entries;
   ULONG depotBlockOffset;
   ULONG blocksPerDepot    = This->bigBlockSize / sizeof(ULONG);
   ULONG nextBlockIndex    = BLOCK_SPECIAL;
   int   depotIndex        = 0;
   ULONG freeBlock         = BLOCK_UNUSED;
-  ULONG read;
   ULARGE_INTEGER neededSize;
   STATSTG statstg;
 
@@ -4269,14 +4354,12 @@ static ULONG StorageImpl_GetNextFreeBigBlock(
       }
     }
 
-    StorageImpl_ReadBigBlock(This, depotBlockIndexPos, depotBuffer, &read);
-
-    if (read)
+    if ((entries = StorageImpl_GetDepotCacheBlock(This, depotIndex)))
     {
       while ( ( (depotBlockOffset/sizeof(ULONG) ) < blocksPerDepot) &&
               ( nextBlockIndex != BLOCK_UNUSED))
       {
-        StorageUtl_ReadDWord(depotBuffer, depotBlockOffset, &nextBlockIndex);
+        nextBlockIndex = entries[depotBlockOffset/sizeof(ULONG)];
 
         if (nextBlockIndex == BLOCK_UNUSED)
         {
@@ -4693,7 +4776,7 @@ static HRESULT StorageImpl_Refresh(StorageImpl *This, BOOL new_object, BOOL crea
   /*
    * There is no block depot cached yet.
    */
-  This->indexBlockDepotCached = 0xFFFFFFFF;
+  StorageImpl_DiscardDepotCache(This);
   This->indexExtBlockDepotCached = 0xFFFFFFFF;
 
   /*
@@ -5169,6 +5252,9 @@ static HRESULT StorageImpl_Flush(StorageBaseImpl *storage)
     if (This->blockChainCache[i])
       hr = BlockChainStream_Flush(This->blockChainCache[i]);
 
+  if (SUCCEEDED(hr))
+    hr = StorageImpl_FlushDepotCache(This);
+
   if (SUCCEEDED(hr))
     hr = ILockBytes_Flush(This->lockBytes);
 
@@ -5195,6 +5281,8 @@ static void StorageImpl_Destroy(StorageBaseImpl* iface)
   StorageImpl_Invalidate(iface);
 
   HeapFree(GetProcessHeap(), 0, This->extBigBlockDepotLocations);
+  HeapFree(GetProcessHeap(), 0, This->blockDepotCache);
+  HeapFree(GetProcessHeap(), 0, This->blockDepotCacheState);
 
   BlockChainStream_Destroy(This->smallBlockRootChain);
   BlockChainStream_Destroy(This->rootBlockChain);
@@ -7212,6 +7300,31 @@ static ULONG BlockChainStream_GetSectorOfOffset(BlockChainStream *This, ULONG of
   return This->indexCache[min_run].firstSector + offset - This->indexCache[min_run].firstOffset;
 }
 
+/******************************************************************************
+ *      BlockChainStream_GetContiguousBlocks
+ *
+ * Returns how many of the at most max_blocks blocks following the block at
+ * index are stored in the sectors directly after sector and are not cached,
+ * so they can be transferred together with it.
+ */
+static ULONG BlockChainStream_GetContiguousBlocks(BlockChainStream *This,
+    ULONG index, ULONG sector, ULONG max_blocks)
+{
+  ULONG count;
+
+  for (count = 0; count < max_blocks; count++)
+  {
+    ULONG next = index + count + 1;
+
+    if (This->cachedBlocks[0].index == next || This->cachedBlocks[1].index == next)
+      break;
+    if (BlockChainStream_GetSectorOfOffset(This, next) != sector + count + 1)
+      break;
+  }
+
+  return count;
+}
+
 static HRESULT BlockChainStream_GetBlockAtOffset(BlockChainStream *This,
     ULONG index, BlockChainBlock **block, ULONG *sector, BOOL create)
 {
@@ -7654,7 +7767,14 @@ HRESULT BlockChainStream_ReadAt(BlockChainStream* This,
 
     if (!cachedBlock)
     {
-      /* Not in cache, and we're going to read past the end of the block. */
+      /* Not in cache, and we're going to read past the end of the block.
+       * Read the following full blocks too if they are contiguous. */
+      ULONG extra = BlockChainStream_GetContiguousBlocks(This, blockNoInSequence, blockIndex,
+          (size - bytesToReadInBuffer - 1) / This->parentStorage->bigBlockSize);
+
+      bytesToReadInBuffer += extra * This->parentStorage->bigBlockSize;
+      blockNoInSequence += extra;
+
       ulOffset.QuadPart = StorageImpl_GetBigBlockOffset(This->parentStorage, blockIndex) +
                                offsetInBlock;
 
@@ -7738,7 +7858,14 @@ HRESULT BlockChainStream_WriteAt(BlockChainStream* This,
 
     if (!cachedBlock)
     {
-      /* Not in cache, and we're going to write past the end of the block. */
+      /* Not in cache, and we're going to write past the end of the block.
+       * Write the following full blocks too if they are contiguous. */
+      ULONG extra = BlockChainStream_GetContiguousBlocks(This, blockNoInSequence, blockIndex,
+          (size - bytesToWrite - 1) / This->parentStorage->bigBlockSize);
+
+      bytesToWrite += extra * This->parentStorage->bigBlockSize;
+      blockNoInSequence += extra;
+
       ulOffset.QuadPart = StorageImpl_GetBigBlockOffset(This->parentStorage, blockIndex) +
                                offsetInBlock;
 
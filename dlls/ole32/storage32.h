@@ -393,8 +393,11 @@ struct StorageImpl
   ULONG extBlockDepotCached[MAX_BIG_BLOCK_SIZE / 4];
   ULONG indexExtBlockDepotCached;
 
-  ULONG blockDepotCached[MAX_BIG_BLOCK_SIZE / 4];
-  ULONG indexBlockDepotCached;
+  /* Cache of the big block depot, filled one depot block at a time.
+   * Changes are written back when the storage is flushed. */
+  ULONG *blockDepotCache;
+  BYTE  *blockDepotCacheState;
+  ULONG blockDepotCacheSize;
   ULONG prevFreeBlock;
 
   /* All small blocks before this one are known to be in use. */
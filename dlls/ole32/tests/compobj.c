@@ -2190,6 +2190,85 @@ exit:
     RegCloseKey(clsidkey);
 }
 
+static void test_class_registration_changes(void)
+{
+    static const GUID clsid = {0xdeadbeef,0xdead,0xbeef,{0xde,0xad,0xbe,0xef,0xde,0xad,0xbe,0xf0}};
+    static const char clsidA[] = "{DEADBEEF-DEAD-BEEF-DEAD-BEEFDEADBEF0}";
+    IUnknown *unk;
+    HKEY clsidkey, hkey;
+    HRESULT hr;
+    LONG lr;
+
+    CoInitialize(NULL);
+
+    hr = CoGetClassObject(&clsid, CLSCTX_INPROC_SERVER, NULL, &IID_IClassFactory, (void **)&unk);
+    ok(hr == REGDB_E_CLASSNOTREG, "got 0x%08x\n", hr);
+
+    lr = RegOpenKeyExA(HKEY_CLASSES_ROOT, "CLSID", 0, KEY_READ, &clsidkey);
+    ok(!lr, "Couldn't open CLSID key, error %d\n", lr);
+    lr = RegCreateKeyExA(clsidkey, clsidA, 0, NULL, 0, KEY_WRITE, NULL, &hkey, NULL);
+    if (lr)
+    {
+        win_skip("failed to create a test key, error %d\n", lr);
+        RegCloseKey(clsidkey);
+        CoUninitialize();
+        return;
+    }
+    RegCloseKey(hkey);
+
+    /* the class is registered, but not as an in-process server */
+    hr = CoGetClassObject(&clsid, CLSCTX_INPROC_SERVER, NULL, &IID_IClassFactory, (void **)&unk);
+    ok(hr == REGDB_E_CLASSNOTREG, "got 0x%08x\n", hr);
+
+    lr = RegCreateKeyExA(clsidkey, "{DEADBEEF-DEAD-BEEF-DEAD-BEEFDEADBEF0}\\InprocServer32", 0, NULL, 0,
+                         KEY_WRITE, NULL, &hkey, NULL);
+    ok(!lr, "RegCreateKeyEx returned %d\n", lr);
+    lr = RegSetValueExA(hkey, NULL, 0, REG_SZ, (const BYTE *)"ole32.dll", sizeof("ole32.dll"));
+    ok(!lr, "RegSetValueEx returned %d\n", lr);
+    lr = RegSetValueExA(hkey, "ThreadingModel", 0, REG_SZ, (const BYTE *)"Both", sizeof("Both"));
+    ok(!lr, "RegSetValueEx returned %d\n", lr);
+    RegCloseKey(hkey);
+
+    /* the new registration is used right away, ole32 doesn't implement the class */
+    hr = CoGetClassObject(&clsid, CLSCTX_INPROC_SERVER, NULL, &IID_IClassFactory, (void **)&unk);
+    ok(hr == CLASS_E_CLASSNOTAVAILABLE, "got 0x%08x\n", hr);
+    hr = CoGetClassObject(&clsid, CLSCTX_INPROC_SERVER, NULL, &IID_IClassFactory, (void **)&unk);
+    ok(hr == CLASS_E_CLASSNOTAVAILABLE, "got 0x%08x\n", hr);
+
+    lr = RegDeleteKeyA(clsidkey, "{DEADBEEF-DEAD-BEEF-DEAD-BEEFDEADBEF0}\\InprocServer32");
+    ok(!lr, "RegDeleteKey returned %d\n", lr);
+
+    hr = CoGetClassObject(&clsid, CLSCTX_INPROC_SERVER, NULL, &IID_IClassFactory, (void **)&unk);
+    ok(hr == REGDB_E_CLASSNOTREG, "got 0x%08x\n", hr);
+
+    RegDeleteKeyA(clsidkey, clsidA);
+    RegCloseKey(clsidkey);
+    CoUninitialize();
+}
+
+static void benchmark_CoCreateInstance(void)
+{
+    IUnknown *unk;
+    DWORD start;
+    HRESULT hr;
+    int i;
+
+    CoInitialize(NULL);
+
+    start = GetTickCount();
+    for (i = 0; i < 1000000; i++)
+    {
+        hr = CoCreateInstance(&CLSID_InternetZoneManager, NULL, CLSCTX_INPROC_SERVER,
+                              &IID_IUnknown, (void **)&unk);
+        if (FAILED(hr)) break;
+        IUnknown_Release(unk);
+    }
+    ok(hr == S_OK, "got 0x%08x\n", hr);
+    trace("1000000 CoCreateInstance calls: %u ms\n", GetTickCount() - start);
+
+    CoUninitialize();
+}
+
 static void test_CoInitializeEx(void)
 {
     HRESULT hr;
@@ -3569,6 +3648,7 @@ START_TEST(compobj)
     test_CoGetCallContext();
     test_CoGetContextToken();
     test_TreatAsClass();
+    test_class_registration_changes();
     test_CoInitializeEx();
     test_OleInitialize_InitCounting();
     test_OleRegGetMiscStatus();
@@ -3581,4 +3661,7 @@ START_TEST(compobj)
     test_CoGetCurrentLogicalThreadId();
     test_IInitializeSpy();
     test_CoGetInstanceFromFile();
+
+    if (winetest_interactive)
+        benchmark_CoCreateInstance();
 }
@@ -962,6 +962,97 @@ static void test_marshal_proxy_mta_apartment_shutdown(void)
     pCoInitializeEx(NULL, COINIT_APARTMENTTHREADED);
 }
 
+struct mta_host_data
+{
+    IStream *stream;
+    HANDLE marshal_event;
+    HANDLE done_event;
+};
+
+static DWORD CALLBACK mta_host_object_proc(LPVOID p)
+{
+    struct mta_host_data *data = p;
+    HRESULT hr;
+
+    pCoInitializeEx(NULL, COINIT_MULTITHREADED);
+
+    hr = CoMarshalInterface(data->stream, &IID_IClassFactory, (IUnknown*)&Test_ClassFactory, MSHCTX_INPROC, NULL, MSHLFLAGS_NORMAL);
+    ok_ole_success(hr, CoMarshalInterface);
+
+    SetEvent(data->marshal_event);
+    ok( !WaitForSingleObject(data->done_event, 10000), "wait timed out\n" );
+
+    CoUninitialize();
+
+    return 0;
+}
+
+static HANDLE start_mta_host_object(IStream *stream, HANDLE done_event)
+{
+    struct mta_host_data data;
+    HANDLE thread;
+
+    data.stream = stream;
+    data.marshal_event = CreateEventA(NULL, FALSE, FALSE, NULL);
+    data.done_event = done_event;
+
+    thread = CreateThread(NULL, 0, mta_host_object_proc, &data, 0, NULL);
+
+    /* wait for marshaling to complete before returning */
+    ok( !WaitForSingleObject(data.marshal_event, 10000), "wait timed out\n" );
+    CloseHandle(data.marshal_event);
+
+    return thread;
+}
+
+/* tests calls from a single-threaded apartment to an object living in the
+ * multi-threaded apartment of the same process */
+static void test_call_to_mta_object(void)
+{
+    HRESULT hr;
+    IStream *pStream = NULL;
+    IClassFactory *cf = NULL;
+    IUnknown *object = NULL;
+    IMultiQI *mqi = NULL;
+    HANDLE thread, done_event;
+
+    cLocks = 0;
+
+    hr = CreateStreamOnHGlobal(NULL, TRUE, &pStream);
+    ok_ole_success(hr, CreateStreamOnHGlobal);
+
+    done_event = CreateEventA(NULL, FALSE, FALSE, NULL);
+    thread = start_mta_host_object(pStream, done_event);
+
+    ok_more_than_one_lock();
+
+    IStream_Seek(pStream, ullZero, STREAM_SEEK_SET, NULL);
+    hr = CoUnmarshalInterface(pStream, &IID_IClassFactory, (void **)&cf);
+    ok_ole_success(hr, CoUnmarshalInterface);
+    IStream_Release(pStream);
+
+    hr = IClassFactory_LockServer(cf, TRUE);
+    ok_ole_success(hr, IClassFactory_LockServer);
+
+    hr = IClassFactory_CreateInstance(cf, NULL, &IID_IUnknown, (void **)&object);
+    ok_ole_success(hr, IClassFactory_CreateInstance);
+
+    hr = IUnknown_QueryInterface(object, &IID_IMultiQI, (void **)&mqi);
+    ok(hr == S_OK, "object returned from the multi-threaded apartment is not a proxy\n");
+    if (hr == S_OK)
+        IMultiQI_Release(mqi);
+    IUnknown_Release(object);
+
+    IClassFactory_Release(cf);
+
+    ok_no_locks();
+
+    SetEvent(done_event);
+    ok( !WaitForSingleObject(thread, 10000), "wait timed out\n" );
+    CloseHandle(thread);
+    CloseHandle(done_event);
+}
+
 struct ncu_params
 {
     LPSTREAM stream;
@@ -3684,6 +3775,63 @@ static const IChannelHookVtbl TestChannelHookVtbl =
 
 static IChannelHook TestChannelHook = { &TestChannelHookVtbl };
 
+static void benchmark_calls(const char *name, IClassFactory *cf)
+{
+    DWORD start, elapsed;
+    HRESULT hr = S_OK;
+    int i, count = 100000;
+
+    start = GetTickCount();
+    for (i = 0; i < count && hr == S_OK; i++)
+        hr = IClassFactory_LockServer(cf, TRUE);
+    elapsed = max(GetTickCount() - start, 1);
+    ok_ole_success(hr, IClassFactory_LockServer);
+
+    trace("%s: %d calls in %u ms, %u calls/s\n", name, count, elapsed, (DWORD)(count * 1000.0 / elapsed));
+}
+
+static void benchmark_cross_apartment_calls(void)
+{
+    IStream *pStream = NULL;
+    IClassFactory *cf = NULL;
+    HANDLE thread, done_event;
+    HRESULT hr;
+    DWORD tid;
+
+    hr = CreateStreamOnHGlobal(NULL, TRUE, &pStream);
+    ok_ole_success(hr, CreateStreamOnHGlobal);
+    tid = start_host_object(pStream, &IID_IClassFactory, (IUnknown*)&Test_ClassFactory, MSHLFLAGS_NORMAL, &thread);
+
+    IStream_Seek(pStream, ullZero, STREAM_SEEK_SET, NULL);
+    hr = CoUnmarshalInterface(pStream, &IID_IClassFactory, (void **)&cf);
+    ok_ole_success(hr, CoUnmarshalInterface);
+    IStream_Release(pStream);
+
+    benchmark_calls("STA to STA", cf);
+
+    IClassFactory_Release(cf);
+    end_host_object(tid, thread);
+
+    hr = CreateStreamOnHGlobal(NULL, TRUE, &pStream);
+    ok_ole_success(hr, CreateStreamOnHGlobal);
+    done_event = CreateEventA(NULL, FALSE, FALSE, NULL);
+    thread = start_mta_host_object(pStream, done_event);
+
+    IStream_Seek(pStream, ullZero, STREAM_SEEK_SET, NULL);
+    hr = CoUnmarshalInterface(pStream, &IID_IClassFactory, (void **)&cf);
+    ok_ole_success(hr, CoUnmarshalInterface);
+    IStream_Release(pStream);
+
+    benchmark_calls("STA to MTA", cf);
+
+    IClassFactory_Release(cf);
+
+    SetEvent(done_event);
+    ok( !WaitForSingleObject(thread, 10000), "wait timed out\n" );
+    CloseHandle(thread);
+    CloseHandle(done_event);
+}
+
 static void test_channel_hook(void)
 {
     IStream *pStream = NULL;
@@ -3798,6 +3946,7 @@ START_TEST(marshal)
 
     test_hresult_marshaling();
     test_proxy_used_in_wrong_thread();
+    test_call_to_mta_object();
     test_message_filter();
     test_bad_marshal_stream();
     test_proxy_interfaces();
@@ -3817,6 +3966,9 @@ START_TEST(marshal)
     test_manualresetevent();
     test_crash_couninitialize();
 
+    if (winetest_interactive)
+        benchmark_cross_apartment_calls();
+
     /* must be last test as channel hooks can't be unregistered */
     test_channel_hook();
 
@@ -3919,6 +3919,181 @@ static void test_custom_lockbytes(void)
     DeleteTestLockBytes(lockbytes);
 }
 
+static void fill_test_pattern(BYTE *buffer, ULONG size, ULONG offset, BYTE seed)
+{
+    ULONG i;
+
+    for (i = 0; i < size; i++)
+        buffer[i] = (BYTE)((offset + i) * 7 + (offset + i) / 251 + seed);
+}
+
+static void test_large_stream(void)
+{
+    static const WCHAR stmname[] = { 'C','O','N','T','E','N','T','S',0 };
+    static const WCHAR stmname2[] = { 'C','O','N','T','E','N','T','2',0 };
+    static const ULONG stream_size = 2 * 1024 * 1024 + 123;
+    IStorage *stg = NULL;
+    IStream *stm = NULL, *stm2 = NULL;
+    BYTE *buffer, *expected;
+    ULONG offset, chunk, count;
+    LARGE_INTEGER pos;
+    HRESULT r;
+
+    buffer = HeapAlloc(GetProcessHeap(), 0, 65536);
+    expected = HeapAlloc(GetProcessHeap(), 0, 65536);
+
+    DeleteFileA(filenameA);
+
+    r = StgCreateDocfile(filename, STGM_CREATE | STGM_READWRITE | STGM_SHARE_EXCLUSIVE, 0, &stg);
+    ok(r==S_OK, "StgCreateDocfile failed %x\n", r);
+
+    r = IStorage_CreateStream(stg, stmname, STGM_SHARE_EXCLUSIVE | STGM_READWRITE, 0, 0, &stm);
+    ok(r==S_OK, "IStorage->CreateStream failed %x\n", r);
+
+    r = IStorage_CreateStream(stg, stmname2, STGM_SHARE_EXCLUSIVE | STGM_READWRITE, 0, 0, &stm2);
+    ok(r==S_OK, "IStorage->CreateStream failed %x\n", r);
+
+    /* Interleave the writes so that both block chains are fragmented. */
+    for (offset = 0; offset < stream_size; offset += chunk)
+    {
+        chunk = min(stream_size - offset, offset % 3 ? 65536 : 5000);
+
+        fill_test_pattern(buffer, chunk, offset, 1);
+        r = IStream_Write(stm, buffer, chunk, &count);
+        ok(r==S_OK, "IStream->Write failed %x\n", r);
+        ok(count == chunk, "wrote %u bytes, expected %u\n", count, chunk);
+
+        fill_test_pattern(buffer, chunk, offset, 2);
+        r = IStream_Write(stm2, buffer, chunk, &count);
+        ok(r==S_OK, "IStream->Write failed %x\n", r);
+    }
+
+    IStream_Release(stm2);
+    IStream_Release(stm);
+    IStorage_Release(stg);
+
+    r = StgOpenStorage(filename, NULL, STGM_READ | STGM_SHARE_EXCLUSIVE, NULL, 0, &stg);
+    ok(r==S_OK, "StgOpenStorage failed %x\n", r);
+
+    r = IStorage_OpenStream(stg, stmname, NULL, STGM_SHARE_EXCLUSIVE | STGM_READ, 0, &stm);
+    ok(r==S_OK, "IStorage->OpenStream failed %x\n", r);
+
+    for (offset = 0; offset < stream_size; offset += count)
+    {
+        chunk = offset % 2 ? 65536 : 10000;
+
+        r = IStream_Read(stm, buffer, chunk, &count);
+        ok(r==S_OK, "IStream->Read failed %x\n", r);
+        ok(count == min(chunk, stream_size - offset), "read %u bytes at %u\n", count, offset);
+        if (!count) break;
+
+        fill_test_pattern(expected, count, offset, 1);
+        if (memcmp(buffer, expected, count))
+        {
+            ok(0, "unexpected data at offset %u\n", offset);
+            break;
+        }
+    }
+    ok(offset == stream_size, "read %u bytes\n", offset);
+
+    /* Reads straddling block boundaries. */
+    pos.QuadPart = 511;
+    r = IStream_Seek(stm, pos, STREAM_SEEK_SET, NULL);
+    ok(r==S_OK, "IStream->Seek failed %x\n", r);
+
+    r = IStream_Read(stm, buffer, 65536, &count);
+    ok(r==S_OK, "IStream->Read failed %x\n", r);
+    ok(count == 65536, "read %u bytes\n", count);
+    fill_test_pattern(expected, count, 511, 1);
+    ok(!memcmp(buffer, expected, count), "unexpected data\n");
+
+    IStream_Release(stm);
+
+    r = IStorage_OpenStream(stg, stmname2, NULL, STGM_SHARE_EXCLUSIVE | STGM_READ, 0, &stm);
+    ok(r==S_OK, "IStorage->OpenStream failed %x\n", r);
+
+    pos.QuadPart = stream_size - 70000;
+    r = IStream_Seek(stm, pos, STREAM_SEEK_SET, NULL);
+    ok(r==S_OK, "IStream->Seek failed %x\n", r);
+
+    r = IStream_Read(stm, buffer, 65536, &count);
+    ok(r==S_OK, "IStream->Read failed %x\n", r);
+    ok(count == 65536, "read %u bytes\n", count);
+    fill_test_pattern(expected, count, stream_size - 70000, 2);
+    ok(!memcmp(buffer, expected, count), "unexpected data\n");
+
+    IStream_Release(stm);
+    IStorage_Release(stg);
+
+    HeapFree(GetProcessHeap(), 0, expected);
+    HeapFree(GetProcessHeap(), 0, buffer);
+
+    DeleteFileA(filenameA);
+}
+
+static void benchmark_large_file(DWORD mode)
+{
+    static const WCHAR stmname[] = { 'C','O','N','T','E','N','T','S',0 };
+    static const ULONG file_size = 500 * 1024 * 1024, chunk = 1024 * 1024;
+    IStorage *stg = NULL;
+    IStream *stm = NULL;
+    DWORD start, elapsed;
+    ULONG offset, count;
+    BYTE *buffer;
+    HRESULT r;
+
+    buffer = HeapAlloc(GetProcessHeap(), 0, chunk);
+    fill_test_pattern(buffer, chunk, 0, 0);
+
+    DeleteFileA(filenameA);
+
+    start = GetTickCount();
+
+    r = StgCreateDocfile(filename, STGM_CREATE | STGM_READWRITE | STGM_SHARE_EXCLUSIVE | mode, 0, &stg);
+    ok(r==S_OK, "StgCreateDocfile failed %x\n", r);
+
+    r = IStorage_CreateStream(stg, stmname, STGM_SHARE_EXCLUSIVE | STGM_READWRITE, 0, 0, &stm);
+    ok(r==S_OK, "IStorage->CreateStream failed %x\n", r);
+
+    for (offset = 0; SUCCEEDED(r) && offset < file_size; offset += chunk)
+        r = IStream_Write(stm, buffer, chunk, &count);
+    ok(r==S_OK, "IStream->Write failed %x\n", r);
+
+    IStream_Release(stm);
+
+    r = IStorage_Commit(stg, STGC_DEFAULT);
+    ok(r==S_OK, "IStorage->Commit failed %x\n", r);
+
+    IStorage_Release(stg);
+
+    elapsed = max(GetTickCount() - start, 1);
+    trace("%s: wrote %u MB in %u ms, %u MB/s\n", mode ? "transacted" : "direct",
+          file_size >> 20, elapsed, (file_size >> 20) * 1000 / elapsed);
+
+    start = GetTickCount();
+
+    r = StgOpenStorage(filename, NULL, STGM_READ | STGM_SHARE_EXCLUSIVE, NULL, 0, &stg);
+    ok(r==S_OK, "StgOpenStorage failed %x\n", r);
+
+    r = IStorage_OpenStream(stg, stmname, NULL, STGM_SHARE_EXCLUSIVE | STGM_READ, 0, &stm);
+    ok(r==S_OK, "IStorage->OpenStream failed %x\n", r);
+
+    for (offset = 0; SUCCEEDED(r) && offset < file_size; offset += chunk)
+        r = IStream_Read(stm, buffer, chunk, &count);
+    ok(r==S_OK, "IStream->Read failed %x\n", r);
+
+    IStream_Release(stm);
+    IStorage_Release(stg);
+
+    elapsed = max(GetTickCount() - start, 1);
+    trace("%s: read %u MB in %u ms, %u MB/s\n", mode ? "transacted" : "direct",
+          file_size >> 20, elapsed, (file_size >> 20) * 1000 / elapsed);
+
+    HeapFree(GetProcessHeap(), 0, buffer);
+
+    DeleteFileA(filenameA);
+}
+
 START_TEST(storage32)
 {
     CHAR temp[MAX_PATH];
@@ -3968,4 +4143,11 @@ START_TEST(storage32)
     test_transacted_shared();
     test_overwrite();
     test_custom_lockbytes();
+    test_large_stream();
+
+    if (winetest_interactive)
+    {
+        benchmark_large_file(0);
+        benchmark_large_file(STGM_TRANSACTED);
+    }
 }
@@ -110,6 +110,29 @@ typedef struct {
 
 static bstr_cache_entry_t bstr_cache[0x10000/BUCKET_SIZE];
 
+/* Each thread keeps the strings it frees in its own small cache, in front of
+ * the shared one, so that most allocations don't need to take cs_bstr_cache.
+ * Only strings up to 1 KB are kept; the depth of a bucket grows when the
+ * thread keeps missing it. */
+#define THREAD_CACHE_BUCKETS 64
+#define THREAD_CACHE_MAX_DEPTH 32
+
+typedef struct {
+    unsigned short head;
+    unsigned short cnt;
+    unsigned short depth;
+    unsigned short misses;
+    bstr_t *buf[THREAD_CACHE_MAX_DEPTH];
+} bstr_thread_cache_entry_t;
+
+static DWORD bstr_thread_cache_tls = TLS_OUT_OF_INDEXES;
+
+/* A cached string is marked in the last DWORD of its bucket, after the
+ * terminating null, so that freeing it again is noticed whichever cache
+ * holds it.  Strings that leave no room for the mark are only kept in the
+ * shared cache, which is searched instead. */
+static DWORD bstr_cache_cookie;
+
 static inline size_t bstr_alloc_size(size_t size)
 {
     return (FIELD_OFFSET(bstr_t, u.ptr[size]) + sizeof(WCHAR) + BUCKET_SIZE-1) & ~(BUCKET_SIZE-1);
@@ -127,32 +150,121 @@ static inline bstr_cache_entry_t *get_cache_entry_from_idx(unsigned cache_idx)
         : NULL;
 }
 
-static inline bstr_cache_entry_t *get_cache_entry(size_t size)
+static inline unsigned get_cache_idx(size_t size)
 {
-    unsigned cache_idx = FIELD_OFFSET(bstr_t, u.ptr[size+sizeof(WCHAR)-1])/BUCKET_SIZE;
-    return get_cache_entry_from_idx(cache_idx);
+    return FIELD_OFFSET(bstr_t, u.ptr[size+sizeof(WCHAR)-1])/BUCKET_SIZE;
 }
 
-static inline bstr_cache_entry_t *get_cache_entry_from_alloc_size(SIZE_T alloc_size)
+static inline DWORD *get_cache_mark(bstr_t *bstr, unsigned cache_idx)
 {
-    unsigned cache_idx;
-    if (alloc_size < BUCKET_SIZE) return NULL;
-    cache_idx = (alloc_size - BUCKET_SIZE) / BUCKET_SIZE;
-    return get_cache_entry_from_idx(cache_idx);
+    size_t pos = (cache_idx+1)*BUCKET_SIZE - sizeof(DWORD);
+
+    if (bstr->size > pos || FIELD_OFFSET(bstr_t, u.ptr[bstr->size]) + sizeof(WCHAR) > pos)
+        return NULL;
+    return (DWORD *)((char *)bstr + pos);
+}
+
+static inline DWORD get_cache_mark_value(bstr_t *bstr)
+{
+    return (DWORD)(ULONG_PTR)bstr ^ bstr_cache_cookie;
+}
+
+static inline bstr_thread_cache_entry_t *get_thread_cache_entry(unsigned cache_idx, BOOL create)
+{
+    bstr_thread_cache_entry_t *cache;
+    unsigned i;
+
+    if (!bstr_cache_enabled || cache_idx >= THREAD_CACHE_BUCKETS ||
+        bstr_thread_cache_tls == TLS_OUT_OF_INDEXES)
+        return NULL;
+
+    cache = TlsGetValue(bstr_thread_cache_tls);
+    if (!cache && create)
+    {
+        cache = HeapAlloc(GetProcessHeap(), HEAP_ZERO_MEMORY, THREAD_CACHE_BUCKETS * sizeof(*cache));
+        if (!cache)
+            return NULL;
+        for (i = 0; i < THREAD_CACHE_BUCKETS; i++)
+            cache[i].depth = BUCKET_BUFFER_SIZE;
+        TlsSetValue(bstr_thread_cache_tls, cache);
+    }
+    return cache ? cache + cache_idx : NULL;
+}
+
+static inline bstr_t *thread_cache_pop(bstr_thread_cache_entry_t *entry)
+{
+    bstr_t *ret = entry->buf[entry->head++];
+    entry->head %= THREAD_CACHE_MAX_DEPTH;
+    entry->cnt--;
+    return ret;
+}
+
+/* move the strings cached by the current thread to the shared cache */
+static void free_thread_cache(void)
+{
+    bstr_thread_cache_entry_t *cache;
+    bstr_cache_entry_t *cache_entry;
+    bstr_t *bstr;
+    unsigned i;
+
+    if (bstr_thread_cache_tls == TLS_OUT_OF_INDEXES ||
+        !(cache = TlsGetValue(bstr_thread_cache_tls)))
+        return;
+
+    EnterCriticalSection(&cs_bstr_cache);
+    for (i = 0; i < THREAD_CACHE_BUCKETS; i++)
+    {
+        cache_entry = get_cache_entry_from_idx(i);
+        while (cache[i].cnt)
+        {
+            bstr = thread_cache_pop(&cache[i]);
+            if (cache_entry && cache_entry->cnt < BUCKET_BUFFER_SIZE)
+            {
+                cache_entry->buf[(cache_entry->head+cache_entry->cnt) % BUCKET_BUFFER_SIZE] = bstr;
+                cache_entry->cnt++;
+            }
+            else
+                CoTaskMemFree(bstr);
+        }
+    }
+    LeaveCriticalSection(&cs_bstr_cache);
+
+    HeapFree(GetProcessHeap(), 0, cache);
+    TlsSetValue(bstr_thread_cache_tls, NULL);
 }
 
 static bstr_t *alloc_bstr(size_t size)
 {
-    bstr_cache_entry_t *cache_entry = get_cache_entry(size);
-    bstr_t *ret;
+    unsigned cache_idx = get_cache_idx(size);
+    bstr_thread_cache_entry_t *thread_entry = get_thread_cache_entry(cache_idx, FALSE);
+    bstr_cache_entry_t *cache_entry;
+    unsigned ret_idx = cache_idx;
+    bstr_t *ret = NULL;
+    DWORD *mark;
+
+    if(thread_entry) {
+        bstr_thread_cache_entry_t *next_entry;
+
+        if(thread_entry->cnt)
+            ret = thread_cache_pop(thread_entry);
+        else if((next_entry = get_thread_cache_entry(cache_idx+1, FALSE)) && next_entry->cnt) {
+            ret = thread_cache_pop(next_entry);
+            ret_idx = cache_idx+1;
+        }
+        else if(++thread_entry->misses >= thread_entry->depth) {
+            thread_entry->depth = min(thread_entry->depth*2, THREAD_CACHE_MAX_DEPTH);
+            thread_entry->misses = 0;
+        }
+    }
 
-    if(cache_entry) {
+    if(!ret && (cache_entry = get_cache_entry_from_idx(cache_idx))) {
         EnterCriticalSection(&cs_bstr_cache);
 
         if(!cache_entry->cnt) {
-            cache_entry = get_cache_entry(size+BUCKET_SIZE);
+            cache_entry = get_cache_entry_from_idx(cache_idx+1);
             if(cache_entry && !cache_entry->cnt)
                 cache_entry = NULL;
+            ret_idx = cache_idx+1;
         }
 
         if(cache_entry) {
@@ -162,16 +274,18 @@ static bstr_t *alloc_bstr(size_t size)
         }
 
         LeaveCriticalSection(&cs_bstr_cache);
+    }
 
-        if(cache_entry) {
-            if(WARN_ON(heap)) {
-                size_t fill_size = (FIELD_OFFSET(bstr_t, u.ptr[size])+2*sizeof(WCHAR)-1) & ~(sizeof(WCHAR)-1);
-                memset(ret, ARENA_INUSE_FILLER, fill_size);
-                memset((char *)ret+fill_size, ARENA_TAIL_FILLER, bstr_alloc_size(size)-fill_size);
-            }
-            ret->size = size;
-            return ret;
+    if(ret) {
+        if((mark = get_cache_mark(ret, ret_idx)))
+            *mark = 0;
+        if(WARN_ON(heap)) {
+            size_t fill_size = (FIELD_OFFSET(bstr_t, u.ptr[size])+2*sizeof(WCHAR)-1) & ~(sizeof(WCHAR)-1);
+            memset(ret, ARENA_INUSE_FILLER, fill_size);
+            memset((char *)ret+fill_size, ARENA_TAIL_FILLER, bstr_alloc_size(size)-fill_size);
         }
+        ret->size = size;
+        return ret;
     }
 
     ret = CoTaskMemAlloc(bstr_alloc_size(size));
@@ -274,10 +388,13 @@ static inline IMalloc *get_malloc(void)
  */
 void WINAPI SysFreeString(BSTR str)
 {
+    bstr_thread_cache_entry_t *thread_entry = NULL;
     bstr_cache_entry_t *cache_entry;
     bstr_t *bstr;
     IMalloc *malloc = get_malloc();
     SIZE_T alloc_size;
+    unsigned cache_idx, i;
+    DWORD *mark;
 
     if(!str)
         return;
@@ -288,15 +405,42 @@ void WINAPI SysFreeString(BSTR str)
     if (alloc_size == ~0UL)
         return;
 
-    cache_entry = get_cache_entry_from_alloc_size(alloc_size);
-    if(cache_entry) {
-        unsigned i;
+    if (alloc_size < BUCKET_SIZE)
+    {
+        CoTaskMemFree(bstr);
+        return;
+    }
+    cache_idx = (alloc_size - BUCKET_SIZE) / BUCKET_SIZE;
+
+    mark = get_cache_mark(bstr, cache_idx);
+    if(mark && bstr_cache_enabled) {
+        if(*mark == get_cache_mark_value(bstr)) {
+            WARN_(heap)("String already is in cache!\n");
+            return;
+        }
+        thread_entry = get_thread_cache_entry(cache_idx, TRUE);
+    }
+
+    if(thread_entry && thread_entry->cnt < thread_entry->depth) {
+        thread_entry->buf[(thread_entry->head+thread_entry->cnt) % THREAD_CACHE_MAX_DEPTH] = bstr;
+        thread_entry->cnt++;
 
+        if(WARN_ON(heap)) {
+            unsigned n = (alloc_size-FIELD_OFFSET(bstr_t, u.ptr))/sizeof(DWORD);
+            for(i=0; i<n; i++)
+                bstr->u.dwptr[i] = ARENA_FREE_FILLER;
+        }
+        *mark = get_cache_mark_value(bstr);
+        return;
+    }
+
+    cache_entry = get_cache_entry_from_idx(cache_idx);
+    if(cache_entry) {
         EnterCriticalSection(&cs_bstr_cache);
 
         /* According to tests, freeing a string that's already in cache doesn't corrupt anything.
-         * For that to work we need to search the cache. */
-        for(i=0; i < cache_entry->cnt; i++) {
+         * For that to work we need to search the cache, unless the string is marked. */
+        for(i=0; !mark && i < cache_entry->cnt; i++) {
             if(cache_entry->buf[(cache_entry->head+i) % BUCKET_BUFFER_SIZE] == bstr) {
                 WARN_(heap)("String already is in cache!\n");
                 LeaveCriticalSection(&cs_bstr_cache);
@@ -313,6 +457,8 @@ void WINAPI SysFreeString(BSTR str)
                 for(i=0; i<n; i++)
                     bstr->u.dwptr[i] = ARENA_FREE_FILLER;
             }
+            if(mark)
+                *mark = get_cache_mark_value(bstr);
 
             LeaveCriticalSection(&cs_bstr_cache);
             return;
@@ -763,8 +909,8 @@ HRESULT WINAPI OleTranslateColor(
   return S_OK;
 }
 
+extern HMODULE hProxyDll DECLSPEC_HIDDEN;
 extern HRESULT WINAPI OLEAUTPS_DllGetClassObject(REFCLSID, REFIID, LPVOID *) DECLSPEC_HIDDEN;
-extern BOOL WINAPI OLEAUTPS_DllMain(HINSTANCE, DWORD, LPVOID) DECLSPEC_HIDDEN;
 extern HRESULT WINAPI OLEAUTPS_DllRegisterServer(void) DECLSPEC_HIDDEN;
 extern HRESULT WINAPI OLEAUTPS_DllUnregisterServer(void) DECLSPEC_HIDDEN;
 
@@ -904,10 +1050,28 @@ BOOL WINAPI DllMain(HINSTANCE hInstDll, DWORD fdwReason, LPVOID lpvReserved)
 {
     static const WCHAR oanocacheW[] = {'o','a','n','o','c','a','c','h','e',0};
 
-    if(fdwReason == DLL_PROCESS_ATTACH)
+    switch(fdwReason)
+    {
+    case DLL_PROCESS_ATTACH:
         bstr_cache_enabled = !GetEnvironmentVariableW(oanocacheW, NULL, 0);
+        bstr_cache_cookie = GetTickCount() ^ (GetCurrentProcessId() << 16) ^ 0x42535452;
+        bstr_thread_cache_tls = TlsAlloc();
+        /* don't call OLEAUTPS_DllMain, it would disable the thread
+         * notifications that release the thread caches */
+        hProxyDll = hInstDll;
+        break;
+    case DLL_THREAD_DETACH:
+        free_thread_cache();
+        break;
+    case DLL_PROCESS_DETACH:
+        if (lpvReserved) break;
+        free_thread_cache();
+        if (bstr_thread_cache_tls != TLS_OUT_OF_INDEXES)
+            TlsFree(bstr_thread_cache_tls);
+        break;
+    }
 
-    return OLEAUTPS_DllMain( hInstDll, fdwReason, lpvReserved );
+    return TRUE;
 }
 
 /***********************************************************************
@@ -6250,6 +6250,262 @@ static void test_dep(void) {
     DeleteFileW(filenameW);
 }
 
+static DWORD WINAPI typeinfo_members_thread(void *arg)
+{
+    ITypeLib *tl = arg;
+    UINT count, i, j, names;
+    ITypeInfo *ti;
+    TYPEATTR *attr;
+    FUNCDESC *desc;
+    BSTR name;
+    DWORD ret = 0;
+    HRESULT hr;
+
+    count = ITypeLib_GetTypeInfoCount(tl);
+    for (i = 0; i < count; i++)
+    {
+        hr = ITypeLib_GetTypeInfo(tl, (i * 7) % count, &ti);
+        if (FAILED(hr)) return ~0u;
+        ITypeInfo_GetTypeAttr(ti, &attr);
+        for (j = 0; j < attr->cFuncs; j++)
+        {
+            hr = ITypeInfo_GetFuncDesc(ti, j, &desc);
+            if (FAILED(hr)) return ~0u;
+            hr = ITypeInfo_GetNames(ti, desc->memid, &name, 1, &names);
+            if (SUCCEEDED(hr))
+            {
+                ret += SysStringLen(name);
+                SysFreeString(name);
+            }
+            ITypeInfo_ReleaseFuncDesc(ti, desc);
+        }
+        ret += attr->cVars + attr->cImplTypes;
+        ITypeInfo_ReleaseTypeAttr(ti, attr);
+        ITypeInfo_Release(ti);
+    }
+    return ret;
+}
+
+static void test_typeinfo_members(void)
+{
+    static const GUID IID_IFont = {0xbef6e002,0xa874,0x101a,{0x8b,0xba,0x00,0xaa,0x00,0x30,0x0c,0xab}};
+    DWORD expect, ret;
+    HANDLE threads[4];
+    ITypeInfo *ti;
+    TYPEATTR *attr;
+    ITypeLib *tl;
+    HRESULT hr;
+    int i;
+
+    /* members of a typeinfo looked up by guid */
+    hr = LoadTypeLib(wszStdOle2, &tl);
+    ok(hr == S_OK, "got 0x%08x\n", hr);
+    hr = ITypeLib_GetTypeInfoOfGuid(tl, &IID_IFont, &ti);
+    ok(hr == S_OK, "got 0x%08x\n", hr);
+    hr = ITypeInfo_GetTypeAttr(ti, &attr);
+    ok(hr == S_OK, "got 0x%08x\n", hr);
+    ok(attr->typekind == TKIND_INTERFACE, "got %d\n", attr->typekind);
+    ok(attr->cFuncs > 20, "got %d\n", attr->cFuncs);
+    ITypeInfo_ReleaseTypeAttr(ti, attr);
+    ITypeInfo_Release(ti);
+
+    expect = typeinfo_members_thread(tl);
+    ok(expect != ~0u, "failed to read the typeinfos\n");
+    ITypeLib_Release(tl);
+
+    /* several threads using a freshly loaded typelib */
+    hr = LoadTypeLib(wszStdOle2, &tl);
+    ok(hr == S_OK, "got 0x%08x\n", hr);
+    for (i = 0; i < sizeof(threads)/sizeof(threads[0]); i++)
+        threads[i] = CreateThread(NULL, 0, typeinfo_members_thread, tl, 0, NULL);
+    for (i = 0; i < sizeof(threads)/sizeof(threads[0]); i++)
+    {
+        ok(!WaitForSingleObject(threads[i], 10000), "wait failed\n");
+        GetExitCodeThread(threads[i], &ret);
+        ok(ret == expect, "got %u, expected %u\n", ret, expect);
+        CloseHandle(threads[i]);
+    }
+    ITypeLib_Release(tl);
+}
+
+static void test_member_lookup(void)
+{
+    static const GUID IID_IFont = {0xbef6e002,0xa874,0x101a,{0x8b,0xba,0x00,0xaa,0x00,0x30,0x0c,0xab}};
+    static WCHAR sizeW[] = {'S','i','Z','e',0};
+    static WCHAR bogusW[] = {'b','o','g','u','s','_','m','e','m','b','e','r',0};
+    static WCHAR arialW[] = {'A','r','i','a','l',0};
+    WCHAR name_buf[64], *names[2];
+    DISPPARAMS dp = {NULL, NULL, 0, 0};
+    FONTDESC fontdesc;
+    MEMBERID memid, memids[2];
+    ITypeInfo *ti;
+    TYPEATTR *attr;
+    FUNCDESC *desc;
+    ITypeLib *tl;
+    IFont *font;
+    VARIANT res;
+    BSTR name;
+    CY size;
+    HRESULT hr;
+    UINT i, j, count;
+
+    hr = LoadTypeLib(wszStdOle2, &tl);
+    ok(hr == S_OK, "got 0x%08x\n", hr);
+    hr = ITypeLib_GetTypeInfoOfGuid(tl, &IID_IFont, &ti);
+    ok(hr == S_OK, "got 0x%08x\n", hr);
+    hr = ITypeInfo_GetTypeAttr(ti, &attr);
+    ok(hr == S_OK, "got 0x%08x\n", hr);
+
+    /* every function is found by its name in any case */
+    for (i = 0; i < attr->cFuncs; i++)
+    {
+        hr = ITypeInfo_GetFuncDesc(ti, i, &desc);
+        ok(hr == S_OK, "got 0x%08x\n", hr);
+        hr = ITypeInfo_GetNames(ti, desc->memid, &name, 1, &count);
+        ok(hr == S_OK, "got 0x%08x\n", hr);
+
+        lstrcpyW(name_buf, name);
+        for (j = 0; name_buf[j]; j++)
+        {
+            if (j % 2 && name_buf[j] >= 'a' && name_buf[j] <= 'z') name_buf[j] -= 'a' - 'A';
+            else if (name_buf[j] >= 'A' && name_buf[j] <= 'Z') name_buf[j] += 'a' - 'A';
+        }
+        names[0] = name_buf;
+        memid = 0xdeadbeef;
+        hr = ITypeInfo_GetIDsOfNames(ti, names, 1, &memid);
+        ok(hr == S_OK, "%s: got 0x%08x\n", wine_dbgstr_w(name), hr);
+        /* property accessors share a name, the first one wins */
+        ok(memid == desc->memid, "%s: got %d, expected %d\n", wine_dbgstr_w(name), memid, desc->memid);
+
+        SysFreeString(name);
+        ITypeInfo_ReleaseFuncDesc(ti, desc);
+    }
+    ITypeInfo_ReleaseTypeAttr(ti, attr);
+
+    names[0] = bogusW;
+    memid = 0xdeadbeef;
+    hr = ITypeInfo_GetIDsOfNames(ti, names, 1, &memid);
+    ok(hr == DISP_E_UNKNOWNNAME, "got 0x%08x\n", hr);
+
+    names[0] = sizeW;
+    names[1] = bogusW;
+    hr = ITypeInfo_GetIDsOfNames(ti, names, 2, memids);
+    ok(hr == DISP_E_UNKNOWNNAME, "got 0x%08x\n", hr);
+    ok(memids[0] == DISPID_FONT_SIZE, "got %d\n", memids[0]);
+
+    /* invoke the member found through the name lookup */
+    fontdesc.cbSizeofstruct = sizeof(fontdesc);
+    fontdesc.lpstrName = arialW;
+    fontdesc.cySize.int64 = 120000;
+    fontdesc.sWeight = FW_NORMAL;
+    fontdesc.sCharset = 0;
+    fontdesc.fItalic = FALSE;
+    fontdesc.fUnderline = FALSE;
+    fontdesc.fStrikethrough = FALSE;
+    hr = OleCreateFontIndirect(&fontdesc, &IID_IFont, (void **)&font);
+    ok(hr == S_OK, "got 0x%08x\n", hr);
+    hr = IFont_get_Size(font, &size);
+    ok(hr == S_OK, "got 0x%08x\n", hr);
+
+    V_VT(&res) = VT_EMPTY;
+    hr = ITypeInfo_Invoke(ti, font, memids[0], DISPATCH_PROPERTYGET, &dp, &res, NULL, NULL);
+    ok(hr == S_OK, "got 0x%08x\n", hr);
+    ok(V_VT(&res) == VT_CY, "got %d\n", V_VT(&res));
+    ok(V_CY(&res).int64 == size.int64, "got %u\n", (UINT)V_CY(&res).int64);
+
+    hr = ITypeInfo_Invoke(ti, font, 0x12345, DISPATCH_PROPERTYGET, &dp, &res, NULL, NULL);
+    ok(hr == DISP_E_MEMBERNOTFOUND, "got 0x%08x\n", hr);
+
+    IFont_Release(font);
+    ITypeInfo_Release(ti);
+    ITypeLib_Release(tl);
+}
+
+static void benchmark_LoadTypeLib(void)
+{
+    ITypeInfo *ti;
+    ITypeLib *tl;
+    DWORD start;
+    HRESULT hr;
+    int i;
+
+    start = GetTickCount();
+    for (i = 0; i < 2000; i++)
+    {
+        hr = LoadTypeLib(wszStdOle2, &tl);
+        if (FAILED(hr)) break;
+        ITypeLib_Release(tl);
+    }
+    trace("LoadTypeLib: %u ms\n", GetTickCount() - start);
+
+    start = GetTickCount();
+    for (i = 0; i < 2000; i++)
+    {
+        hr = LoadTypeLib(wszStdOle2, &tl);
+        if (FAILED(hr)) break;
+        if (SUCCEEDED(ITypeLib_GetTypeInfo(tl, 0, &ti)))
+            ITypeInfo_Release(ti);
+        ITypeLib_Release(tl);
+    }
+    trace("LoadTypeLib and GetTypeInfo: %u ms\n", GetTickCount() - start);
+
+    start = GetTickCount();
+    for (i = 0; i < 2000; i++)
+    {
+        hr = LoadTypeLib(wszStdOle2, &tl);
+        if (FAILED(hr)) break;
+        typeinfo_members_thread(tl);
+        ITypeLib_Release(tl);
+    }
+    trace("LoadTypeLib and all members: %u ms\n", GetTickCount() - start);
+}
+
+static void benchmark_late_binding(void)
+{
+    static const GUID IID_IFont = {0xbef6e002,0xa874,0x101a,{0x8b,0xba,0x00,0xaa,0x00,0x30,0x0c,0xab}};
+    static WCHAR sizeW[] = {'s','i','z','e',0};
+    static WCHAR arialW[] = {'A','r','i','a','l',0};
+    DISPPARAMS dp = {NULL, NULL, 0, 0};
+    FONTDESC fontdesc = {sizeof(fontdesc), arialW, {{120000}}, FW_NORMAL};
+    WCHAR *names[1] = {sizeW};
+    MEMBERID memid;
+    ITypeInfo *ti;
+    ITypeLib *tl;
+    IFont *font;
+    VARIANT res;
+    DWORD start;
+    HRESULT hr;
+    int i;
+
+    hr = LoadTypeLib(wszStdOle2, &tl);
+    if (FAILED(hr)) return;
+    hr = ITypeLib_GetTypeInfoOfGuid(tl, &IID_IFont, &ti);
+    ITypeLib_Release(tl);
+    if (FAILED(hr)) return;
+    hr = OleCreateFontIndirect(&fontdesc, &IID_IFont, (void **)&font);
+    if (FAILED(hr))
+    {
+        ITypeInfo_Release(ti);
+        return;
+    }
+
+    start = GetTickCount();
+    for (i = 0; i < 1000000; i++)
+        ITypeInfo_GetIDsOfNames(ti, names, 1, &memid);
+    trace("GetIDsOfNames: %u ms\n", GetTickCount() - start);
+
+    start = GetTickCount();
+    for (i = 0; i < 1000000; i++)
+    {
+        hr = ITypeInfo_Invoke(ti, font, memid, DISPATCH_PROPERTYGET, &dp, &res, NULL, NULL);
+        if (FAILED(hr)) break;
+    }
+    trace("Invoke: %u ms\n", GetTickCount() - start);
+
+    IFont_Release(font);
+    ITypeInfo_Release(ti);
+}
+
 START_TEST(typelib)
 {
     const char *filename;
@@ -6290,4 +6546,12 @@ START_TEST(typelib)
     test_GetLibAttr();
     test_stub();
     test_dep();
+    test_typeinfo_members();
+    test_member_lookup();
+
+    if (winetest_interactive)
+    {
+        benchmark_LoadTypeLib();
+        benchmark_late_binding();
+    }
 }
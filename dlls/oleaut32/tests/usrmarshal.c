@@ -527,6 +527,125 @@ static void test_marshal_LPSAFEARRAY(void)
     ok(hr == S_OK, "got 0x%08x\n", hr);
 }
 
+static void test_marshal_LPSAFEARRAY_VARIANT(void)
+{
+    static const WCHAR testW[] = {'t','e','s','t',0};
+    unsigned char *buffer, *next, *next2;
+    LPSAFEARRAY lpsa, lpsa2 = NULL;
+    RPC_MESSAGE rpc_msg;
+    MIDL_STUB_MESSAGE stub_msg;
+    USER_MARSHAL_CB umcb;
+    SAFEARRAYBOUND sab;
+    VARIANT *vars, *vars2;
+    ULONG size;
+    HRESULT hr;
+    int i;
+
+    sab.lLbound = 0;
+    sab.cElements = 40;
+    lpsa = SafeArrayCreate(VT_VARIANT, 1, &sab);
+    vars = lpsa->pvData;
+    for (i = 0; i < sab.cElements; i++)
+    {
+        switch (i % 5)
+        {
+        case 0: V_VT(&vars[i]) = VT_I4; V_I4(&vars[i]) = i; break;
+        case 1: V_VT(&vars[i]) = VT_R8; V_R8(&vars[i]) = i / 2.0; break;
+        case 2: V_VT(&vars[i]) = VT_BSTR; V_BSTR(&vars[i]) = SysAllocString(testW); break;
+        case 3: V_VT(&vars[i]) = VT_UI1; V_UI1(&vars[i]) = i; break;
+        case 4: break;
+        }
+    }
+
+    init_user_marshal_cb(&umcb, &stub_msg, &rpc_msg, NULL, 0, MSHCTX_DIFFERENTMACHINE);
+    size = LPSAFEARRAY_UserSize(&umcb.Flags, 0, &lpsa);
+    buffer = HeapAlloc(GetProcessHeap(), 0, size);
+    init_user_marshal_cb(&umcb, &stub_msg, &rpc_msg, buffer, size, MSHCTX_DIFFERENTMACHINE);
+    next = LPSAFEARRAY_UserMarshal(&umcb.Flags, buffer, &lpsa);
+    ok(next - buffer <= size, "Marshaled %u bytes, expected at most %u\n", (ULONG)(next - buffer), size);
+
+    init_user_marshal_cb(&umcb, &stub_msg, &rpc_msg, buffer, size, MSHCTX_DIFFERENTMACHINE);
+    next2 = LPSAFEARRAY_UserUnmarshal(&umcb.Flags, buffer, &lpsa2);
+    ok(next2 == next, "Unmarshaled %u bytes, expected %u\n", (ULONG)(next2 - buffer), (ULONG)(next - buffer));
+    ok(lpsa2 != NULL, "LPSAFEARRAY didn't unmarshal\n");
+
+    vars2 = lpsa2->pvData;
+    for (i = 0; i < sab.cElements; i++)
+    {
+        ok(V_VT(&vars2[i]) == V_VT(&vars[i]), "%d: got vt %d, expected %d\n", i, V_VT(&vars2[i]), V_VT(&vars[i]));
+        switch (V_VT(&vars[i]))
+        {
+        case VT_I4:
+            ok(V_I4(&vars2[i]) == i, "%d: got %d\n", i, V_I4(&vars2[i]));
+            break;
+        case VT_R8:
+            ok(V_R8(&vars2[i]) == i / 2.0, "%d: got %f\n", i, V_R8(&vars2[i]));
+            break;
+        case VT_BSTR:
+            ok(!lstrcmpW(V_BSTR(&vars2[i]), testW), "%d: got %s\n", i, wine_dbgstr_w(V_BSTR(&vars2[i])));
+            break;
+        case VT_UI1:
+            ok(V_UI1(&vars2[i]) == i, "%d: got %d\n", i, V_UI1(&vars2[i]));
+            break;
+        }
+    }
+
+    init_user_marshal_cb(&umcb, &stub_msg, &rpc_msg, NULL, 0, MSHCTX_DIFFERENTMACHINE);
+    LPSAFEARRAY_UserFree(&umcb.Flags, &lpsa2);
+    HeapFree(GetProcessHeap(), 0, buffer);
+    hr = SafeArrayDestroy(lpsa);
+    ok(hr == S_OK, "got 0x%08x\n", hr);
+}
+
+static void benchmark_marshal_LPSAFEARRAY(VARTYPE vt)
+{
+    unsigned char *buffer;
+    LPSAFEARRAY lpsa, lpsa2 = NULL;
+    RPC_MESSAGE rpc_msg;
+    MIDL_STUB_MESSAGE stub_msg;
+    USER_MARSHAL_CB umcb;
+    SAFEARRAYBOUND sab;
+    DWORD start, marshal_ticks, unmarshal_ticks;
+    ULONG size, i;
+
+    sab.lLbound = 0;
+    sab.cElements = 100 * 1024 * 1024 / (vt == VT_VARIANT ? sizeof(VARIANT) : sizeof(double));
+    lpsa = SafeArrayCreate(vt, 1, &sab);
+    ok(lpsa != NULL, "SafeArrayCreate failed\n");
+    if (!lpsa) return;
+    for (i = 0; i < sab.cElements; i++)
+    {
+        if (vt == VT_VARIANT)
+        {
+            V_VT((VARIANT *)lpsa->pvData + i) = VT_R8;
+            V_R8((VARIANT *)lpsa->pvData + i) = i;
+        }
+        else
+            ((double *)lpsa->pvData)[i] = i;
+    }
+
+    start = GetTickCount();
+    init_user_marshal_cb(&umcb, &stub_msg, &rpc_msg, NULL, 0, MSHCTX_LOCAL);
+    size = LPSAFEARRAY_UserSize(&umcb.Flags, 0, &lpsa);
+    buffer = HeapAlloc(GetProcessHeap(), 0, size);
+    init_user_marshal_cb(&umcb, &stub_msg, &rpc_msg, buffer, size, MSHCTX_LOCAL);
+    LPSAFEARRAY_UserMarshal(&umcb.Flags, buffer, &lpsa);
+    marshal_ticks = GetTickCount() - start;
+
+    start = GetTickCount();
+    init_user_marshal_cb(&umcb, &stub_msg, &rpc_msg, buffer, size, MSHCTX_LOCAL);
+    LPSAFEARRAY_UserUnmarshal(&umcb.Flags, buffer, &lpsa2);
+    unmarshal_ticks = GetTickCount() - start;
+
+    trace("vt %d: %u elements, %u bytes on the wire, marshaled in %u ms, unmarshaled in %u ms\n",
+          vt, sab.cElements, size, marshal_ticks, unmarshal_ticks);
+
+    init_user_marshal_cb(&umcb, &stub_msg, &rpc_msg, NULL, 0, MSHCTX_LOCAL);
+    LPSAFEARRAY_UserFree(&umcb.Flags, &lpsa2);
+    HeapFree(GetProcessHeap(), 0, buffer);
+    SafeArrayDestroy(lpsa);
+}
+
 static void check_bstr(void *buffer, BSTR b)
 {
     DWORD *wireb = buffer;
@@ -1567,8 +1686,15 @@ START_TEST(usrmarshal)
     CoInitialize(NULL);
 
     test_marshal_LPSAFEARRAY();
+    test_marshal_LPSAFEARRAY_VARIANT();
     test_marshal_BSTR();
     test_marshal_VARIANT();
 
+    if (winetest_interactive)
+    {
+        benchmark_marshal_LPSAFEARRAY(VT_R8);
+        benchmark_marshal_LPSAFEARRAY(VT_VARIANT);
+    }
+
     CoUninitialize();
 }
@@ -8954,6 +8954,72 @@ static void test_VarImp(void)
     SysFreeString(true_str);
 }
 
+static void benchmark_conversion(const char *name, VARIANT *src, VARTYPE vt)
+{
+    static const int count = 1000000;
+    DWORD start, elapsed;
+    VARIANT dst;
+    HRESULT hr = S_OK;
+    int i;
+
+    V_VT(&dst) = VT_EMPTY;
+    start = GetTickCount();
+    for (i = 0; i < count && hr == S_OK; i++)
+        hr = VariantChangeTypeEx(&dst, src, LOCALE_USER_DEFAULT, 0, vt);
+    elapsed = max(GetTickCount() - start, 1);
+    ok(hr == S_OK, "%s: VariantChangeTypeEx returned %#x\n", name, hr);
+    VariantClear(&dst);
+
+    trace("%s: %u conversions/s\n", name, (DWORD)(count * 1000.0 / elapsed));
+}
+
+static void benchmark_variants(void)
+{
+    static const WCHAR numW[] = {'1','2','3','4','5',0};
+    static const int count = 1000000;
+    VARIANT left, right, result;
+    DWORD start, elapsed;
+    HRESULT hr = S_OK;
+    int i;
+
+    V_VT(&left) = VT_I4;
+    V_I4(&left) = 12345;
+    benchmark_conversion("I4 -> R8", &left, VT_R8);
+    benchmark_conversion("I4 -> BSTR", &left, VT_BSTR);
+
+    V_VT(&left) = VT_R8;
+    V_R8(&left) = 12345.678;
+    benchmark_conversion("R8 -> I4", &left, VT_I4);
+    benchmark_conversion("R8 -> BSTR", &left, VT_BSTR);
+
+    V_VT(&left) = VT_BSTR;
+    V_BSTR(&left) = SysAllocString(numW);
+    benchmark_conversion("BSTR -> I4", &left, VT_I4);
+    benchmark_conversion("BSTR -> R8", &left, VT_R8);
+    VariantClear(&left);
+
+    V_VT(&left) = VT_I4;
+    V_I4(&left) = 12345;
+    V_VT(&right) = VT_I4;
+    V_I4(&right) = 678;
+    start = GetTickCount();
+    for (i = 0; i < count && hr == S_OK; i++)
+        hr = VarAdd(&left, &right, &result);
+    elapsed = max(GetTickCount() - start, 1);
+    ok(hr == S_OK, "VarAdd returned %#x\n", hr);
+    trace("VarAdd I4: %u calls/s\n", (DWORD)(count * 1000.0 / elapsed));
+
+    V_VT(&left) = VT_R8;
+    V_R8(&left) = 12345.678;
+    hr = VARCMP_GT;
+    start = GetTickCount();
+    for (i = 0; i < count && hr == VARCMP_GT; i++)
+        hr = VarCmp(&left, &right, LOCALE_USER_DEFAULT, 0);
+    elapsed = max(GetTickCount() - start, 1);
+    ok(hr == VARCMP_GT, "VarCmp returned %#x\n", hr);
+    trace("VarCmp R8/I4: %u calls/s\n", (DWORD)(count * 1000.0 / elapsed));
+}
+
 START_TEST(vartest)
 {
   init();
@@ -8990,4 +9056,7 @@ START_TEST(vartest)
   test_VarDiv();
   test_VarIdiv();
   test_VarImp();
+
+  if (winetest_interactive)
+    benchmark_variants();
 }
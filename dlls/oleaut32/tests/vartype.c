@@ -506,6 +506,7 @@ static HRESULT (WINAPI *pVarBoolFromI8)(LONG64,VARIANT_BOOL*);
 static HRESULT (WINAPI *pVarBoolFromUI8)(ULONG64,VARIANT_BOOL*);
 
 static HRESULT (WINAPI *pVarBstrFromR4)(FLOAT,LCID,ULONG,BSTR*);
+static HRESULT (WINAPI *pVarBstrFromR8)(double,LCID,ULONG,BSTR*);
 static HRESULT (WINAPI *pVarBstrFromDate)(DATE,LCID,ULONG,BSTR*);
 static HRESULT (WINAPI *pVarBstrFromCy)(CY,LCID,ULONG,BSTR*);
 static HRESULT (WINAPI *pVarBstrFromDec)(DECIMAL*,LCID,ULONG,BSTR*);
@@ -5091,6 +5092,52 @@ static void test_VarBstrFromR4(void)
   }
 }
 
+static void _BSTR_R8(double d, LCID lcid, const char *str, int line)
+{
+  char buff[256];
+  BSTR bstr = NULL;
+  HRESULT hres;
+
+  hres = pVarBstrFromR8(d, lcid, LOCALE_NOUSEROVERRIDE, &bstr);
+  if (bstr)
+  {
+    WideCharToMultiByte(CP_ACP, 0, bstr, -1, buff, sizeof(buff), 0, 0);
+    SysFreeString(bstr);
+  }
+  else
+    buff[0] = 0;
+  ok_(__FILE__, line)(hres == S_OK && !strcmp(str, buff),
+      "Expected '%s', got '%s', hres = 0x%08x\n", str, buff, hres);
+}
+
+static void test_VarBstrFromR8(void)
+{
+  LCID lcid = MAKELCID(MAKELANGID(LANG_ENGLISH,SUBLANG_ENGLISH_US),SORT_DEFAULT);
+  LCID lcid_spanish = MAKELCID(MAKELANGID(LANG_SPANISH,SUBLANG_SPANISH),SORT_DEFAULT);
+
+#define BSTR_R8(d,str) _BSTR_R8(d,lcid,str,__LINE__)
+
+  CHECKPTR(VarBstrFromR8);
+
+  BSTR_R8(0.0, "0");
+  BSTR_R8(-0.0, "0");
+  BSTR_R8(1.0, "1");
+  BSTR_R8(-1.0, "-1");
+  BSTR_R8(2147483648.0, "2147483648");
+  BSTR_R8(-123456789012345.0, "-123456789012345");
+  BSTR_R8(999999999999999.0, "999999999999999");
+  BSTR_R8(1e15, "1E+15");
+  BSTR_R8(0.5, "0.5");
+  BSTR_R8(-2.25, "-2.25");
+
+  /* The separator of the last locale used must not be reused for another one */
+  _BSTR_R8(1.5, lcid_spanish, "1,5", __LINE__);
+  _BSTR_R8(-3.0, lcid_spanish, "-3", __LINE__);
+  BSTR_R8(1.5, "1.5");
+
+#undef BSTR_R8
+}
+
 static void _BSTR_DATE(DATE dt, const char *str, int line)
 {
   LCID lcid = MAKELCID(MAKELANGID(LANG_ENGLISH,SUBLANG_ENGLISH_US),SORT_DEFAULT);
@@ -6418,6 +6465,282 @@ static void test_bstr_cache(void)
     SysFreeString(str2);
 }
 
+static DWORD WINAPI bstr_churn_thread(void *arg)
+{
+    static const WCHAR testW[] = {'t','e','s','t',' ','s','t','r','i','n','g',0};
+    unsigned count = *(unsigned *)arg, i, j;
+    BSTR strs[16];
+
+    for (i = 0; i < count; i++)
+    {
+        for (j = 0; j < sizeof(strs)/sizeof(*strs); j++)
+            strs[j] = SysAllocStringLen(testW, (i + j) % (sizeof(testW)/sizeof(WCHAR)));
+        for (j = 0; j < sizeof(strs)/sizeof(*strs); j++)
+            SysFreeString(strs[j]);
+    }
+    return 0;
+}
+
+static void benchmark_bstr_cache(void)
+{
+    unsigned count = 100000, nthreads, i;
+    HANDLE threads[8];
+    DWORD start, ticks;
+
+    for (nthreads = 1; nthreads <= sizeof(threads)/sizeof(*threads); nthreads *= 2)
+    {
+        start = GetTickCount();
+        for (i = 0; i < nthreads; i++)
+            threads[i] = CreateThread(NULL, 0, bstr_churn_thread, &count, 0, NULL);
+        WaitForMultipleObjects(nthreads, threads, TRUE, INFINITE);
+        ticks = max(GetTickCount() - start, 1);
+        for (i = 0; i < nthreads; i++)
+            CloseHandle(threads[i]);
+
+        trace("%u threads: %u string allocations in %u ms, %u per ms\n", nthreads,
+              count * 16 * nthreads, ticks, count * 16 * nthreads / ticks);
+    }
+}
+
+static DWORD WINAPI bstr_free_thread(void *arg)
+{
+    BSTR *str = arg;
+
+    *str = SysAllocStringLen(NULL, 300);
+    SysFreeString(*str);
+    return 0;
+}
+
+static void test_bstr_thread_cache(void)
+{
+    BSTR str, strs[8];
+    HANDLE thread;
+    BOOL found = FALSE;
+    unsigned i;
+
+    if (GetEnvironmentVariableA("OANOCACHE", NULL, 0)) {
+        skip("BSTR cache is disabled, some tests will be skipped.\n");
+        return;
+    }
+
+    /* A string freed by a thread stays in its private cache until the
+     * thread exits, then it has to be usable by the other threads. */
+    thread = CreateThread(NULL, 0, bstr_free_thread, &str, 0, NULL);
+    ok(thread != NULL, "CreateThread failed: %u\n", GetLastError());
+    WaitForSingleObject(thread, INFINITE);
+    CloseHandle(thread);
+
+    for(i=0; i < sizeof(strs)/sizeof(*strs); i++)
+    {
+        strs[i] = SysAllocStringLen(NULL, 300);
+        if (strs[i] == str) found = TRUE;
+    }
+    ok(found, "string freed by an exited thread was not reused\n");
+
+    for(i=0; i < sizeof(strs)/sizeof(*strs); i++)
+        SysFreeString(strs[i]);
+}
+
+struct bstr_free_data
+{
+    BSTR str;
+    HANDLE freed, done;
+};
+
+static DWORD WINAPI bstr_free_wait_thread(void *arg)
+{
+    struct bstr_free_data *data = arg;
+
+    SysFreeString(data->str);
+    SetEvent(data->freed);
+    WaitForSingleObject(data->done, INFINITE);
+    return 0;
+}
+
+static void check_bstrs_unique(BSTR *strs, unsigned count)
+{
+    unsigned i, j;
+
+    for(i=0; i < count; i++)
+        for(j=i+1; j < count; j++)
+            ok(strs[i] != strs[j], "string %p returned twice\n", strs[i]);
+}
+
+static void test_bstr_double_free(void)
+{
+    struct bstr_free_data data;
+    BSTR strs[64], strs2[41];
+    HANDLE thread;
+    unsigned i;
+
+    if (GetEnvironmentVariableA("OANOCACHE", NULL, 0)) {
+        skip("BSTR cache is disabled, some tests will be skipped.\n");
+        return;
+    }
+
+    /* free a string again while it's in the cache of another thread,
+     * and once more after that thread has exited */
+    data.str = SysAllocStringLen(NULL, 150);
+    data.freed = CreateEventA(NULL, FALSE, FALSE, NULL);
+    data.done = CreateEventA(NULL, FALSE, FALSE, NULL);
+    thread = CreateThread(NULL, 0, bstr_free_wait_thread, &data, 0, NULL);
+    ok(thread != NULL, "CreateThread failed: %u\n", GetLastError());
+    WaitForSingleObject(data.freed, INFINITE);
+    SysFreeString(data.str);
+    SetEvent(data.done);
+    WaitForSingleObject(thread, INFINITE);
+    CloseHandle(thread);
+    CloseHandle(data.freed);
+    CloseHandle(data.done);
+    SysFreeString(data.str);
+
+    for(i=0; i < 16; i++)
+        strs[i] = SysAllocStringLen(NULL, 150);
+    check_bstrs_unique(strs, 16);
+    for(i=0; i < 16; i++)
+        SysFreeString(strs[i]);
+
+    /* overflow the cache of this thread into the shared one, then make
+     * room in it and free a string from the shared cache again */
+    for(i=0; i < 64; i++)
+        strs[i] = SysAllocStringLen(NULL, 100);
+    for(i=0; i <= 32; i++)
+        SysFreeString(strs[i]);
+    strs2[40] = SysAllocStringLen(NULL, 100);
+    SysFreeString(strs[32]);
+
+    for(i=0; i < 40; i++)
+        strs2[i] = SysAllocStringLen(NULL, 100);
+    check_bstrs_unique(strs2, 41);
+    for(i=0; i <= 40; i++)
+        SysFreeString(strs2[i]);
+    for(i=33; i < 64; i++)
+        SysFreeString(strs[i]);
+}
+
+static void *spy_freed;
+
+static HRESULT WINAPI testspy_QI(IMallocSpy *iface, REFIID riid, void **obj)
+{
+    *obj = iface;
+    return S_OK;
+}
+
+static ULONG WINAPI testspy_AddRef(IMallocSpy *iface)
+{
+    return 2;
+}
+
+static ULONG WINAPI testspy_Release(IMallocSpy *iface)
+{
+    return 1;
+}
+
+static SIZE_T WINAPI testspy_PreAlloc(IMallocSpy *iface, SIZE_T cb)
+{
+    return cb;
+}
+
+static void * WINAPI testspy_PostAlloc(IMallocSpy *iface, void *ptr)
+{
+    return ptr;
+}
+
+static void * WINAPI testspy_PreFree(IMallocSpy *iface, void *ptr, BOOL spyed)
+{
+    spy_freed = ptr;
+    return ptr;
+}
+
+static void WINAPI testspy_PostFree(IMallocSpy *iface, BOOL spyed)
+{
+}
+
+static SIZE_T WINAPI testspy_PreRealloc(IMallocSpy *iface, void *ptr, SIZE_T cb, void **newptr, BOOL spyed)
+{
+    *newptr = ptr;
+    return cb;
+}
+
+static void * WINAPI testspy_PostRealloc(IMallocSpy *iface, void *ptr, BOOL spyed)
+{
+    return ptr;
+}
+
+static void * WINAPI testspy_PreGetSize(IMallocSpy *iface, void *ptr, BOOL spyed)
+{
+    return ptr;
+}
+
+static SIZE_T WINAPI testspy_PostGetSize(IMallocSpy *iface, SIZE_T actual, BOOL spyed)
+{
+    return actual;
+}
+
+static void * WINAPI testspy_PreDidAlloc(IMallocSpy *iface, void *ptr, BOOL spyed)
+{
+    return ptr;
+}
+
+static int WINAPI testspy_PostDidAlloc(IMallocSpy *iface, void *ptr, BOOL spyed, int actual)
+{
+    return actual;
+}
+
+static void WINAPI testspy_PreHeapMinimize(IMallocSpy *iface)
+{
+}
+
+static void WINAPI testspy_PostHeapMinimize(IMallocSpy *iface)
+{
+}
+
+static const IMallocSpyVtbl testspyvtbl =
+{
+    testspy_QI,
+    testspy_AddRef,
+    testspy_Release,
+    testspy_PreAlloc,
+    testspy_PostAlloc,
+    testspy_PreFree,
+    testspy_PostFree,
+    testspy_PreRealloc,
+    testspy_PostRealloc,
+    testspy_PreGetSize,
+    testspy_PostGetSize,
+    testspy_PreDidAlloc,
+    testspy_PostDidAlloc,
+    testspy_PreHeapMinimize,
+    testspy_PostHeapMinimize
+};
+
+static IMallocSpy testspy = { &testspyvtbl };
+
+/* this disables the cache for the whole process, so it has to run last */
+static void test_SetOaNoCache(void)
+{
+    static void (WINAPI *pSetOaNoCache)(void);
+    BSTR str;
+    HRESULT hr;
+
+    CHECKPTR(SetOaNoCache);
+
+    pSetOaNoCache();
+
+    hr = CoRegisterMallocSpy(&testspy);
+    ok(hr == S_OK, "CoRegisterMallocSpy failed: %08x\n", hr);
+
+    /* the string has to go straight back to the allocator, not to the
+     * cache of this thread */
+    str = SysAllocStringLen(NULL, 16);
+    spy_freed = NULL;
+    SysFreeString(str);
+    ok(spy_freed == (DWORD_PTR *)str - 1, "string was not freed\n");
+
+    hr = CoRevokeMallocSpy();
+    ok(hr == S_OK, "CoRevokeMallocSpy failed: %08x\n", hr);
+}
+
 static void write_typelib(int res_no, const char *filename)
 {
     DWORD written;
@@ -6592,6 +6915,10 @@ START_TEST(vartype)
         GetUserDefaultLCID());
 
   test_bstr_cache();
+  test_bstr_thread_cache();
+  test_bstr_double_free();
+  if (winetest_interactive)
+    benchmark_bstr_cache();
 
   test_VarI1FromI2();
   test_VarI1FromI4();
@@ -6851,6 +7178,7 @@ START_TEST(vartype)
   test_VarBoolChangeTypeEx();
 
   test_VarBstrFromR4();
+  test_VarBstrFromR8();
   test_VarBstrFromDate();
   test_VarBstrFromCy();
   test_VarBstrFromDec();
@@ -6884,4 +7212,6 @@ START_TEST(vartype)
   test_ChangeType_keep_dst();
 
   test_recinfo();
+
+  test_SetOaNoCache();
 }
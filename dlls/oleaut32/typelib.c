@@ -1120,6 +1120,8 @@ typedef struct tagITypeLibImpl
 				   typelibs */
     struct list ref_list;       /* list of ref types in this typelib */
     HREFTYPE dispatch_href;     /* reference to IDispatch, -1 if unused */
+    struct tagTLBImage *image;  /* MSFT image, kept until all typeinfos
+                                   are loaded */
 
 
     /* typelibs are cached, keyed by path and index, so store the linked list info within them */
@@ -1153,7 +1155,7 @@ static inline ITypeLibImpl *impl_from_ICreateTypeLib2( ICreateTypeLib2 *iface )
 }
 
 /* ITypeLib methods */
-static ITypeLib2* ITypeLib2_Constructor_MSFT(LPVOID pLib, DWORD dwTLBLength);
+static ITypeLib2* ITypeLib2_Constructor_MSFT(LPVOID pLib, DWORD dwTLBLength, IUnknown *pFile);
 static ITypeLib2* ITypeLib2_Constructor_SLTG(LPVOID pLib, DWORD dwTLBLength);
 
 /*======================= ITypeInfo implementation =======================*/
@@ -1238,6 +1240,8 @@ typedef struct tagITypeInfoImpl
 
     ITypeLibImpl * pTypeLib;        /* back pointer to typelib */
     int index;                  /* index in this typelib; */
+    BOOL not_loaded;            /* members not read from the image yet */
+    struct tagTLBMemberIndex *member_index; /* built on first lookup */
     HREFTYPE hreftype;          /* hreftype for app object binding */
     /* type libs seem to store the doc strings in ascii
      * so why should we do it in unicode?
@@ -1262,14 +1266,22 @@ typedef struct tagITypeInfoImpl
     struct list custdata_list;
 } ITypeInfoImpl;
 
+static void TLB_load_typeinfo(ITypeInfoImpl *info);
+
+/* MSFT typeinfos are only fully loaded when they are first used through
+ * one of their interfaces */
 static inline ITypeInfoImpl *info_impl_from_ITypeComp( ITypeComp *iface )
 {
-    return CONTAINING_RECORD(iface, ITypeInfoImpl, ITypeComp_iface);
+    ITypeInfoImpl *info = CONTAINING_RECORD(iface, ITypeInfoImpl, ITypeComp_iface);
+    if (info->not_loaded) TLB_load_typeinfo(info);
+    return info;
 }
 
 static inline ITypeInfoImpl *impl_from_ITypeInfo2( ITypeInfo2 *iface )
 {
-    return CONTAINING_RECORD(iface, ITypeInfoImpl, ITypeInfo2_iface);
+    ITypeInfoImpl *info = CONTAINING_RECORD(iface, ITypeInfoImpl, ITypeInfo2_iface);
+    if (info->not_loaded) TLB_load_typeinfo(info);
+    return info;
 }
 
 static inline ITypeInfoImpl *impl_from_ITypeInfo( ITypeInfo *iface )
@@ -1277,9 +1289,16 @@ static inline ITypeInfoImpl *impl_from_ITypeInfo( ITypeInfo *iface )
     return impl_from_ITypeInfo2((ITypeInfo2*)iface);
 }
 
+static void TLB_free_member_index(ITypeInfoImpl *info);
+
+/* the members may be changed through ICreateTypeInfo2, so the lookup index
+ * is dropped there */
 static inline ITypeInfoImpl *info_impl_from_ICreateTypeInfo2( ICreateTypeInfo2 *iface )
 {
-    return CONTAINING_RECORD(iface, ITypeInfoImpl, ICreateTypeInfo2_iface);
+    ITypeInfoImpl *info = CONTAINING_RECORD(iface, ITypeInfoImpl, ICreateTypeInfo2_iface);
+    if (info->not_loaded) TLB_load_typeinfo(info);
+    if (info->member_index) TLB_free_member_index(info);
+    return info;
 }
 
 static const ITypeInfo2Vtbl tinfvt;
@@ -1299,6 +1318,31 @@ typedef struct tagTLBContext
 	ITypeLibImpl* pLibInfo;
 } TLBContext;
 
+/* the parts of a MSFT image that are needed to load typeinfos on demand */
+typedef struct tagTLBImage
+{
+    IUnknown *file;             /* keeps the image mapped */
+    void *mapping;
+    unsigned int length;
+    MSFT_SegDir seg_dir;
+    TLBString **names;          /* name table entries, sorted by offset */
+    UINT name_count;
+    TLBString **strings;        /* string table entries, sorted by offset */
+    UINT string_count;
+    TLBGuid **guids;            /* guid table entries, sorted by offset */
+    UINT guid_count;
+    UINT pending;               /* number of typeinfos not loaded yet */
+} TLBImage;
+
+static CRITICAL_SECTION typeinfo_load_section;
+static CRITICAL_SECTION_DEBUG typeinfo_load_section_debug =
+{
+    0, 0, &typeinfo_load_section,
+    { &typeinfo_load_section_debug.ProcessLocksList, &typeinfo_load_section_debug.ProcessLocksList },
+      0, 0, { (DWORD_PTR)(__FILE__ ": typeinfo_load_section") }
+};
+static CRITICAL_SECTION typeinfo_load_section = { &typeinfo_load_section_debug, -1, 0, 0, 0, 0 };
+
 
 static inline BSTR TLB_get_bstr(const TLBString *str)
 {
@@ -1735,6 +1779,133 @@ static inline TLBVarDesc *TLB_get_vardesc_by_name(TLBVarDesc *vardescs,
     return NULL;
 }
 
+/*
+ * Lookup index of the members of a typeinfo, used by GetIDsOfNames and
+ * Invoke. Names are hashed case-insensitively; this is only done when all
+ * member names are plain ASCII identifiers, since lstrcmpiW ignores some
+ * other characters.
+ */
+typedef struct tagTLBMemberIndex
+{
+    UINT hash_mask;             /* hash table size - 1, 0 if names are not hashed */
+    int *names;                 /* member index + 1 for each slot, 0 if empty;
+                                   functions come first, then variables */
+    struct tlb_memid_entry
+    {
+        MEMBERID memid;
+        UINT func;
+    } *memids;                  /* functions sorted by memid, then by index */
+} TLBMemberIndex;
+
+static BOOL TLB_hash_name(const OLECHAR *name, ULONG *hash)
+{
+    ULONG h = 0;
+
+    if (!name || !*name) return FALSE;
+    for (; *name; name++)
+    {
+        WCHAR c = *name;
+
+        if (c >= 'A' && c <= 'Z') c += 'a' - 'A';
+        else if (!(c >= 'a' && c <= 'z') && !(c >= '0' && c <= '9') && c != '_')
+            return FALSE;
+        h = h * 31 + c;
+    }
+    *hash = h;
+    return TRUE;
+}
+
+static int TLB_compare_memids(const void *a, const void *b)
+{
+    const struct tlb_memid_entry *left = a, *right = b;
+
+    if (left->memid != right->memid) return left->memid < right->memid ? -1 : 1;
+    /* keep the functions in their original order */
+    return left->func < right->func ? -1 : left->func > right->func;
+}
+
+static void TLB_free_member_index(ITypeInfoImpl *info)
+{
+    TLBMemberIndex *index = InterlockedExchangePointer((void **)&info->member_index, NULL);
+    heap_free(index);
+}
+
+static TLBMemberIndex *TLB_get_member_index(ITypeInfoImpl *info)
+{
+    UINT count = info->typeattr.cFuncs + info->typeattr.cVars, size, i;
+    TLBMemberIndex *index;
+    const TLBString *name;
+    ULONG hash;
+
+    if (info->member_index) return info->member_index;
+
+    /* a linear search is good enough for small interfaces */
+    if (count < 8) return NULL;
+
+    for (size = 16; size < count * 2; size *= 2);
+
+    index = heap_alloc_zero(sizeof(*index) + size * sizeof(*index->names) +
+                            info->typeattr.cFuncs * sizeof(*index->memids));
+    if (!index) return NULL;
+    index->memids = (void *)(index + 1);
+    index->names = (int *)(index->memids + info->typeattr.cFuncs);
+    index->hash_mask = size - 1;
+
+    for (i = 0; i < info->typeattr.cFuncs; i++)
+    {
+        index->memids[i].memid = info->funcdescs[i].funcdesc.memid;
+        index->memids[i].func = i;
+    }
+    qsort(index->memids, info->typeattr.cFuncs, sizeof(*index->memids), TLB_compare_memids);
+
+    for (i = 0; i < count && index->hash_mask; i++)
+    {
+        UINT slot;
+
+        name = i < info->typeattr.cFuncs ? info->funcdescs[i].Name
+                                         : info->vardescs[i - info->typeattr.cFuncs].Name;
+        if (!TLB_hash_name(TLB_get_bstr(name), &hash))
+        {
+            index->hash_mask = 0;
+            break;
+        }
+
+        for (slot = hash & index->hash_mask; index->names[slot]; slot = (slot + 1) & index->hash_mask)
+        {
+            int member = index->names[slot] - 1;
+            const TLBString *other = member < info->typeattr.cFuncs ? info->funcdescs[member].Name
+                                     : info->vardescs[member - info->typeattr.cFuncs].Name;
+            /* the first member with a given name wins */
+            if (!lstrcmpiW(TLB_get_bstr(other), TLB_get_bstr(name))) break;
+        }
+        if (!index->names[slot]) index->names[slot] = i + 1;
+    }
+
+    if (InterlockedCompareExchangePointer((void **)&info->member_index, index, NULL))
+        heap_free(index);
+    return info->member_index;
+}
+
+/* returns the index of the first member named name, functions first, or -1;
+ * -2 if the index can't be used */
+static int TLB_find_member_by_name(ITypeInfoImpl *info, const OLECHAR *name)
+{
+    TLBMemberIndex *index = TLB_get_member_index(info);
+    ULONG hash;
+    UINT slot;
+
+    if (!index || !index->hash_mask || !TLB_hash_name(name, &hash)) return -2;
+
+    for (slot = hash & index->hash_mask; index->names[slot]; slot = (slot + 1) & index->hash_mask)
+    {
+        int member = index->names[slot] - 1;
+        const TLBString *str = member < info->typeattr.cFuncs ? info->funcdescs[member].Name
+                               : info->vardescs[member - info->typeattr.cFuncs].Name;
+        if (!lstrcmpiW(TLB_get_bstr(str), name)) return member;
+    }
+    return -1;
+}
+
 static inline TLBCustData *TLB_get_custdata_by_guid(struct list *custdata_list, REFGUID guid)
 {
     TLBCustData *cust_data;
@@ -2107,6 +2278,7 @@ static HRESULT MSFT_ReadAllGuids(TLBContext *pcx)
         guid->hreftype = entry.hreftype;
 
         list_add_tail(&pcx->pLibInfo->guid_list, &guid->entry);
+        pcx->pLibInfo->image->guids[pcx->pLibInfo->image->guid_count++] = guid;
 
         offs += sizeof(MSFT_GuidEntry);
     }
@@ -2114,13 +2286,20 @@ static HRESULT MSFT_ReadAllGuids(TLBContext *pcx)
 
 static TLBGuid *MSFT_ReadGuid( int offset, TLBContext *pcx)
 {
-    TLBGuid *ret;
+    TLBImage *image = pcx->pLibInfo->image;
+    int min = 0, max = image->guid_count - 1, pos;
 
-    LIST_FOR_EACH_ENTRY(ret, &pcx->pLibInfo->guid_list, TLBGuid, entry){
-        if(ret->offset == offset){
-            TRACE_(typelib)("%s\n", debugstr_guid(&ret->guid));
-            return ret;
+    /* the table is read in offset order */
+    while (min <= max)
+    {
+        pos = (min + max) / 2;
+        if (image->guids[pos]->offset == offset)
+        {
+            TRACE_(typelib)("%s\n", debugstr_guid(&image->guids[pos]->guid));
+            return image->guids[pos];
         }
+        if (image->guids[pos]->offset < (UINT)offset) min = pos + 1;
+        else max = pos - 1;
     }
 
     return NULL;
@@ -2184,37 +2363,42 @@ static HRESULT MSFT_ReadAllNames(TLBContext *pcx)
         heap_free(string);
 
         list_add_tail(&pcx->pLibInfo->name_list, &tlbstr->entry);
+        pcx->pLibInfo->image->names[pcx->pLibInfo->image->name_count++] = tlbstr;
 
         offs += len_piece;
     }
 }
 
-static TLBString *MSFT_ReadName( TLBContext *pcx, int offset)
+/* looks up a name or string table entry, the tables are read in offset order */
+static TLBString *MSFT_FindString( TLBString **table, UINT count, int offset )
 {
-    TLBString *tlbstr;
+    int min = 0, max = count - 1, pos;
 
-    LIST_FOR_EACH_ENTRY(tlbstr, &pcx->pLibInfo->name_list, TLBString, entry) {
-        if (tlbstr->offset == offset) {
-            TRACE_(typelib)("%s\n", debugstr_w(tlbstr->str));
-            return tlbstr;
+    while (min <= max)
+    {
+        pos = (min + max) / 2;
+        if (table[pos]->offset == offset)
+        {
+            TRACE_(typelib)("%s\n", debugstr_w(table[pos]->str));
+            return table[pos];
         }
+        if (table[pos]->offset < (UINT)offset) min = pos + 1;
+        else max = pos - 1;
     }
 
     return NULL;
 }
 
-static TLBString *MSFT_ReadString( TLBContext *pcx, int offset)
+static TLBString *MSFT_ReadName( TLBContext *pcx, int offset)
 {
-    TLBString *tlbstr;
-
-    LIST_FOR_EACH_ENTRY(tlbstr, &pcx->pLibInfo->string_list, TLBString, entry) {
-        if (tlbstr->offset == offset) {
-            TRACE_(typelib)("%s\n", debugstr_w(tlbstr->str));
-            return tlbstr;
-        }
-    }
+    TLBImage *image = pcx->pLibInfo->image;
+    return MSFT_FindString(image->names, image->name_count, offset);
+}
 
-    return NULL;
+static TLBString *MSFT_ReadString( TLBContext *pcx, int offset)
+{
+    TLBImage *image = pcx->pLibInfo->image;
+    return MSFT_FindString(image->strings, image->string_count, offset);
 }
 
 /*
@@ -2721,6 +2905,27 @@ static ITypeInfoImpl * MSFT_DoTypeInfo(
 /* note: InfoType's Help file and HelpStringDll come from the containing
  * library. Further HelpString and Docstring appear to be the same thing :(
  */
+    /* the members are read when the typeinfo is first used */
+    ptiRet->not_loaded = TRUE;
+
+    TRACE_(typelib)("%s guid: %s kind:%s\n",
+       debugstr_w(TLB_get_bstr(ptiRet->Name)),
+       debugstr_guid(TLB_get_guidref(ptiRet->guid)),
+       typekind_desc[ptiRet->typeattr.typekind]);
+
+    return ptiRet;
+}
+
+/*
+ * process the members of a typeinfo record
+ */
+static void MSFT_DoTypeInfoMembers(TLBContext *pcx, ITypeInfoImpl *ptiRet)
+{
+    MSFT_TypeInfoBase tiBase;
+
+    MSFT_ReadLEDWords(&tiBase, sizeof(tiBase) ,pcx ,
+                      pcx->pTblDir->pTypeInfoTab.offset+ptiRet->index*sizeof(tiBase));
+
     /* functions */
     if(ptiRet->typeattr.cFuncs >0 )
         MSFT_DoFuncs(pcx, ptiRet, ptiRet->typeattr.cFuncs,
@@ -2759,14 +2964,59 @@ static ITypeInfoImpl * MSFT_DoTypeInfo(
     }
     MSFT_CustData(pcx, tiBase.oCustData, ptiRet->pcustdata_list);
 
-    TRACE_(typelib)("%s guid: %s kind:%s\n",
-       debugstr_w(TLB_get_bstr(ptiRet->Name)),
-       debugstr_guid(TLB_get_guidref(ptiRet->guid)),
-       typekind_desc[ptiRet->typeattr.typekind]);
     if (TRACE_ON(typelib))
       dump_TypeInfo(ptiRet);
+}
 
-    return ptiRet;
+static void TLB_free_image(TLBImage *image)
+{
+    IUnknown_Release(image->file);
+    heap_free(image->names);
+    heap_free(image->strings);
+    heap_free(image->guids);
+    heap_free(image);
+}
+
+/* reads the members of a MSFT typeinfo from the image */
+static void TLB_load_typeinfo(ITypeInfoImpl *info)
+{
+    ITypeLibImpl *lib = info->pTypeLib;
+    TLBContext cx;
+
+    EnterCriticalSection(&typeinfo_load_section);
+
+    if (info->not_loaded)
+    {
+        TRACE("loading %s\n", debugstr_w(TLB_get_bstr(info->Name)));
+
+        cx.oStart = 0;
+        cx.pos = 0;
+        cx.length = lib->image->length;
+        cx.mapping = lib->image->mapping;
+        cx.pTblDir = &lib->image->seg_dir;
+        cx.pLibInfo = lib;
+        MSFT_DoTypeInfoMembers(&cx, info);
+
+        /* make sure the members are visible before the flag is cleared */
+        InterlockedExchange((LONG *)&info->not_loaded, FALSE);
+
+        if (!--lib->image->pending)
+        {
+            TLB_free_image(lib->image);
+            lib->image = NULL;
+        }
+    }
+
+    LeaveCriticalSection(&typeinfo_load_section);
+}
+
+static void TLB_load_all_typeinfos(ITypeLibImpl *lib)
+{
+    int i;
+
+    for (i = 0; i < lib->TypeInfoCount; ++i)
+        if (lib->typeinfos[i]->not_loaded)
+            TLB_load_typeinfo(lib->typeinfos[i]);
 }
 
 static HRESULT MSFT_ReadAllStrings(TLBContext *pcx)
@@ -2809,6 +3059,7 @@ static HRESULT MSFT_ReadAllStrings(TLBContext *pcx)
         heap_free(string);
 
         list_add_tail(&pcx->pLibInfo->string_list, &tlbstr->entry);
+        pcx->pLibInfo->image->strings[pcx->pLibInfo->image->string_count++] = tlbstr;
 
         offs += len_piece;
     }
@@ -3393,7 +3644,7 @@ static HRESULT TLB_ReadTypeLib(LPCWSTR pszFileName, LPWSTR pszPath, UINT cchPath
         {
             DWORD dwSignature = FromLEDWord(*((DWORD*) pBase));
             if (dwSignature == MSFT_SIGNATURE)
-                *ppTypeLib = ITypeLib2_Constructor_MSFT(pBase, dwTLBLength);
+                *ppTypeLib = ITypeLib2_Constructor_MSFT(pBase, dwTLBLength, pFile);
             else if (dwSignature == SLTG_SIGNATURE)
                 *ppTypeLib = ITypeLib2_Constructor_SLTG(pBase, dwTLBLength);
             else
@@ -3462,9 +3713,10 @@ static ITypeLibImpl* TypeLibImpl_Constructor(void)
 /****************************************************************************
  *	ITypeLib2_Constructor_MSFT
  *
- * loading an MSFT typelib from an in-memory image
+ * loading an MSFT typelib from an in-memory image, pFile keeps the image
+ * mapped until all typeinfos are loaded
  */
-static ITypeLib2* ITypeLib2_Constructor_MSFT(LPVOID pLib, DWORD dwTLBLength)
+static ITypeLib2* ITypeLib2_Constructor_MSFT(LPVOID pLib, DWORD dwTLBLength, IUnknown *pFile)
 {
     TLBContext cx;
     LONG lPSegDir;
@@ -3513,6 +3765,25 @@ static ITypeLib2* ITypeLib2_Constructor_MSFT(LPVOID pLib, DWORD dwTLBLength)
 	return NULL;
     }
 
+    /* every name and string table entry is at least 8 bytes long */
+    if (!(pTypeLibImpl->image = heap_alloc_zero(sizeof(TLBImage))))
+    {
+        heap_free(pTypeLibImpl);
+        return NULL;
+    }
+    pTypeLibImpl->image->names = heap_alloc(max(tlbSegDir.pNametab.length / 8, 1) * sizeof(TLBString *));
+    pTypeLibImpl->image->strings = heap_alloc(max(tlbSegDir.pStringtab.length / 8, 1) * sizeof(TLBString *));
+    pTypeLibImpl->image->guids = heap_alloc((max(tlbSegDir.pGuidTab.length, 0) / sizeof(MSFT_GuidEntry) + 1) * sizeof(TLBGuid *));
+    if (!pTypeLibImpl->image->names || !pTypeLibImpl->image->strings || !pTypeLibImpl->image->guids)
+    {
+        heap_free(pTypeLibImpl->image->names);
+        heap_free(pTypeLibImpl->image->strings);
+        heap_free(pTypeLibImpl->image->guids);
+        heap_free(pTypeLibImpl->image);
+        heap_free(pTypeLibImpl);
+        return NULL;
+    }
+
     MSFT_ReadAllNames(&cx);
     MSFT_ReadAllStrings(&cx);
     MSFT_ReadAllGuids(&cx);
@@ -3669,6 +3940,14 @@ static ITypeLib2* ITypeLib2_Constructor_MSFT(LPVOID pLib, DWORD dwTLBLength)
         }
     }
 
+    /* the rest is loaded on demand */
+    pTypeLibImpl->image->file = pFile;
+    pTypeLibImpl->image->mapping = pLib;
+    pTypeLibImpl->image->length = dwTLBLength;
+    pTypeLibImpl->image->seg_dir = tlbSegDir;
+    pTypeLibImpl->image->pending = pTypeLibImpl->TypeInfoCount;
+    IUnknown_AddRef(pFile);
+
 #ifdef _WIN64
     if(pTypeLibImpl->syskind == SYS_WIN32){
         for(i = 0; i < pTypeLibImpl->TypeInfoCount; ++i)
@@ -3676,6 +3955,12 @@ static ITypeLib2* ITypeLib2_Constructor_MSFT(LPVOID pLib, DWORD dwTLBLength)
     }
 #endif
 
+    if (pTypeLibImpl->image && !pTypeLibImpl->image->pending)
+    {
+        TLB_free_image(pTypeLibImpl->image);
+        pTypeLibImpl->image = NULL;
+    }
+
     TRACE("(%p)\n", pTypeLibImpl);
     return &pTypeLibImpl->ITypeLib2_iface;
 }
@@ -4813,6 +5098,7 @@ static ULONG WINAPI ITypeLib2_fnRelease( ITypeLib2 *iface)
           ITypeInfoImpl_Destroy(This->typeinfos[i]);
       }
       heap_free(This->typeinfos);
+      if (This->image) TLB_free_image(This->image);
       heap_free(This);
       return 0;
     }
@@ -5065,6 +5351,7 @@ static HRESULT WINAPI ITypeLib2_fnIsName(
 	  pfName);
 
     *pfName=TRUE;
+    TLB_load_all_typeinfos(This);
     for(tic = 0; tic < This->TypeInfoCount; ++tic){
         ITypeInfoImpl *pTInfo = This->typeinfos[tic];
         if(!TLB_str_memcmp(szNameBuf, pTInfo->Name, nNameBufLen)) goto ITypeLib2_fnIsName_exit;
@@ -5117,6 +5404,7 @@ static HRESULT WINAPI ITypeLib2_fnFindName(
         return E_INVALIDARG;
 
     len = (lstrlenW(name) + 1)*sizeof(WCHAR);
+    TLB_load_all_typeinfos(This);
     for(tic = 0; count < *found && tic < This->TypeInfoCount; ++tic) {
         ITypeInfoImpl *pTInfo = This->typeinfos[tic];
         TLBVarDesc *var;
@@ -5381,6 +5669,7 @@ static HRESULT WINAPI ITypeLibComp_fnBind(
     pBindPtr->lptcomp = NULL;
     *ppTInfo = NULL;
 
+    TLB_load_all_typeinfos(This);
     for(i = 0; i < This->TypeInfoCount; ++i){
         ITypeInfoImpl *pTypeInfo = This->typeinfos[i];
         TRACE("testing %s\n", debugstr_w(TLB_get_bstr(pTypeInfo->Name)));
@@ -5616,6 +5905,12 @@ static void ITypeInfoImpl_Destroy(ITypeInfoImpl *This)
 
     TRACE("destroying ITypeInfo(%p)\n",This);
 
+    if (This->not_loaded)
+    {
+        heap_free(This);
+        return;
+    }
+
     for (i = 0; i < This->typeattr.cFuncs; ++i)
     {
         int j;
@@ -5656,6 +5951,7 @@ static void ITypeInfoImpl_Destroy(ITypeInfoImpl *This)
 
     TLB_FreeCustData(&This->custdata_list);
 
+    heap_free(This->member_index);
     heap_free(This);
 }
 
@@ -5673,7 +5969,10 @@ static ULONG WINAPI ITypeInfo_fnRelease(ITypeInfo2 *iface)
         BOOL not_attached_to_typelib = This->not_attached_to_typelib;
         ITypeLib2_Release(&This->pTypeLib->ITypeLib2_iface);
         if (not_attached_to_typelib)
+        {
+            heap_free(This->member_index);
             heap_free(This);
+        }
         /* otherwise This will be freed when typelib is freed */
     }
 
@@ -6276,6 +6575,7 @@ static HRESULT WINAPI ITypeInfo_fnGetIDsOfNames( ITypeInfo2 *iface,
     const TLBVarDesc *pVDesc;
     HRESULT ret=S_OK;
     UINT i, fdc;
+    int member;
 
     TRACE("(%p) Name %s cNames %d\n", This, debugstr_w(*rgszNames),
             cNames);
@@ -6284,7 +6584,20 @@ static HRESULT WINAPI ITypeInfo_fnGetIDsOfNames( ITypeInfo2 *iface,
     for (i = 0; i < cNames; i++)
         pMemId[i] = MEMBERID_NIL;
 
-    for (fdc = 0; fdc < This->typeattr.cFuncs; ++fdc) {
+    /* start the search at the hashed member if there is one */
+    member = TLB_find_member_by_name(This, *rgszNames);
+    if (member >= This->typeattr.cFuncs)
+    {
+        if(cNames)
+            *pMemId = This->vardescs[member - This->typeattr.cFuncs].vardesc.memid;
+        return ret;
+    }
+    else if (member == -1)
+        fdc = This->typeattr.cFuncs;
+    else
+        fdc = max(member, 0);
+
+    for (; fdc < This->typeattr.cFuncs; ++fdc) {
         int j;
         const TLBFuncDesc *pFDesc = &This->funcdescs[fdc];
         if(!lstrcmpiW(*rgszNames, TLB_get_bstr(pFDesc->Name))) {
@@ -6302,7 +6615,7 @@ static HRESULT WINAPI ITypeInfo_fnGetIDsOfNames( ITypeInfo2 *iface,
             return ret;
         }
     }
-    pVDesc = TLB_get_vardesc_by_name(This->vardescs, This->typeattr.cVars, *rgszNames);
+    pVDesc = member == -1 ? NULL : TLB_get_vardesc_by_name(This->vardescs, This->typeattr.cVars, *rgszNames);
     if(pVDesc){
         if(cNames)
             *pMemId = pVDesc->vardesc.memid;
@@ -6664,7 +6977,7 @@ DispCallFunc(
     int argspos, stack_offset;
     void *func;
     UINT i;
-    DWORD *args;
+    DWORD *args, stack_args[8 * sizeof(VARIANT) / sizeof(DWORD) + 2];
 
     TRACE("(%p, %ld, %d, %d, %d, %p, %p, %p (vt=%d))\n",
         pvInstance, oVft, cc, vtReturn, cActuals, prgvt, prgpvarg,
@@ -6676,8 +6989,12 @@ DispCallFunc(
         return E_INVALIDARG;
     }
 
-    /* maximum size for an argument is sizeof(VARIANT) */
-    args = heap_alloc(sizeof(VARIANT) * cActuals + sizeof(DWORD) * 2 );
+    /* maximum size for an argument is sizeof(VARIANT); calls with only a few
+     * pointer sized arguments don't need a heap allocation */
+    if (cActuals <= 8)
+        args = stack_args;
+    else
+        args = heap_alloc(sizeof(VARIANT) * cActuals + sizeof(DWORD) * 2 );
 
     /* start at 1 in case we need to pass a pointer to the return value as arg 0 */
     argspos = 1;
@@ -6744,13 +7061,13 @@ DispCallFunc(
         break;
     case VT_HRESULT:
         WARN("invalid return type %u\n", vtReturn);
-        heap_free( args );
+        if (args != stack_args) heap_free( args );
         return E_INVALIDARG;
     default:
         V_UI4(pvargResult) = call_method( func, argspos - 1, args + 1, &stack_offset );
         break;
     }
-    heap_free( args );
+    if (args != stack_args) heap_free( args );
     if (stack_offset && cc == CC_STDCALL)
     {
         WARN( "stack pointer off by %d\n", stack_offset );
@@ -6763,7 +7080,7 @@ DispCallFunc(
 #elif defined(__x86_64__)
     int argspos;
     UINT i;
-    DWORD_PTR *args;
+    DWORD_PTR *args, stack_args[16];
     void *func;
 
     TRACE("(%p, %ld, %d, %d, %d, %p, %p, %p (vt=%d))\n",
@@ -6777,7 +7094,10 @@ DispCallFunc(
     }
 
     /* maximum size for an argument is sizeof(DWORD_PTR) */
-    args = heap_alloc( sizeof(DWORD_PTR) * (cActuals + 2) );
+    if (cActuals + 2 <= sizeof(stack_args) / sizeof(stack_args[0]))
+        args = stack_args;
+    else
+        args = heap_alloc( sizeof(DWORD_PTR) * (cActuals + 2) );
 
     /* start at 1 in case we need to pass a pointer to the return value as arg 0 */
     argspos = 1;
@@ -6825,13 +7145,13 @@ DispCallFunc(
         break;
     case VT_HRESULT:
         WARN("invalid return type %u\n", vtReturn);
-        heap_free( args );
+        if (args != stack_args) heap_free( args );
         return E_INVALIDARG;
     default:
         V_UI8(pvargResult) = call_method( func, argspos - 1, args + 1 );
         break;
     }
-    heap_free( args );
+    if (args != stack_args) heap_free( args );
     if (vtReturn != VT_VARIANT) V_VT(pvargResult) = vtReturn;
     TRACE("retval: %s\n", debugstr_variant(pvargResult));
     return S_OK;
@@ -6874,6 +7194,7 @@ static HRESULT WINAPI ITypeInfo_fnInvoke(
     TYPEKIND type_kind;
     HRESULT hres;
     const TLBFuncDesc *pFuncInfo;
+    TLBMemberIndex *index;
     UINT fdc;
 
     TRACE("(%p)(%p,id=%d,flags=0x%08x,%p,%p,%p,%p)\n",
@@ -6900,12 +7221,37 @@ static HRESULT WINAPI ITypeInfo_fnInvoke(
 
     /* we do this instead of using GetFuncDesc since it will return a fake
      * FUNCDESC for dispinterfaces and we want the real function description */
-    for (fdc = 0; fdc < This->typeattr.cFuncs; ++fdc){
-        pFuncInfo = &This->funcdescs[fdc];
-        if ((memid == pFuncInfo->funcdesc.memid) &&
-            (wFlags & pFuncInfo->funcdesc.invkind) &&
-            !func_restricted( &pFuncInfo->funcdesc ))
-            break;
+    if ((index = TLB_get_member_index(This)))
+    {
+        int min = 0, max = This->typeattr.cFuncs - 1, pos;
+
+        /* find the first function with this memid */
+        while (min <= max)
+        {
+            pos = (min + max) / 2;
+            if (index->memids[pos].memid < memid) min = pos + 1;
+            else max = pos - 1;
+        }
+        for (fdc = This->typeattr.cFuncs; min < This->typeattr.cFuncs && index->memids[min].memid == memid; min++)
+        {
+            pFuncInfo = &This->funcdescs[index->memids[min].func];
+            if ((wFlags & pFuncInfo->funcdesc.invkind) &&
+                !func_restricted( &pFuncInfo->funcdesc ))
+            {
+                fdc = index->memids[min].func;
+                break;
+            }
+        }
+    }
+    else
+    {
+        for (fdc = 0; fdc < This->typeattr.cFuncs; ++fdc){
+            pFuncInfo = &This->funcdescs[fdc];
+            if ((memid == pFuncInfo->funcdesc.memid) &&
+                (wFlags & pFuncInfo->funcdesc.invkind) &&
+                !func_restricted( &pFuncInfo->funcdesc ))
+                break;
+        }
     }
 
     if (fdc < This->typeattr.cFuncs) {
@@ -6920,7 +7266,9 @@ static HRESULT WINAPI ITypeInfo_fnInvoke(
 	switch (func_desc->funckind) {
 	case FUNC_PUREVIRTUAL:
 	case FUNC_VIRTUAL: {
-            void *buffer = heap_alloc_zero(INVBUF_ELEMENT_SIZE * func_desc->cParams);
+            VARIANTARG stack_buffer[(INVBUF_ELEMENT_SIZE * 8 + sizeof(VARIANTARG) - 1) / sizeof(VARIANTARG)];
+            void *buffer = func_desc->cParams <= 8 ? memset(stack_buffer, 0, INVBUF_ELEMENT_SIZE * func_desc->cParams)
+                                                   : heap_alloc_zero(INVBUF_ELEMENT_SIZE * func_desc->cParams);
             VARIANT varresult;
             VARIANT retval; /* pointer for storing byref retvals in */
             VARIANTARG **prgpvarg = INVBUF_GET_ARG_PTR_ARRAY(buffer, func_desc->cParams);
@@ -7325,7 +7673,7 @@ static HRESULT WINAPI ITypeInfo_fnInvoke(
             }
 
 func_fail:
-            heap_free(buffer);
+            if (buffer != stack_buffer) heap_free(buffer);
             break;
         }
 	case FUNC_DISPATCH:  {
@@ -7606,6 +7954,7 @@ static HRESULT WINAPI ITypeInfo_fnGetRefTypeInfo(
 
         *pTypeInfoImpl = *This;
         pTypeInfoImpl->ref = 0;
+        pTypeInfoImpl->member_index = NULL;
         list_init(&pTypeInfoImpl->custdata_list);
 
         if (This->typeattr.typekind == TKIND_INTERFACE)
@@ -9890,6 +10239,7 @@ static HRESULT WINAPI ICreateTypeLib2_fnSaveAllChanges(ICreateTypeLib2 *iface)
 
     TRACE("%p\n", This);
 
+    TLB_load_all_typeinfos(This);
     for(i = 0; i < This->TypeInfoCount; ++i)
         if(This->typeinfos[i]->needs_layout)
             ICreateTypeInfo2_LayOut(&This->typeinfos[i]->ICreateTypeInfo2_iface);
@@ -747,6 +747,179 @@ static DWORD elem_mem_size(wireSAFEARRAY wiresa, SF_TYPE sftype)
         return wiresa->cbElements;
 }
 
+/* Arrays of strings and variants are handled element by element, but
+ * without going through the exported BSTR and VARIANT user marshal
+ * functions for the common element types, as their per-call overhead
+ * dominates for large arrays. */
+
+static BOOL is_simple_variant_type(VARTYPE vt)
+{
+    switch (vt)
+    {
+    case VT_EMPTY:
+    case VT_NULL:
+    case VT_I1:
+    case VT_UI1:
+    case VT_I2:
+    case VT_UI2:
+    case VT_I4:
+    case VT_UI4:
+    case VT_HRESULT:
+    case VT_INT:
+    case VT_UINT:
+    case VT_R4:
+    case VT_R8:
+    case VT_BOOL:
+    case VT_ERROR:
+    case VT_DATE:
+    case VT_CY:
+        return TRUE;
+    default:
+        return FALSE;
+    }
+}
+
+static ULONG bstr_array_size(ULONG size, BSTR *bstrs, ULONG count)
+{
+    for (; count; count--, bstrs++)
+    {
+        ALIGN_LENGTH(size, 3);
+        size += sizeof(bstr_wire_t) + ((SysStringByteLen(*bstrs) + 1) & ~1);
+    }
+    return size;
+}
+
+static unsigned char *bstr_array_marshal(unsigned char *Buffer, BSTR *bstrs, ULONG count)
+{
+    bstr_wire_t *header;
+    DWORD len;
+
+    for (; count; count--, bstrs++)
+    {
+        len = SysStringByteLen(*bstrs);
+        ALIGN_POINTER(Buffer, 3);
+        header = (bstr_wire_t *)Buffer;
+        header->len = header->len2 = (len + 1) / 2;
+        if (*bstrs)
+        {
+            header->byte_len = len;
+            memcpy(header + 1, *bstrs, header->len * 2);
+        }
+        else
+            header->byte_len = 0xffffffff;
+        Buffer += sizeof(*header) + sizeof(OLECHAR) * header->len;
+    }
+    return Buffer;
+}
+
+static unsigned char *bstr_array_unmarshal(unsigned char *Buffer, BSTR *bstrs, ULONG count)
+{
+    bstr_wire_t *header;
+
+    for (; count; count--, bstrs++)
+    {
+        ALIGN_POINTER(Buffer, 3);
+        header = (bstr_wire_t *)Buffer;
+        if (header->len != header->len2)
+            FIXME("len %08x != len2 %08x\n", header->len, header->len2);
+
+        if (header->byte_len == 0xffffffff)
+        {
+            SysFreeString(*bstrs);
+            *bstrs = NULL;
+        }
+        else if (!*bstrs)
+            *bstrs = SysAllocStringLen((OLECHAR *)(header + 1), header->len);
+        else
+            SysReAllocStringLen(bstrs, (OLECHAR *)(header + 1), header->len);
+        Buffer += sizeof(*header) + sizeof(OLECHAR) * header->len;
+    }
+    return Buffer;
+}
+
+static ULONG variant_array_size(ULONG *pFlags, ULONG size, VARIANT *vars, ULONG count)
+{
+    for (; count; count--, vars++)
+    {
+        if (!is_simple_variant_type(V_VT(vars)))
+        {
+            size = VARIANT_UserSize(pFlags, size, vars);
+            continue;
+        }
+        ALIGN_LENGTH(size, 7);
+        size += sizeof(variant_wire_t);
+        ALIGN_LENGTH(size, get_type_alignment(pFlags, V_VT(vars)));
+        size += get_type_size(pFlags, V_VT(vars));
+    }
+    return size;
+}
+
+static unsigned char *variant_array_marshal(ULONG *pFlags, unsigned char *Buffer, VARIANT *vars, ULONG count)
+{
+    variant_wire_t *header;
+    unsigned char *Pos;
+    ULONG type_size;
+
+    for (; count; count--, vars++)
+    {
+        if (!is_simple_variant_type(V_VT(vars)))
+        {
+            Buffer = VARIANT_UserMarshal(pFlags, Buffer, vars);
+            continue;
+        }
+        ALIGN_POINTER(Buffer, 7);
+        header = (variant_wire_t *)Buffer;
+        header->rpcReserved = 0;
+        header->vt = header->switch_is = vars->n1.n2.vt;
+        header->wReserved1 = vars->n1.n2.wReserved1;
+        header->wReserved2 = vars->n1.n2.wReserved2;
+        header->wReserved3 = vars->n1.n2.wReserved3;
+
+        Pos = (unsigned char *)(header + 1);
+        type_size = get_type_size(pFlags, V_VT(vars));
+        ALIGN_POINTER(Pos, get_type_alignment(pFlags, V_VT(vars)));
+        memcpy(Pos, &vars->n1.n2.n3, type_size);
+        Pos += type_size;
+
+        header->clSize = ((Pos - Buffer) + 7) >> 3;
+        Buffer = Pos;
+    }
+    return Buffer;
+}
+
+static unsigned char *variant_array_unmarshal(ULONG *pFlags, unsigned char *Buffer, VARIANT *vars, ULONG count)
+{
+    variant_wire_t *header;
+    unsigned char *Pos;
+    ULONG type_size;
+
+    for (; count; count--, vars++)
+    {
+        ALIGN_POINTER(Buffer, 7);
+        header = (variant_wire_t *)Buffer;
+        if (!is_simple_variant_type(header->vt))
+        {
+            Buffer = VARIANT_UserUnmarshal(pFlags, Buffer, vars);
+            continue;
+        }
+        if (V_VT(vars) != VT_EMPTY)
+            VariantClear(vars);
+
+        Pos = (unsigned char *)(header + 1);
+        type_size = get_type_size(pFlags, header->vt);
+        ALIGN_POINTER(Pos, get_type_alignment(pFlags, header->vt));
+        memcpy(&vars->n1.n2.n3, Pos, type_size);
+        Pos += type_size;
+
+        vars->n1.n2.vt = header->vt;
+        vars->n1.n2.wReserved1 = header->wReserved1;
+        vars->n1.n2.wReserved2 = header->wReserved2;
+        vars->n1.n2.wReserved3 = header->wReserved3;
+        Buffer = Pos;
+    }
+    return Buffer;
+}
+
 ULONG WINAPI LPSAFEARRAY_UserSize(ULONG *pFlags, ULONG StartingSize, LPSAFEARRAY *ppsa)
 {
     ULONG size = StartingSize;
@@ -780,28 +953,16 @@ ULONG WINAPI LPSAFEARRAY_UserSize(ULONG *pFlags, ULONG StartingSize, LPSAFEARRAY
         switch (sftype)
         {
             case SF_BSTR:
-            {
-                BSTR* lpBstr;
-
-                for (lpBstr = psa->pvData; ulCellCount; ulCellCount--, lpBstr++)
-                    size = BSTR_UserSize(pFlags, size, lpBstr);
-
+                size = bstr_array_size(size, psa->pvData, ulCellCount);
                 break;
-            }
             case SF_DISPATCH:
             case SF_UNKNOWN:
             case SF_HAVEIID:
                 FIXME("size interfaces\n");
                 break;
             case SF_VARIANT:
-            {
-                VARIANT* lpVariant;
-
-                for (lpVariant = psa->pvData; ulCellCount; ulCellCount--, lpVariant++)
-                    size = VARIANT_UserSize(pFlags, size, lpVariant);
-
+                size = variant_array_size(pFlags, size, psa->pvData, ulCellCount);
                 break;
-            }
             case SF_RECORD:
             {
                 IRecordInfo* pRecInfo = NULL;
@@ -901,28 +1062,16 @@ unsigned char * WINAPI LPSAFEARRAY_UserMarshal(ULONG *pFlags, unsigned char *Buf
             switch (sftype)
             {
                 case SF_BSTR:
-                {
-                    BSTR* lpBstr;
-
-                    for (lpBstr = psa->pvData; ulCellCount; ulCellCount--, lpBstr++)
-                        Buffer = BSTR_UserMarshal(pFlags, Buffer, lpBstr);
-
+                    Buffer = bstr_array_marshal(Buffer, psa->pvData, ulCellCount);
                     break;
-                }
                 case SF_DISPATCH:
                 case SF_UNKNOWN:
                 case SF_HAVEIID:
                     FIXME("marshal interfaces\n");
                     break;
                 case SF_VARIANT:
-                {
-                    VARIANT* lpVariant;
-
-                    for (lpVariant = psa->pvData; ulCellCount; ulCellCount--, lpVariant++)
-                        Buffer = VARIANT_UserMarshal(pFlags, Buffer, lpVariant);
-
+                    Buffer = variant_array_marshal(pFlags, Buffer, psa->pvData, ulCellCount);
                     break;
-                }
                 case SF_RECORD:
                 {
                     IRecordInfo* pRecInfo = NULL;
@@ -1078,28 +1227,16 @@ unsigned char * WINAPI LPSAFEARRAY_UserUnmarshal(ULONG *pFlags, unsigned char *B
         switch (sftype)
         {
             case SF_BSTR:
-            {
-                BSTR* lpBstr;
-
-                for (lpBstr = (*ppsa)->pvData; cell_count; cell_count--, lpBstr++)
-                    Buffer = BSTR_UserUnmarshal(pFlags, Buffer, lpBstr);
-
+                Buffer = bstr_array_unmarshal(Buffer, (*ppsa)->pvData, cell_count);
                 break;
-            }
             case SF_DISPATCH:
             case SF_UNKNOWN:
             case SF_HAVEIID:
                 FIXME("marshal interfaces\n");
                 break;
             case SF_VARIANT:
-            {
-                VARIANT* lpVariant;
-
-                for (lpVariant = (*ppsa)->pvData; cell_count; cell_count--, lpVariant++)
-                    Buffer = VARIANT_UserUnmarshal(pFlags, Buffer, lpVariant);
-
+                Buffer = variant_array_unmarshal(pFlags, Buffer, (*ppsa)->pvData, cell_count);
                 break;
-            }
             case SF_RECORD:
             {
                 FIXME("set record info\n");
@@ -952,6 +952,45 @@ HRESULT WINAPI VariantChangeType(VARIANTARG* pvargDest, VARIANTARG* pvargSrc,
   return VariantChangeTypeEx( pvargDest, pvargSrc, LOCALE_USER_DEFAULT, wFlags, vt );
 }
 
+/* Types that can be converted without making a private copy of the source:
+ * plain numbers and strings, which are not by reference or arrays. */
+static inline BOOL VARIANT_IsDirectType(VARTYPE vt)
+{
+  switch (vt)
+  {
+  case VT_EMPTY: case VT_I2:   case VT_I4:  case VT_R4:      case VT_R8:
+  case VT_CY:    case VT_DATE: case VT_BSTR: case VT_BOOL:   case VT_DECIMAL:
+  case VT_I1:    case VT_UI1:  case VT_UI2: case VT_UI4:     case VT_I8:
+  case VT_UI8:   case VT_INT:  case VT_UINT:
+    return TRUE;
+  default:
+    return FALSE;
+  }
+}
+
+/* Convert directly into the destination, saving the copies of the source
+ * and result that the generic path makes. */
+static HRESULT VARIANT_ChangeTypeDirect(VARIANTARG* pvargDest, VARIANTARG* pvargSrc,
+                                        LCID lcid, USHORT wFlags, VARTYPE vt)
+{
+  VARIANTARG vTmp;
+  HRESULT res;
+
+  V_VT(&vTmp) = VT_EMPTY;
+  res = VARIANT_Coerce(&vTmp, lcid, wFlags, pvargSrc, vt);
+  if (SUCCEEDED(res))
+  {
+    V_VT(&vTmp) = vt;
+    /* pvargSrc may be the same as pvargDest, only free it now */
+    res = VariantClear(pvargDest);
+    if (SUCCEEDED(res))
+      *pvargDest = vTmp;
+    else
+      VariantClear(&vTmp);
+  }
+  return res;
+}
+
 /******************************************************************************
  *    VariantChangeTypeEx  [OLEAUT32.147]
  *
@@ -980,7 +1019,9 @@ HRESULT WINAPI VariantChangeTypeEx(VARIANTARG* pvargDest, VARIANTARG* pvargSrc,
   TRACE("(%s,%s,0x%08x,0x%04x,%s)\n", debugstr_variant(pvargDest),
         debugstr_variant(pvargSrc), lcid, wFlags, debugstr_vt(vt));
 
-  if (vt == VT_CLSID)
+  if (VARIANT_IsDirectType(V_VT(pvargSrc)) && VARIANT_IsDirectType(vt))
+    res = VARIANT_ChangeTypeDirect(pvargDest, pvargSrc, lcid, wFlags, vt);
+  else if (vt == VT_CLSID)
     res = DISP_E_BADVARTYPE;
   else
   {
@@ -2754,6 +2795,19 @@ HRESULT WINAPI VarCmp(LPVARIANT left, LPVARIANT right, LCID lcid, DWORD flags)
 
     TRACE("(%s,%s,0x%08x,0x%08x)\n", debugstr_variant(left), debugstr_variant(right), lcid, flags);
 
+#define _VARCMP(a,b) \
+    (((a) == (b)) ? VARCMP_EQ : (((a) < (b)) ? VARCMP_LT : VARCMP_GT))
+
+    /* Fast paths for the most common numeric comparisons */
+    if (V_VT(left) == VT_I4 && V_VT(right) == VT_I4)
+        return _VARCMP(V_I4(left), V_I4(right));
+    if (V_VT(left) == VT_R8 && V_VT(right) == VT_R8)
+        return _VARCMP(V_R8(left), V_R8(right));
+    if (V_VT(left) == VT_I4 && V_VT(right) == VT_R8)
+        return _VARCMP((double)V_I4(left), V_R8(right));
+    if (V_VT(left) == VT_R8 && V_VT(right) == VT_I4)
+        return _VARCMP(V_R8(left), (double)V_I4(right));
+
     lvt = V_VT(left) & VT_TYPEMASK;
     rvt = V_VT(right) & VT_TYPEMASK;
     xmask = (1 << lvt) | (1 << rvt);
@@ -2891,9 +2945,6 @@ HRESULT WINAPI VarCmp(LPVARIANT left, LPVARIANT right, LCID lcid, DWORD flags)
     if (FAILED(rc))
         return rc;
 
-#define _VARCMP(a,b) \
-    (((a) == (b)) ? VARCMP_EQ : (((a) < (b)) ? VARCMP_LT : VARCMP_GT))
-
     switch (vt) {
         case VT_CY:
             return VarCyCmp(V_CY(&lv), V_CY(&rv));
@@ -3211,6 +3262,53 @@ HRESULT WINAPI VarAdd(LPVARIANT left, LPVARIANT right, LPVARIANT result)
 
     TRACE("(%s,%s,%p)\n", debugstr_variant(left), debugstr_variant(right), result);
 
+    /* Fast paths for the most common operand types. The results match the
+       generic coercion below: I4 overflows into R8, mixed I4 and R8 give R8
+       and two BSTRs are concatenated. */
+    if (V_VT(left) == VT_I4 && V_VT(right) == VT_I4)
+    {
+        LONG64 sum = (LONG64)V_I4(left) + V_I4(right);
+
+        if (sum >= I4_MIN && sum <= I4_MAX)
+        {
+            V_VT(result) = VT_I4;
+            V_I4(result) = sum;
+        }
+        else
+        {
+            V_VT(result) = VT_R8;
+            V_R8(result) = sum;
+        }
+        return S_OK;
+    }
+    if ((V_VT(left) == VT_R8 || V_VT(left) == VT_I4) &&
+        (V_VT(right) == VT_R8 || V_VT(right) == VT_I4))
+    {
+        double l = V_VT(left) == VT_R8 ? V_R8(left) : V_I4(left);
+        double r = V_VT(right) == VT_R8 ? V_R8(right) : V_I4(right);
+
+        V_VT(result) = VT_R8;
+        V_R8(result) = l + r;
+        return S_OK;
+    }
+    if (V_VT(left) == VT_BSTR && V_VT(right) == VT_BSTR)
+    {
+        BSTR str;
+
+        hres = VarBstrCat(V_BSTR(left), V_BSTR(right), &str);
+        if (hres == S_OK)
+        {
+            V_VT(result) = VT_BSTR;
+            V_BSTR(result) = str;
+        }
+        else
+        {
+            V_VT(result) = VT_EMPTY;
+            V_I4(result) = 0;       /* No V_EMPTY */
+        }
+        return hres;
+    }
+
     VariantInit(&lv);
     VariantInit(&rv);
     VariantInit(&tv);
@@ -6462,6 +6462,37 @@ HRESULT WINAPI VarBstrFromI4(LONG lIn, LCID lcid, ULONG dwFlags, BSTR* pbstrOut)
   return VARIANT_BstrFromUInt(ul64, lcid, dwFlags, pbstrOut);
 }
 
+static CRITICAL_SECTION decimal_cs;
+static CRITICAL_SECTION_DEBUG decimal_cs_debug =
+{
+    0, 0, &decimal_cs,
+    { &decimal_cs_debug.ProcessLocksList, &decimal_cs_debug.ProcessLocksList },
+      0, 0, { (DWORD_PTR)(__FILE__ ": decimal_cs") }
+};
+static CRITICAL_SECTION decimal_cs = { &decimal_cs_debug, -1, 0, 0, 0, 0 };
+
+/* Get the decimal separator of a locale. Looking it up is expensive, so the
+   last one used is cached, as VARIANT_GetLocalisedNumberChars does. */
+static void VARIANT_GetDecimalSeparator(LCID lcid, ULONG dwFlags, WCHAR *sep, int len)
+{
+  static WCHAR lastSep[16];
+  static LCID lastLcid = -1;
+  static ULONG lastFlags;
+
+  dwFlags &= LOCALE_NOUSEROVERRIDE;
+
+  EnterCriticalSection(&decimal_cs);
+  if (lcid != lastLcid || dwFlags != lastFlags)
+  {
+    lastSep[0] = '\0';
+    GetLocaleInfoW(lcid, LOCALE_SDECIMAL | dwFlags, lastSep, sizeof(lastSep) / sizeof(WCHAR));
+    lastLcid = lcid;
+    lastFlags = dwFlags;
+  }
+  lstrcpynW(sep, lastSep, len);
+  LeaveCriticalSection(&decimal_cs);
+}
+
 static BSTR VARIANT_BstrReplaceDecimal(const WCHAR * buff, LCID lcid, ULONG dwFlags)
 {
   BSTR bstrOut;
@@ -6474,8 +6505,7 @@ static BSTR VARIANT_BstrReplaceDecimal(const WCHAR * buff, LCID lcid, ULONG dwFl
      the need to replace the decimal separator, and if so, will prepare an
      appropriate NUMBERFMTW structure to do the job via GetNumberFormatW().
    */
-  GetLocaleInfoW(lcid, LOCALE_SDECIMAL | (dwFlags & LOCALE_NOUSEROVERRIDE),
-                 lpDecimalSep, sizeof(lpDecimalSep) / sizeof(WCHAR));
+  VARIANT_GetDecimalSeparator(lcid, dwFlags, lpDecimalSep, sizeof(lpDecimalSep) / sizeof(WCHAR));
   if (lpDecimalSep[0] == '.' && lpDecimalSep[1] == '\0')
   {
     /* locale is compatible with English - return original string */
@@ -6518,10 +6548,21 @@ static HRESULT VARIANT_BstrFromReal(DOUBLE dblIn, LCID lcid, ULONG dwFlags,
                                     BSTR* pbstrOut, LPCWSTR lpszFormat)
 {
   WCHAR buff[256];
+  double limit = lpszFormat == szFloatFormatW ? 1e7 : 1e15;
 
   if (!pbstrOut)
     return E_INVALIDARG;
 
+  /* Whole numbers that the format prints without an exponent or decimal
+     separator don't need any locale handling. */
+  if (!(dwFlags & LOCALE_USE_NLS) && dblIn > -limit && dblIn < limit &&
+      dblIn == (LONG64)dblIn)
+  {
+    if (dblIn < 0)
+      return VARIANT_BstrFromUInt(-(LONG64)dblIn, lcid, dwFlags | VAR_NEGATIVE, pbstrOut);
+    return VARIANT_BstrFromUInt((LONG64)dblIn, lcid, dwFlags, pbstrOut);
+  }
+
   sprintfW( buff, lpszFormat, dblIn );
 
   /* Negative zeroes are disallowed (some applications depend on this).
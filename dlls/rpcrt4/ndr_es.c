@@ -410,6 +410,7 @@ void WINAPIV NdrMesProcEncodeDecode(handle_t Handle, const MIDL_STUB_DESC * pStu
     const RPC_CLIENT_INTERFACE *client_interface;
     __ms_va_list args;
     unsigned int number_of_params;
+    const unsigned char *sizes;
     ULONG_PTR arg_buffer[256];
 
     TRACE("Handle %p, pStubDesc %p, pFormat %p, ...\n", Handle, pStubDesc, pFormat);
@@ -481,20 +482,21 @@ void WINAPIV NdrMesProcEncodeDecode(handle_t Handle, const MIDL_STUB_DESC * pStu
 
     pFormat = convert_old_args( &pEsMsg->StubMsg, pFormat, stack_size, FALSE,
                                 arg_buffer, sizeof(arg_buffer), &number_of_params );
+    sizes = get_simple_type_sizes( pFormat, number_of_params, TRUE );
 
     switch (pEsMsg->Operation)
     {
     case MES_ENCODE:
         pEsMsg->StubMsg.BufferLength = mes_proc_header_buffer_size();
 
-        client_do_args( &pEsMsg->StubMsg, pFormat, STUBLESS_CALCSIZE, NULL, number_of_params, NULL );
+        client_do_args( &pEsMsg->StubMsg, pFormat, STUBLESS_CALCSIZE, NULL, number_of_params, sizes, NULL );
 
         pEsMsg->ByteCount = pEsMsg->StubMsg.BufferLength - mes_proc_header_buffer_size();
         es_data_alloc(pEsMsg, pEsMsg->StubMsg.BufferLength);
 
         mes_proc_header_marshal(pEsMsg);
 
-        client_do_args( &pEsMsg->StubMsg, pFormat, STUBLESS_MARSHAL, NULL, number_of_params, NULL );
+        client_do_args( &pEsMsg->StubMsg, pFormat, STUBLESS_MARSHAL, NULL, number_of_params, sizes, NULL );
 
         es_data_write(pEsMsg, pEsMsg->ByteCount);
         break;
@@ -503,7 +505,7 @@ void WINAPIV NdrMesProcEncodeDecode(handle_t Handle, const MIDL_STUB_DESC * pStu
 
         es_data_read(pEsMsg, pEsMsg->ByteCount);
 
-        client_do_args( &pEsMsg->StubMsg, pFormat, STUBLESS_UNMARSHAL, NULL, number_of_params, NULL );
+        client_do_args( &pEsMsg->StubMsg, pFormat, STUBLESS_UNMARSHAL, NULL, number_of_params, sizes, NULL );
         break;
     default:
         RpcRaiseException(RPC_S_INTERNAL_ERROR);
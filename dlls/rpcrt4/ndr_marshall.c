@@ -6812,6 +6812,41 @@ static void WINAPI NdrBaseTypeBufferSize(
     }
 }
 
+/***********************************************************************
+ *           ndr_simple_type_buffer_size [internal]
+ *
+ * The following functions are used by the interpreter for base types that
+ * have the same size in memory and on the wire.
+ */
+void ndr_simple_type_buffer_size(PMIDL_STUB_MESSAGE pStubMsg, unsigned int size)
+{
+    align_length(&pStubMsg->BufferLength, size);
+    safe_buffer_length_increment(pStubMsg, size);
+}
+
+/***********************************************************************
+ *           ndr_simple_type_marshall [internal]
+ */
+void ndr_simple_type_marshall(PMIDL_STUB_MESSAGE pStubMsg, const unsigned char *pMemory, unsigned int size)
+{
+    align_pointer_clear(&pStubMsg->Buffer, size);
+    safe_copy_to_buffer(pStubMsg, pMemory, size);
+}
+
+/***********************************************************************
+ *           ndr_simple_type_unmarshall [internal]
+ */
+void ndr_simple_type_unmarshall(PMIDL_STUB_MESSAGE pStubMsg, unsigned char **ppMemory, unsigned int size)
+{
+    align_pointer(&pStubMsg->Buffer, size);
+    if (!pStubMsg->IsClient && !*ppMemory)
+    {
+        *ppMemory = pStubMsg->Buffer;
+        safe_buffer_increment(pStubMsg, size);
+    }
+    else safe_copy_from_buffer(pStubMsg, *ppMemory, size);
+}
+
 /***********************************************************************
  *           NdrBaseTypeMemorySize [internal]
  */
@@ -421,8 +421,113 @@ static void client_free_handle(
     }
 }
 
+/* A procedure is described by the same parameter list on every call, so
+ * the interpretation of the parameters is done once per procedure and
+ * looked up once per call.  -Oif procedures are keyed on the address of
+ * their parameter list; old style procedures convert it into a temporary
+ * buffer on each call, so those are keyed on its contents.  For now this
+ * records which parameters are base types that can be copied as they are,
+ * these then bypass the format tables.  Entries are never freed. */
+
+#define NDR_PROC_CACHE_BUCKETS 64
+#define NDR_PROC_CACHE_MAX     4096
+
+struct ndr_proc_cache
+{
+    struct ndr_proc_cache *next;
+    const NDR_PARAM_OIF *params;   /* parameter list, or a copy of a converted one */
+    unsigned short number_of_params;
+    unsigned char simple_size[1];  /* size of simple base type parameters, 0 for the others */
+};
+
+static struct ndr_proc_cache *ndr_proc_cache[NDR_PROC_CACHE_BUCKETS];
+static LONG ndr_proc_cache_count;
+
+static unsigned char simple_type_size(const NDR_PARAM_OIF *param)
+{
+    if (!param->attr.IsBasetype) return 0;
+
+    switch (param->u.type_format_char)
+    {
+    case RPC_FC_BYTE:
+    case RPC_FC_CHAR:
+    case RPC_FC_SMALL:
+    case RPC_FC_USMALL:
+        return 1;
+    case RPC_FC_WCHAR:
+    case RPC_FC_SHORT:
+    case RPC_FC_USHORT:
+        return 2;
+    case RPC_FC_LONG:
+    case RPC_FC_ULONG:
+    case RPC_FC_ERROR_STATUS_T:
+    case RPC_FC_ENUM32:
+    case RPC_FC_FLOAT:
+        return 4;
+    case RPC_FC_HYPER:
+    case RPC_FC_DOUBLE:
+        return 8;
+    default:
+        /* enum16 and int3264 differ in memory and on the wire */
+        return 0;
+    }
+}
+
+const unsigned char *get_simple_type_sizes( PFORMAT_STRING pFormat, unsigned short number_of_params,
+                                            BOOL converted )
+{
+    const NDR_PARAM_OIF *params = (const NDR_PARAM_OIF *)pFormat;
+    const unsigned char *bytes = pFormat;
+    struct ndr_proc_cache **bucket, *entry;
+    NDR_PARAM_OIF *copy = NULL;
+    unsigned int i, hash = number_of_params;
+    SIZE_T size;
+
+    if (converted)
+        for (i = 0; i < number_of_params * sizeof(*params); i++)
+            hash = hash * 31 + bytes[i];
+    else
+        hash = (ULONG_PTR)params / sizeof(USHORT);
+    bucket = &ndr_proc_cache[hash % NDR_PROC_CACHE_BUCKETS];
+
+    for (entry = *bucket; entry; entry = entry->next)
+    {
+        if (entry->number_of_params != number_of_params) continue;
+        if (converted ? !memcmp( entry->params, params, number_of_params * sizeof(*params) )
+                      : entry->params == params)
+            return entry->simple_size;
+    }
+
+    if (InterlockedIncrement( &ndr_proc_cache_count ) > NDR_PROC_CACHE_MAX) return NULL;
+
+    size = FIELD_OFFSET(struct ndr_proc_cache, simple_size[number_of_params]);
+    /* the parameter descriptions only contain USHORTs and bytes */
+    if (converted) size += number_of_params * sizeof(*params) + sizeof(USHORT) - 1;
+    if (!(entry = HeapAlloc( GetProcessHeap(), 0, size ))) return NULL;
+    if (converted)
+    {
+        copy = (NDR_PARAM_OIF *)(((ULONG_PTR)&entry->simple_size[number_of_params] + sizeof(USHORT) - 1) &
+                                 ~(ULONG_PTR)(sizeof(USHORT) - 1));
+        memcpy( copy, params, number_of_params * sizeof(*params) );
+    }
+    for (i = 0; i < number_of_params; i++)
+        entry->simple_size[i] = simple_type_size( &params[i] );
+    entry->params = converted ? copy : params;
+    entry->number_of_params = number_of_params;
+
+    do entry->next = *bucket;
+    while (InterlockedCompareExchangePointer( (void **)bucket, entry, entry->next ) != entry->next);
+    return entry->simple_size;
+}
+
+static inline unsigned char *simple_type_memory( unsigned char *pArg, const NDR_PARAM_OIF *param )
+{
+    return param->attr.IsSimpleRef ? *(unsigned char **)pArg : pArg;
+}
+
 void client_do_args( PMIDL_STUB_MESSAGE pStubMsg, PFORMAT_STRING pFormat, enum stubless_phase phase,
-                     void **fpu_args, unsigned short number_of_params, unsigned char *pRetVal )
+                     void **fpu_args, unsigned short number_of_params, const unsigned char *sizes,
+                     unsigned char *pRetVal )
 {
     const NDR_PARAM_OIF *params = (const NDR_PARAM_OIF *)pFormat;
     unsigned int i;
@@ -431,6 +536,7 @@ void client_do_args( PMIDL_STUB_MESSAGE pStubMsg, PFORMAT_STRING pFormat, enum s
     {
         unsigned char *pArg = pStubMsg->StackTop + params[i].stack_offset;
         PFORMAT_STRING pTypeFormat = (PFORMAT_STRING)&pStubMsg->StubDesc->pFormatTypes[params[i].u.type_offset];
+        unsigned int size = sizes ? sizes[i] : 0;
 
 #ifdef __x86_64__  /* floats are passed as doubles through varargs functions */
         float f;
@@ -461,16 +567,24 @@ void client_do_args( PMIDL_STUB_MESSAGE pStubMsg, PFORMAT_STRING pFormat, enum s
         case STUBLESS_CALCSIZE:
             if (params[i].attr.IsSimpleRef && !*(unsigned char **)pArg)
                 RpcRaiseException(RPC_X_NULL_REF_POINTER);
-            if (params[i].attr.IsIn) call_buffer_sizer(pStubMsg, pArg, &params[i]);
+            if (!params[i].attr.IsIn) break;
+            if (size) ndr_simple_type_buffer_size(pStubMsg, size);
+            else call_buffer_sizer(pStubMsg, pArg, &params[i]);
             break;
         case STUBLESS_MARSHAL:
-            if (params[i].attr.IsIn) call_marshaller(pStubMsg, pArg, &params[i]);
+            if (!params[i].attr.IsIn) break;
+            if (size) ndr_simple_type_marshall(pStubMsg, simple_type_memory(pArg, &params[i]), size);
+            else call_marshaller(pStubMsg, pArg, &params[i]);
             break;
         case STUBLESS_UNMARSHAL:
             if (params[i].attr.IsOut)
             {
                 if (params[i].attr.IsReturn && pRetVal) pArg = pRetVal;
-                call_unmarshaller(pStubMsg, &pArg, &params[i], 0);
+                if (size)
+                    ndr_simple_type_unmarshall(pStubMsg, params[i].attr.IsSimpleRef ?
+                                               (unsigned char **)pArg : &pArg, size);
+                else
+                    call_unmarshaller(pStubMsg, &pArg, &params[i], 0);
             }
             break;
         case STUBLESS_FREE:
@@ -586,6 +700,7 @@ PFORMAT_STRING convert_old_args( PMIDL_STUB_MESSAGE pStubMsg, PFORMAT_STRING pFo
         }
         if (args[i].attr.IsBasetype)
         {
+            args[i].u.type_offset = 0;  /* the parameter cache compares all the bytes */
             args[i].u.type_format_char = param->type_format_char;
             stack_offset += type_stack_size( param->type_format_char );
             pFormat += sizeof(NDR_PARAM_OI_BASETYPE);
@@ -615,6 +730,8 @@ LONG_PTR CDECL ndr_client_call( PMIDL_STUB_DESC pStubDesc, PFORMAT_STRING pForma
     unsigned short stack_size;
     /* number of parameters. optional for client to give it to us */
     unsigned int number_of_params;
+    /* cached sizes of the simple parameters */
+    const unsigned char *sizes;
     /* cache of Oif_flags from v2 procedure header */
     INTERPRETER_OPT_FLAGS Oif_flags = { 0 };
     /* cache of extension flags from NDR_PROC_HEADER_EXTS */
@@ -714,6 +831,7 @@ LONG_PTR CDECL ndr_client_call( PMIDL_STUB_DESC pStubDesc, PFORMAT_STRING pForma
                                     /* reuse the correlation cache, it's not needed for v1 format */
                                     NdrCorrCache, sizeof(NdrCorrCache), &number_of_params );
     }
+    sizes = get_simple_type_sizes( pFormat, number_of_params, !is_oicf_stubdesc(pStubDesc) );
 
     stubMsg.BufferLength = 0;
 
@@ -757,7 +875,7 @@ LONG_PTR CDECL ndr_client_call( PMIDL_STUB_DESC pStubDesc, PFORMAT_STRING pForma
         {
             TRACE( "INITOUT\n" );
             client_do_args(&stubMsg, pFormat, STUBLESS_INITOUT, fpu_stack,
-                           number_of_params, (unsigned char *)&RetVal);
+                           number_of_params, sizes, (unsigned char *)&RetVal);
         }
 
         __TRY
@@ -765,7 +883,7 @@ LONG_PTR CDECL ndr_client_call( PMIDL_STUB_DESC pStubDesc, PFORMAT_STRING pForma
             /* 2. CALCSIZE */
             TRACE( "CALCSIZE\n" );
             client_do_args(&stubMsg, pFormat, STUBLESS_CALCSIZE, fpu_stack,
-                           number_of_params, (unsigned char *)&RetVal);
+                           number_of_params, sizes, (unsigned char *)&RetVal);
 
             /* 3. GETBUFFER */
             TRACE( "GETBUFFER\n" );
@@ -796,7 +914,7 @@ LONG_PTR CDECL ndr_client_call( PMIDL_STUB_DESC pStubDesc, PFORMAT_STRING pForma
             /* 4. MARSHAL */
             TRACE( "MARSHAL\n" );
             client_do_args(&stubMsg, pFormat, STUBLESS_MARSHAL, fpu_stack,
-                           number_of_params, (unsigned char *)&RetVal);
+                           number_of_params, sizes, (unsigned char *)&RetVal);
 
             /* 5. SENDRECEIVE */
             TRACE( "SENDRECEIVE\n" );
@@ -834,7 +952,7 @@ LONG_PTR CDECL ndr_client_call( PMIDL_STUB_DESC pStubDesc, PFORMAT_STRING pForma
             /* 6. UNMARSHAL */
             TRACE( "UNMARSHAL\n" );
             client_do_args(&stubMsg, pFormat, STUBLESS_UNMARSHAL, fpu_stack,
-                           number_of_params, (unsigned char *)&RetVal);
+                           number_of_params, sizes, (unsigned char *)&RetVal);
         }
         __EXCEPT_ALL
         {
@@ -843,7 +961,7 @@ LONG_PTR CDECL ndr_client_call( PMIDL_STUB_DESC pStubDesc, PFORMAT_STRING pForma
                 /* 7. FREE */
                 TRACE( "FREE\n" );
                 client_do_args(&stubMsg, pFormat, STUBLESS_FREE, fpu_stack,
-                               number_of_params, (unsigned char *)&RetVal);
+                               number_of_params, sizes, (unsigned char *)&RetVal);
                 RetVal = NdrProxyErrorHandler(GetExceptionCode());
             }
             else
@@ -879,7 +997,7 @@ LONG_PTR CDECL ndr_client_call( PMIDL_STUB_DESC pStubDesc, PFORMAT_STRING pForma
         /* 2. CALCSIZE */
         TRACE( "CALCSIZE\n" );
         client_do_args(&stubMsg, pFormat, STUBLESS_CALCSIZE, fpu_stack,
-                       number_of_params, (unsigned char *)&RetVal);
+                       number_of_params, sizes, (unsigned char *)&RetVal);
 
         /* 3. GETBUFFER */
         TRACE( "GETBUFFER\n" );
@@ -901,7 +1019,7 @@ LONG_PTR CDECL ndr_client_call( PMIDL_STUB_DESC pStubDesc, PFORMAT_STRING pForma
         /* 4. MARSHAL */
         TRACE( "MARSHAL\n" );
         client_do_args(&stubMsg, pFormat, STUBLESS_MARSHAL, fpu_stack,
-                       number_of_params, (unsigned char *)&RetVal);
+                       number_of_params, sizes, (unsigned char *)&RetVal);
 
         /* 5. SENDRECEIVE */
         TRACE( "SENDRECEIVE\n" );
@@ -928,7 +1046,7 @@ LONG_PTR CDECL ndr_client_call( PMIDL_STUB_DESC pStubDesc, PFORMAT_STRING pForma
         /* 6. UNMARSHAL */
         TRACE( "UNMARSHAL\n" );
         client_do_args(&stubMsg, pFormat, STUBLESS_UNMARSHAL, fpu_stack,
-                       number_of_params, (unsigned char *)&RetVal);
+                       number_of_params, sizes, (unsigned char *)&RetVal);
     }
 
     if (ext_flags.HasNewCorrDesc)
@@ -1139,7 +1257,7 @@ LONG_PTR __cdecl call_server_func(SERVER_ROUTINE func, unsigned char * args, uns
 
 static LONG_PTR *stub_do_args(MIDL_STUB_MESSAGE *pStubMsg,
                               PFORMAT_STRING pFormat, enum stubless_phase phase,
-                              unsigned short number_of_params)
+                              unsigned short number_of_params, const unsigned char *sizes)
 {
     const NDR_PARAM_OIF *params = (const NDR_PARAM_OIF *)pFormat;
     unsigned int i;
@@ -1149,6 +1267,7 @@ static LONG_PTR *stub_do_args(MIDL_STUB_MESSAGE *pStubMsg,
     {
         unsigned char *pArg = pStubMsg->StackTop + params[i].stack_offset;
         const unsigned char *pTypeFormat = &pStubMsg->StubDesc->pFormatTypes[params[i].u.type_offset];
+        unsigned int size = sizes ? sizes[i] : 0;
 
         TRACE("param[%d]: %p -> %p type %02x %s\n", i,
               pArg, *(unsigned char **)pArg,
@@ -1158,8 +1277,9 @@ static LONG_PTR *stub_do_args(MIDL_STUB_MESSAGE *pStubMsg,
         switch (phase)
         {
         case STUBLESS_MARSHAL:
-            if (params[i].attr.IsOut || params[i].attr.IsReturn)
-                call_marshaller(pStubMsg, pArg, &params[i]);
+            if (!params[i].attr.IsOut && !params[i].attr.IsReturn) break;
+            if (size) ndr_simple_type_marshall(pStubMsg, simple_type_memory(pArg, &params[i]), size);
+            else call_marshaller(pStubMsg, pArg, &params[i]);
             break;
         case STUBLESS_MUSTFREE:
             if (params[i].attr.MustFree)
@@ -1208,12 +1328,17 @@ static LONG_PTR *stub_do_args(MIDL_STUB_MESSAGE *pStubMsg,
                 *(void **)pArg = HeapAlloc(GetProcessHeap(), HEAP_ZERO_MEMORY,
                                            params[i].attr.ServerAllocSize * 8);
 
-            if (params[i].attr.IsIn)
+            if (!params[i].attr.IsIn) break;
+            if (size)
+                ndr_simple_type_unmarshall(pStubMsg, params[i].attr.IsSimpleRef ?
+                                           (unsigned char **)pArg : &pArg, size);
+            else
                 call_unmarshaller(pStubMsg, &pArg, &params[i], 0);
             break;
         case STUBLESS_CALCSIZE:
-            if (params[i].attr.IsOut || params[i].attr.IsReturn)
-                call_buffer_sizer(pStubMsg, pArg, &params[i]);
+            if (!params[i].attr.IsOut && !params[i].attr.IsReturn) break;
+            if (size) ndr_simple_type_buffer_size(pStubMsg, size);
+            else call_buffer_sizer(pStubMsg, pArg, &params[i]);
             break;
         default:
             RpcRaiseException(RPC_S_INTERNAL_ERROR);
@@ -1251,6 +1376,8 @@ LONG WINAPI NdrStubCall2(
     unsigned short stack_size;
     /* number of parameters. optional for client to give it to us */
     unsigned int number_of_params;
+    /* cached sizes of the simple parameters */
+    const unsigned char *sizes;
     /* cache of Oif_flags from v2 procedure header */
     INTERPRETER_OPT_FLAGS Oif_flags = { 0 };
     /* cache of extension flags from NDR_PROC_HEADER_EXTS */
@@ -1394,6 +1521,7 @@ LONG WINAPI NdrStubCall2(
                                     /* reuse the correlation cache, it's not needed for v1 format */
                                     NdrCorrCache, sizeof(NdrCorrCache), &number_of_params );
     }
+    sizes = get_simple_type_sizes( pFormat, number_of_params, !is_oicf_stubdesc(pStubDesc) );
 
     /* convert strings, floating point values and endianness into our
      * preferred format */
@@ -1459,7 +1587,7 @@ LONG WINAPI NdrStubCall2(
         case STUBLESS_MARSHAL:
         case STUBLESS_MUSTFREE:
         case STUBLESS_FREE:
-            retval_ptr = stub_do_args(&stubMsg, pFormat, phase, number_of_params);
+            retval_ptr = stub_do_args(&stubMsg, pFormat, phase, number_of_params, sizes);
             break;
         default:
             ERR("shouldn't reach here. phase %d\n", phase);
@@ -1528,6 +1656,8 @@ struct async_call_data
     unsigned short stack_size;
     /* number of parameters. optional for client to give it to us */
     unsigned int number_of_params;
+    /* cached sizes of the simple parameters */
+    const unsigned char *sizes;
     /* correlation cache */
     ULONG_PTR NdrCorrCache[256];
 };
@@ -1637,6 +1767,8 @@ LONG_PTR CDECL ndr_async_client_call( PMIDL_STUB_DESC pStubDesc, PFORMAT_STRING
     }
 
     async_call_data->pParamFormat = pFormat;
+    async_call_data->sizes = get_simple_type_sizes( pFormat, async_call_data->number_of_params,
+                                                    !is_oicf_stubdesc(pStubDesc) );
 
     pStubMsg->BufferLength = 0;
 
@@ -1675,7 +1807,8 @@ LONG_PTR CDECL ndr_async_client_call( PMIDL_STUB_DESC pStubDesc, PFORMAT_STRING
 
     /* 1. CALCSIZE */
     TRACE( "CALCSIZE\n" );
-    client_do_args(pStubMsg, pFormat, STUBLESS_CALCSIZE, NULL, async_call_data->number_of_params, NULL);
+    client_do_args(pStubMsg, pFormat, STUBLESS_CALCSIZE, NULL, async_call_data->number_of_params,
+                   async_call_data->sizes, NULL);
 
     /* 2. GETBUFFER */
     TRACE( "GETBUFFER\n" );
@@ -1700,7 +1833,8 @@ LONG_PTR CDECL ndr_async_client_call( PMIDL_STUB_DESC pStubDesc, PFORMAT_STRING
 
     /* 3. MARSHAL */
     TRACE( "MARSHAL\n" );
-    client_do_args(pStubMsg, pFormat, STUBLESS_MARSHAL, NULL, async_call_data->number_of_params, NULL);
+    client_do_args(pStubMsg, pFormat, STUBLESS_MARSHAL, NULL, async_call_data->number_of_params,
+                   async_call_data->sizes, NULL);
 
     /* 4. SENDRECEIVE */
     TRACE( "SEND\n" );
@@ -1788,7 +1922,7 @@ RPC_STATUS NdrpCompleteAsyncClientCall(RPC_ASYNC_STATE *pAsync, void *Reply)
     /* 2. UNMARSHAL */
     TRACE( "UNMARSHAL\n" );
     client_do_args(pStubMsg, async_call_data->pParamFormat, STUBLESS_UNMARSHAL,
-                   NULL, async_call_data->number_of_params, Reply);
+                   NULL, async_call_data->number_of_params, async_call_data->sizes, Reply);
 
 cleanup:
     if (pStubMsg->fHasNewCorrDesc)
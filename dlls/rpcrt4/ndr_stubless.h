@@ -242,8 +242,11 @@ LONG_PTR CDECL ndr_client_call( PMIDL_STUB_DESC pStubDesc, PFORMAT_STRING pForma
                                 void **stack_top, void **fpu_stack ) DECLSPEC_HIDDEN;
 LONG_PTR CDECL ndr_async_client_call( PMIDL_STUB_DESC pStubDesc, PFORMAT_STRING pFormat,
                                       void **stack_top ) DECLSPEC_HIDDEN;
+const unsigned char *get_simple_type_sizes( PFORMAT_STRING pFormat, unsigned short number_of_params,
+                                            BOOL converted ) DECLSPEC_HIDDEN;
 void client_do_args( PMIDL_STUB_MESSAGE pStubMsg, PFORMAT_STRING pFormat, enum stubless_phase phase,
-                     void **fpu_args, unsigned short number_of_params, unsigned char *pRetVal ) DECLSPEC_HIDDEN;
+                     void **fpu_args, unsigned short number_of_params, const unsigned char *sizes,
+                     unsigned char *pRetVal ) DECLSPEC_HIDDEN;
 PFORMAT_STRING convert_old_args( PMIDL_STUB_MESSAGE pStubMsg, PFORMAT_STRING pFormat,
                                  unsigned int stack_size, BOOL object_proc,
                                  void *buffer, unsigned int size, unsigned int *count ) DECLSPEC_HIDDEN;
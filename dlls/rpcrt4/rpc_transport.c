@@ -252,30 +252,13 @@ static char *ncalrpc_pipe_name(const char *endpoint)
   static const char prefix[] = "\\\\.\\pipe\\lrpc\\";
   char *pipe_name;
 
-  /* protseq=ncalrpc: supposed to use NT LPC ports,
-   * but we'll implement it with named pipes for now */
+  /* protseq=ncalrpc: supposed to use NT LPC ports, we use a named pipe to
+   * set up the connection and then switch to shared memory, see below */
   pipe_name = I_RpcAllocate(sizeof(prefix) + strlen(endpoint));
   strcat(strcpy(pipe_name, prefix), endpoint);
   return pipe_name;
 }
 
-static RPC_STATUS rpcrt4_ncalrpc_open(RpcConnection* Connection)
-{
-  RpcConnection_np *npc = (RpcConnection_np *) Connection;
-  RPC_STATUS r;
-  LPSTR pname;
-
-  /* already connected? */
-  if (npc->pipe)
-    return RPC_S_OK;
-
-  pname = ncalrpc_pipe_name(Connection->Endpoint);
-  r = rpcrt4_conn_open_pipe(Connection, pname, TRUE);
-  I_RpcFree(pname);
-
-  return r;
-}
-
 static RPC_STATUS rpcrt4_protseq_ncalrpc_open_endpoint(RpcServerProtseq* protseq, const char *endpoint)
 {
   RPC_STATUS r;
@@ -789,6 +772,362 @@ static int rpcrt4_protseq_np_wait_for_new_connection(RpcServerProtseq *protseq,
     }
 }
 
+/**** ncalrpc shared memory support ****/
+
+/* An ncalrpc connection starts out as a named pipe.  The client then
+ * creates a section holding one ring buffer for each direction and two
+ * events, and sends the handles to the server in a handshake message.
+ * Once the server has acknowledged it, all the RPC traffic goes through
+ * the rings; the pipe is only kept around for impersonation.  If anything
+ * goes wrong during the handshake both sides simply stay on the pipe.
+ * The handle values are only meaningful in the process that opened the
+ * other end of the pipe, so the peer is always identified through the
+ * pipe itself, never through anything it sends us. */
+
+#define LRPC_HANDSHAKE_MAGIC 0x4352504c  /* "LRPC", can't be the start of an RPC packet */
+#define LRPC_RING_SIZE       0x10000
+#define LRPC_SPIN_COUNT      4000
+
+struct lrpc_handshake
+{
+  DWORD magic;
+  DWORD section;
+  DWORD events[2];
+};
+
+struct lrpc_handshake_reply
+{
+  DWORD magic;
+  DWORD status;
+};
+
+struct lrpc_ring
+{
+  LONG head;  /* total number of bytes written */
+  LONG tail;  /* total number of bytes read */
+  char data[LRPC_RING_SIZE];
+};
+
+struct lrpc_shared
+{
+  LONG waiting[2];            /* the side is about to wait on its event */
+  LONG closed;
+  struct lrpc_ring ring[2];   /* indexed by the writing side */
+};
+
+enum lrpc_side
+{
+  LRPC_CLIENT,
+  LRPC_SERVER
+};
+
+typedef struct _RpcConnection_lrpc
+{
+  RpcConnection_np np;
+  struct lrpc_shared *shared;
+  HANDLE section;
+  HANDLE events[2];           /* indexed by the side waiting on it */
+  HANDLE peer;                /* the other process, to notice when it dies */
+  enum lrpc_side side;
+  BOOL handshake_done;
+  struct lrpc_handshake pending;  /* first message of a client not using shared memory */
+  unsigned int pending_pos, pending_len;
+} RpcConnection_lrpc;
+
+static RpcConnection *rpcrt4_conn_lrpc_alloc(void)
+{
+  RpcConnection_lrpc *lrpc = HeapAlloc(GetProcessHeap(), HEAP_ZERO_MEMORY, sizeof(RpcConnection_lrpc));
+  return &lrpc->np.common;
+}
+
+static void rpcrt4_lrpc_free_shared(RpcConnection_lrpc *lrpc)
+{
+  unsigned int i;
+
+  if (lrpc->shared) UnmapViewOfFile(lrpc->shared);
+  if (lrpc->section) CloseHandle(lrpc->section);
+  for (i = 0; i < ARRAYSIZE(lrpc->events); i++)
+    if (lrpc->events[i]) CloseHandle(lrpc->events[i]);
+  if (lrpc->peer) CloseHandle(lrpc->peer);
+
+  lrpc->shared = NULL;
+  lrpc->section = lrpc->peer = 0;
+  lrpc->events[0] = lrpc->events[1] = 0;
+}
+
+static void rpcrt4_lrpc_client_handshake(RpcConnection_lrpc *lrpc)
+{
+  struct lrpc_handshake msg;
+  struct lrpc_handshake_reply reply;
+  ULONG pid;
+  unsigned int i;
+
+  lrpc->side = LRPC_CLIENT;
+  lrpc->handshake_done = TRUE;
+
+  lrpc->section = CreateFileMappingW(INVALID_HANDLE_VALUE, NULL, PAGE_READWRITE,
+                                     0, sizeof(struct lrpc_shared), NULL);
+  if (!lrpc->section) return;
+  lrpc->shared = MapViewOfFile(lrpc->section, FILE_MAP_WRITE, 0, 0, 0);
+  for (i = 0; i < ARRAYSIZE(lrpc->events); i++)
+    lrpc->events[i] = CreateEventW(NULL, FALSE, FALSE, NULL);
+  if (!lrpc->shared || !lrpc->events[0] || !lrpc->events[1])
+  {
+    /* no handshake, the server will notice and stay on the pipe */
+    rpcrt4_lrpc_free_shared(lrpc);
+    return;
+  }
+
+  msg.magic = LRPC_HANDSHAKE_MAGIC;
+  msg.section = HandleToULong(lrpc->section);
+  for (i = 0; i < ARRAYSIZE(lrpc->events); i++)
+    msg.events[i] = HandleToULong(lrpc->events[i]);
+
+  if (rpcrt4_conn_np_write(&lrpc->np.common, &msg, sizeof(msg)) < 0 ||
+      rpcrt4_conn_np_read(&lrpc->np.common, &reply, sizeof(reply)) < 0 ||
+      reply.magic != LRPC_HANDSHAKE_MAGIC || reply.status != RPC_S_OK)
+  {
+    WARN("server refused shared memory, using the pipe\n");
+    rpcrt4_lrpc_free_shared(lrpc);
+    return;
+  }
+
+  /* without it we can't notice the server dying, but the connection still works */
+  if (!GetNamedPipeServerProcessId(lrpc->np.pipe, &pid) ||
+      !(lrpc->peer = OpenProcess(SYNCHRONIZE, FALSE, pid)))
+    WARN("couldn't open the server process, error %d\n", GetLastError());
+  TRACE("using shared memory %p\n", lrpc->shared);
+}
+
+static BOOL rpcrt4_lrpc_server_handshake(RpcConnection_lrpc *lrpc)
+{
+  struct lrpc_handshake *msg = &lrpc->pending;
+  struct lrpc_handshake_reply reply;
+  HANDLE client, process = GetCurrentProcess();
+  MEMORY_BASIC_INFORMATION info;
+  RPC_STATUS status = RPC_S_OK;
+  ULONG pid = 0;
+  BOOL ret;
+  unsigned int i;
+
+  lrpc->side = LRPC_SERVER;
+  lrpc->handshake_done = TRUE;
+
+  if (rpcrt4_conn_np_read(&lrpc->np.common, msg, sizeof(*msg)) < 0)
+    return FALSE;
+
+  if (msg->magic != LRPC_HANDSHAKE_MAGIC)
+  {
+    /* client only talks over the pipe, give the data back to the caller */
+    lrpc->pending_pos = 0;
+    lrpc->pending_len = sizeof(*msg);
+    return TRUE;
+  }
+
+  ret = GetNamedPipeClientProcessId(lrpc->np.pipe, &pid) &&
+        (client = OpenProcess(PROCESS_DUP_HANDLE | SYNCHRONIZE, FALSE, pid)) != NULL;
+  if (ret)
+  {
+    lrpc->peer = client;
+    ret = DuplicateHandle(client, ULongToHandle(msg->section), process, &lrpc->section,
+                          0, FALSE, DUPLICATE_SAME_ACCESS);
+  }
+  for (i = 0; ret && i < ARRAYSIZE(lrpc->events); i++)
+    ret = DuplicateHandle(client, ULongToHandle(msg->events[i]), process, &lrpc->events[i],
+                          0, FALSE, DUPLICATE_SAME_ACCESS);
+  if (ret)
+    ret = (lrpc->shared = MapViewOfFile(lrpc->section, FILE_MAP_WRITE, 0, 0, 0)) != NULL;
+  if (!ret)
+  {
+    WARN("couldn't map the shared memory of process %04x, error %d\n", pid, GetLastError());
+    rpcrt4_lrpc_free_shared(lrpc);
+    status = RPC_S_OUT_OF_RESOURCES;
+  }
+  /* the section comes from the client, don't trust its size */
+  else if (!VirtualQuery(lrpc->shared, &info, sizeof(info)) ||
+           info.RegionSize < sizeof(struct lrpc_shared))
+  {
+    WARN("shared memory of process %04x is too small\n", pid);
+    rpcrt4_lrpc_free_shared(lrpc);
+    status = RPC_S_PROTOCOL_ERROR;
+  }
+
+  reply.magic = LRPC_HANDSHAKE_MAGIC;
+  reply.status = status;
+  return rpcrt4_conn_np_write(&lrpc->np.common, &reply, sizeof(reply)) >= 0;
+}
+
+static RPC_STATUS rpcrt4_ncalrpc_open(RpcConnection* Connection)
+{
+  RpcConnection_lrpc *lrpc = (RpcConnection_lrpc *) Connection;
+  RPC_STATUS r;
+  LPSTR pname;
+
+  /* already connected? */
+  if (lrpc->np.pipe)
+    return RPC_S_OK;
+
+  pname = ncalrpc_pipe_name(Connection->Endpoint);
+  r = rpcrt4_conn_open_pipe(Connection, pname, TRUE);
+  I_RpcFree(pname);
+
+  if (r == RPC_S_OK)
+    rpcrt4_lrpc_client_handshake(lrpc);
+
+  return r;
+}
+
+static inline ULONG rpcrt4_lrpc_get(LONG *ptr)
+{
+  return InterlockedCompareExchange(ptr, 0, 0);
+}
+
+static BOOL rpcrt4_lrpc_ready(struct lrpc_ring *ring, BOOL write)
+{
+  ULONG used = rpcrt4_lrpc_get(&ring->head) - rpcrt4_lrpc_get(&ring->tail);
+  return write ? used < LRPC_RING_SIZE : used != 0;
+}
+
+static void rpcrt4_lrpc_wake_peer(RpcConnection_lrpc *lrpc)
+{
+  enum lrpc_side peer = !lrpc->side;
+
+  /* only go through the server when the other side is actually sleeping */
+  if (rpcrt4_lrpc_get(&lrpc->shared->waiting[peer]))
+    SetEvent(lrpc->events[peer]);
+}
+
+static BOOL rpcrt4_lrpc_wait(RpcConnection_lrpc *lrpc, struct lrpc_ring *ring, BOOL write)
+{
+  struct lrpc_shared *shared = lrpc->shared;
+  HANDLE handles[2];
+  unsigned int i;
+
+  /* replies usually come back quickly, so spin for a while before sleeping */
+  for (i = 0; i < LRPC_SPIN_COUNT; i++)
+  {
+    if (rpcrt4_lrpc_ready(ring, write)) return TRUE;
+    if (rpcrt4_lrpc_get(&shared->closed)) return FALSE;
+    YieldProcessor();
+  }
+
+  handles[0] = lrpc->events[lrpc->side];
+  handles[1] = lrpc->peer;
+  InterlockedExchange(&shared->waiting[lrpc->side], 1);
+  while (!rpcrt4_lrpc_ready(ring, write) && !rpcrt4_lrpc_get(&shared->closed))
+  {
+    if (WaitForMultipleObjects(lrpc->peer ? 2 : 1, handles, FALSE, INFINITE) != WAIT_OBJECT_0)
+    {
+      WARN("peer went away\n");
+      break;
+    }
+  }
+  InterlockedExchange(&shared->waiting[lrpc->side], 0);
+  return rpcrt4_lrpc_ready(ring, write);
+}
+
+static int rpcrt4_lrpc_ring_read(RpcConnection_lrpc *lrpc, char *buf, unsigned int count)
+{
+  struct lrpc_ring *ring = &lrpc->shared->ring[!lrpc->side];
+  unsigned int bytes_left = count;
+
+  while (bytes_left)
+  {
+    ULONG tail = ring->tail, avail = rpcrt4_lrpc_get(&ring->head) - tail;
+    ULONG offset = tail % LRPC_RING_SIZE, len;
+
+    if (!avail)
+    {
+      if (!rpcrt4_lrpc_wait(lrpc, ring, FALSE)) return -1;
+      continue;
+    }
+    len = min(min(avail, bytes_left), LRPC_RING_SIZE - offset);
+    memcpy(buf, ring->data + offset, len);
+    InterlockedExchange(&ring->tail, tail + len);
+    rpcrt4_lrpc_wake_peer(lrpc);
+    bytes_left -= len;
+    buf += len;
+  }
+  return count;
+}
+
+static int rpcrt4_lrpc_ring_write(RpcConnection_lrpc *lrpc, const char *buf, unsigned int count)
+{
+  struct lrpc_ring *ring = &lrpc->shared->ring[lrpc->side];
+  unsigned int bytes_left = count;
+
+  if (rpcrt4_lrpc_get(&lrpc->shared->closed)) return -1;
+
+  while (bytes_left)
+  {
+    ULONG head = ring->head, space = LRPC_RING_SIZE - (head - rpcrt4_lrpc_get(&ring->tail));
+    ULONG offset = head % LRPC_RING_SIZE, len;
+
+    if (!space)
+    {
+      if (!rpcrt4_lrpc_wait(lrpc, ring, TRUE)) return -1;
+      continue;
+    }
+    len = min(min(space, bytes_left), LRPC_RING_SIZE - offset);
+    memcpy(ring->data + offset, buf, len);
+    InterlockedExchange(&ring->head, head + len);
+    rpcrt4_lrpc_wake_peer(lrpc);
+    bytes_left -= len;
+    buf += len;
+  }
+  return count;
+}
+
+static int rpcrt4_conn_lrpc_read(RpcConnection *Connection, void *buffer, unsigned int count)
+{
+  RpcConnection_lrpc *lrpc = (RpcConnection_lrpc *) Connection;
+  char *buf = buffer;
+  unsigned int len = 0;
+  int ret;
+
+  if (Connection->server && !lrpc->handshake_done && !rpcrt4_lrpc_server_handshake(lrpc))
+    return -1;
+
+  if (lrpc->pending_pos < lrpc->pending_len)
+  {
+    len = min(count, lrpc->pending_len - lrpc->pending_pos);
+    memcpy(buf, (char *)&lrpc->pending + lrpc->pending_pos, len);
+    lrpc->pending_pos += len;
+    if (len == count) return count;
+  }
+
+  if (lrpc->shared)
+    ret = rpcrt4_lrpc_ring_read(lrpc, buf + len, count - len);
+  else
+    ret = rpcrt4_conn_np_read(Connection, buf + len, count - len);
+  return ret < 0 ? -1 : count;
+}
+
+static int rpcrt4_conn_lrpc_write(RpcConnection *Connection, const void *buffer, unsigned int count)
+{
+  RpcConnection_lrpc *lrpc = (RpcConnection_lrpc *) Connection;
+
+  if (Connection->server && !lrpc->handshake_done && !rpcrt4_lrpc_server_handshake(lrpc))
+    return -1;
+
+  if (lrpc->shared)
+    return rpcrt4_lrpc_ring_write(lrpc, buffer, count);
+  return rpcrt4_conn_np_write(Connection, buffer, count);
+}
+
+static int rpcrt4_conn_lrpc_close(RpcConnection *Connection)
+{
+  RpcConnection_lrpc *lrpc = (RpcConnection_lrpc *) Connection;
+
+  if (lrpc->shared)
+  {
+    InterlockedExchange(&lrpc->shared->closed, 1);
+    SetEvent(lrpc->events[!lrpc->side]);
+    rpcrt4_lrpc_free_shared(lrpc);
+  }
+  return rpcrt4_conn_np_close(Connection);
+}
+
 static size_t rpcrt4_ncalrpc_get_top_of_tower(unsigned char *tower_data,
                                               const char *networkaddr,
                                               const char *endpoint)
@@ -3395,12 +3734,12 @@ static const struct connection_ops conn_protseq_list[] = {
   },
   { "ncalrpc",
     { EPM_PROTOCOL_NCALRPC, EPM_PROTOCOL_PIPE },
-    rpcrt4_conn_np_alloc,
+    rpcrt4_conn_lrpc_alloc,
     rpcrt4_ncalrpc_open,
     rpcrt4_ncalrpc_handoff,
-    rpcrt4_conn_np_read,
-    rpcrt4_conn_np_write,
-    rpcrt4_conn_np_close,
+    rpcrt4_conn_lrpc_read,
+    rpcrt4_conn_lrpc_write,
+    rpcrt4_conn_lrpc_close,
     rpcrt4_conn_np_cancel_call,
     rpcrt4_ncalrpc_np_is_server_listening,
     rpcrt4_conn_np_wait_for_incoming_data,
@@ -154,6 +154,36 @@ int __cdecl s_str_length(const char *s)
   return strlen(s);
 }
 
+int __cdecl s_sum_interpreted(int x, int y)
+{
+  return x + y;
+}
+
+signed char __cdecl s_sum_char_interpreted(signed char x, signed char y)
+{
+  return x + y;
+}
+
+short __cdecl s_sum_short_interpreted(short x, short y)
+{
+  return x + y;
+}
+
+void __cdecl s_square_out_interpreted(int x, int *y)
+{
+  *y = s_square(x);
+}
+
+void __cdecl s_square_ref_interpreted(int *x)
+{
+  *x = s_square(*x);
+}
+
+int __cdecl s_str_length_interpreted(const char *s)
+{
+  return strlen(s);
+}
+
 int __cdecl s_str_t_length(str_t s)
 {
   return strlen(s);
@@ -903,6 +933,20 @@ basic_tests(void)
   square_ref(&x);
   ok(x == 25, "RPC square_ref\n");
 
+  x = sum_interpreted(23, -4);
+  ok(x == 19, "RPC sum_interpreted got %d\n", x);
+  c = sum_char_interpreted(-23, 50);
+  ok(c == 27, "RPC sum_char_interpreted got %d\n", (int)c);
+  h = sum_short_interpreted(1122, -344);
+  ok(h == 778, "RPC sum_short_interpreted got %d\n", (int)h);
+  x = 0;
+  square_out_interpreted(11, &x);
+  ok(x == 121, "RPC square_out_interpreted\n");
+  x = 5;
+  square_ref_interpreted(&x);
+  ok(x == 25, "RPC square_ref_interpreted\n");
+  ok(str_length_interpreted(string) == strlen(string), "RPC str_length_interpreted\n");
+
   ok(str_length(string) == strlen(string), "RPC str_length\n");
   ok(str_t_length(string) == strlen(string), "RPC str_length\n");
   ok(dot_self(&a) == 59, "RPC dot_self\n");
@@ -1532,6 +1576,25 @@ void __cdecl s_authinfo_test(unsigned int protseq, int secure)
     }
 }
 
+static void
+big_array_tests(void)
+{
+  /* larger than the buffers used by the transports */
+  int n = 300000, i, sum = 0, *x;
+
+  x = HeapAlloc(GetProcessHeap(), 0, n * sizeof(*x));
+  for (i = 0; i < n; i++)
+  {
+    x[i] = i % 101;
+    sum += x[i];
+  }
+  ok(sum_conf_array(x, n) == sum, "RPC sum_conf_array\n");
+  ok(sum_conf_array(x + 1, n - 1) == sum, "RPC sum_conf_array\n");
+  for (i = 7, sum = 0; i < 7 + 65536 / sizeof(int) + 3; i++) sum += x[i];
+  ok(sum_conf_array(x + 7, 65536 / sizeof(int) + 3) == sum, "RPC sum_conf_array\n");
+  HeapFree(GetProcessHeap(), 0, x);
+}
+
 static void
 run_tests(void)
 {
@@ -1539,9 +1602,50 @@ run_tests(void)
   union_tests();
   pointer_tests();
   array_tests();
+  big_array_tests();
   context_handle_test();
 }
 
+static void
+benchmark_calls(const char *protseq)
+{
+  static const char string[] = "I am a string";
+  int n = 300000, i, *x, y;
+  DWORD start, elapsed;
+
+  start = GetTickCount();
+  for (i = 0; i < 100000; i++)
+    int_return();
+  elapsed = max(GetTickCount() - start, 1);
+  trace("%s: %u calls/s, %.2f us per call\n", protseq, 100000 * 1000 / elapsed, elapsed * 10.0 / 1000);
+
+#define BENCHMARK_CALL(name, call) \
+  do { \
+    start = GetTickCount(); \
+    for (i = 0; i < 100000; i++) call; \
+    trace("%s: %s: %u ms\n", protseq, name, GetTickCount() - start); \
+  } while (0)
+
+  BENCHMARK_CALL("sum", sum(i, 1));
+  BENCHMARK_CALL("sum_interpreted", sum_interpreted(i, 1));
+  BENCHMARK_CALL("sum_char", sum_char(i, 1));
+  BENCHMARK_CALL("sum_char_interpreted", sum_char_interpreted(i, 1));
+  BENCHMARK_CALL("square_ref", (y = i, square_ref(&y)));
+  BENCHMARK_CALL("square_ref_interpreted", (y = i, square_ref_interpreted(&y)));
+  BENCHMARK_CALL("str_length", str_length(string));
+  BENCHMARK_CALL("str_length_interpreted", str_length_interpreted(string));
+#undef BENCHMARK_CALL
+
+  x = HeapAlloc(GetProcessHeap(), 0, n * sizeof(*x));
+  memset(x, 0, n * sizeof(*x));
+  start = GetTickCount();
+  for (i = 0; i < 200; i++)
+    sum_conf_array(x, n);
+  elapsed = max(GetTickCount() - start, 1);
+  trace("%s: %u MB/s\n", protseq, (DWORD)((ULONGLONG)200 * n * sizeof(*x) * 1000 / elapsed / (1024 * 1024)));
+  HeapFree(GetProcessHeap(), 0, x);
+}
+
 static void
 set_auth_info(RPC_BINDING_HANDLE handle)
 {
@@ -1624,6 +1728,8 @@ client(const char *test)
     run_tests(); /* can cause RPC_X_BAD_STUB_DATA exception */
     authinfo_test(RPC_PROTSEQ_LRPC, 0);
     test_is_server_listening(IServer_IfHandle, RPC_S_OK);
+    if (winetest_interactive)
+      benchmark_calls("ncalrpc");
 
     ok(RPC_S_OK == RpcStringFreeA(&binding), "RpcStringFree\n");
     ok(RPC_S_OK == RpcBindingFree(&IServer_IfHandle), "RpcBindingFree\n");
@@ -1648,6 +1754,8 @@ client(const char *test)
     test_is_server_listening(IServer_IfHandle, RPC_S_OK);
     run_tests();
     authinfo_test(RPC_PROTSEQ_NMP, 0);
+    if (winetest_interactive)
+      benchmark_calls("ncacn_np");
     test_is_server_listening(IServer_IfHandle, RPC_S_OK);
     stop();
     test_is_server_listening(IServer_IfHandle, RPC_S_NOT_LISTENING);
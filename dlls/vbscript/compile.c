@@ -65,6 +65,7 @@ typedef struct {
     function_decl_t *func_decls;
 
     class_desc_t *classes;
+    dim_decl_t *class_props;
 } compile_ctx_t;
 
 static HRESULT compile_expression(compile_ctx_t*,expression_t*);
@@ -1324,6 +1325,89 @@ static HRESULT fill_array_desc(compile_ctx_t *ctx, dim_decl_t *dim_decl, array_d
     return S_OK;
 }
 
+static BOOL is_func_ret_val(function_t *func, const WCHAR *name)
+{
+    return (func->type == FUNC_FUNCTION || func->type == FUNC_PROPGET || func->type == FUNC_DEFGET)
+        && !strcmpiW(name, func->name);
+}
+
+/* Uses the same order as lookup_identifier and the slot layout of local_var in interp.c. */
+static BOOL lookup_local_slot(compile_ctx_t *ctx, function_t *func, const WCHAR *name, unsigned *ret)
+{
+    dim_decl_t *prop_decl;
+    unsigned i;
+
+    for(i=0; i < func->var_cnt; i++) {
+        if(!strcmpiW(func->vars[i].name, name)) {
+            *ret = i;
+            return TRUE;
+        }
+    }
+
+    for(i=0; i < func->arg_cnt; i++) {
+        if(!strcmpiW(func->args[i].name, name)) {
+            *ret = func->var_cnt + i;
+            return TRUE;
+        }
+    }
+
+    for(prop_decl = ctx->class_props, i=0; prop_decl; prop_decl = prop_decl->next, i++) {
+        if(!strcmpiW(prop_decl->name, name)) {
+            *ret = func->var_cnt + func->arg_cnt + i;
+            return TRUE;
+        }
+    }
+
+    return FALSE;
+}
+
+static void bind_local_identifiers(compile_ctx_t *ctx, function_t *func)
+{
+    instr_t *instr;
+    unsigned slot;
+
+    if(func->type == FUNC_GLOBAL)
+        return;
+
+    for(instr = ctx->code->instrs+func->code_off; instr < ctx->code->instrs+ctx->instr_cnt; instr++) {
+        switch(instr->op) {
+        case OP_icall:
+            if(lookup_local_slot(ctx, func, instr->arg1.bstr, &slot)) {
+                instr->op = OP_local;
+                instr->arg1.uint = slot;
+            }
+            break;
+        case OP_assign_ident:
+            if(!is_func_ret_val(func, instr->arg1.bstr) && lookup_local_slot(ctx, func, instr->arg1.bstr, &slot)) {
+                instr->op = OP_assign_local;
+                instr->arg1.uint = slot;
+            }
+            break;
+        case OP_set_ident:
+            if(!instr->arg2.uint && !is_func_ret_val(func, instr->arg1.bstr)
+                    && lookup_local_slot(ctx, func, instr->arg1.bstr, &slot)) {
+                instr->op = OP_set_local;
+                instr->arg1.uint = slot;
+            }
+            break;
+        case OP_incc:
+            if(!is_func_ret_val(func, instr->arg1.bstr) && lookup_local_slot(ctx, func, instr->arg1.bstr, &slot)) {
+                instr->op = OP_incc_local;
+                instr->arg1.uint = slot;
+            }
+            break;
+        case OP_step:
+            if(lookup_local_slot(ctx, func, instr->arg2.bstr, &slot)) {
+                instr->op = OP_step_local;
+                instr->arg2.uint = slot;
+            }
+            break;
+        default:
+            break;
+        }
+    }
+}
+
 static HRESULT compile_func(compile_ctx_t *ctx, statement_t *stat, function_t *func)
 {
     HRESULT hres;
@@ -1417,6 +1501,8 @@ static HRESULT compile_func(compile_ctx_t *ctx, statement_t *stat, function_t *f
         }
     }
 
+    bind_local_identifiers(ctx, func);
+
     if(func->array_cnt) {
         unsigned array_id = 0;
         dim_decl_t *dim_decl;
@@ -1611,6 +1697,8 @@ static HRESULT compile_class(compile_ctx_t *ctx, class_decl_t *class_decl)
         return E_OUTOFMEMORY;
     memset(class_desc->funcs, 0, class_desc->func_cnt*sizeof(*class_desc->funcs));
 
+    ctx->class_props = class_decl->props;
+
     for(func_decl = class_decl->funcs, i=1; func_decl; func_decl = func_decl->next, i++) {
         for(func_prop_decl = func_decl; func_prop_decl; func_prop_decl = func_prop_decl->next_prop_func) {
             if(func_prop_decl->type == FUNC_DEFGET) {
@@ -1640,6 +1728,8 @@ static HRESULT compile_class(compile_ctx_t *ctx, class_decl_t *class_decl)
             return hres;
     }
 
+    ctx->class_props = NULL;
+
     for(prop_decl = class_decl->props; prop_decl; prop_decl = prop_decl->next)
         class_desc->prop_cnt++;
 
@@ -1827,6 +1917,7 @@ HRESULT compile_script(script_ctx_t *script, const WCHAR *src, const WCHAR *deli
     ctx.func_decls = NULL;
     ctx.global_vars = NULL;
     ctx.classes = NULL;
+    ctx.class_props = NULL;
     ctx.labels = NULL;
     ctx.global_consts = NULL;
     ctx.stat_ctx = NULL;
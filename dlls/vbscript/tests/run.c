@@ -2093,6 +2093,104 @@ static void run_from_res(const char *name)
     SysFreeString(str);
 }
 
+static void test_local_identifiers(void)
+{
+    static const struct {
+        const char *name;
+        const char *src;
+    } benchmarks[] = {
+        {"loop",
+         "Sub benchLoop(n)\n"
+         "Dim i, x\n"
+         "x = 0\n"
+         "For i = 1 To n\n"
+         "x = x + 1\n"
+         "Next\n"
+         "Call ok(x = n, \"x = \" & x)\n"
+         "End Sub\n"
+         "benchLoop %u\n"},
+        {"string",
+         "Sub benchString(n)\n"
+         "Dim i, s\n"
+         "s = \"\"\n"
+         "For i = 1 To n\n"
+         "s = s & \"x\"\n"
+         "If Len(s) > 64 Then s = \"\"\n"
+         "Next\n"
+         "End Sub\n"
+         "benchString %u\n"},
+        {"class",
+         "Class BenchClass\n"
+         "Public counter\n"
+         "Public Sub Run(n)\n"
+         "Dim i\n"
+         "For i = 1 To n\n"
+         "counter = counter + 1\n"
+         "Next\n"
+         "End Sub\n"
+         "End Class\n"
+         "Sub benchClass(n)\n"
+         "Dim obj\n"
+         "Set obj = New BenchClass\n"
+         "obj.counter = 0\n"
+         "obj.Run n\n"
+         "Call ok(obj.counter = n, \"obj.counter = \" & obj.counter)\n"
+         "End Sub\n"
+         "benchClass %u\n"},
+    };
+    char buf[2048];
+    DWORD start, ticks;
+    unsigned i, n;
+
+    parse_script_a("Class LocalsClass\n"
+                   "Public prop\n"
+                   "Private arr(3)\n"
+                   "Public Function Sum(x)\n"
+                   "Dim i, total\n"
+                   "total = 0\n"
+                   "For i = 0 To 3\n"
+                   "arr(i) = i * x\n"
+                   "Next\n"
+                   "For i = 0 To 3\n"
+                   "total = total + arr(i)\n"
+                   "Next\n"
+                   "prop = total\n"
+                   "Sum = prop\n"
+                   "End Function\n"
+                   "Public Property Get Obj\n"
+                   "Set Obj = Me\n"
+                   "End Property\n"
+                   "End Class\n"
+                   "Sub incArg(x)\n"
+                   "Dim i\n"
+                   "For i = 1 To 3\n"
+                   "x = x + 1\n"
+                   "Next\n"
+                   "End Sub\n"
+                   "Dim o, y, z\n"
+                   "Set o = New LocalsClass\n"
+                   "Call ok(o.Sum(2) = 12, \"o.Sum(2) = \" & o.Sum(2))\n"
+                   "Call ok(o.prop = 12, \"o.prop = \" & o.prop)\n"
+                   "Set z = o.Obj\n"
+                   "Call ok(z is o, \"z is not o\")\n"
+                   "y = 1\n"
+                   "incArg y\n"
+                   "Call ok(y = 4, \"y = \" & y)\n");
+
+    n = winetest_interactive ? 1000000 : 20000;
+
+    for(i = 0; i < sizeof(benchmarks)/sizeof(*benchmarks); i++) {
+        sprintf(buf, benchmarks[i].src, n);
+
+        start = GetTickCount();
+        parse_script_a(buf);
+        ticks = GetTickCount() - start;
+
+        trace("%s: %u iterations in %u ms (%u ops/sec)\n", benchmarks[i].name, n, ticks,
+              ticks ? (unsigned)((ULONGLONG)n * 1000 / ticks) : 0);
+    }
+}
+
 static void run_tests(void)
 {
     HRESULT hres;
@@ -2299,6 +2397,7 @@ static void run_tests(void)
     run_from_res("error.vbs");
 
     test_procedures();
+    test_local_identifiers();
     test_gc();
     test_msgbox();
 }
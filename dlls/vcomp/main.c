@@ -25,6 +25,8 @@
 #include "wine/port.h"
 
 #include <stdarg.h>
+#include <stdlib.h>
+#include <string.h>
 #include <assert.h>
 
 #include "windef.h"
@@ -44,6 +46,20 @@ static HMODULE vcomp_module;
 static int     vcomp_max_threads;
 static int     vcomp_num_threads;
 static BOOL    vcomp_nested_fork = FALSE;
+static unsigned int vcomp_spin_count;
+
+/* thread affinity, see OMP_PROC_BIND and OMP_PLACES */
+enum vcomp_proc_bind
+{
+    VCOMP_PROC_BIND_FALSE,
+    VCOMP_PROC_BIND_MASTER,
+    VCOMP_PROC_BIND_CLOSE,
+    VCOMP_PROC_BIND_SPREAD,
+};
+
+static enum vcomp_proc_bind vcomp_proc_bind;
+static ULONG_PTR    vcomp_places[8 * sizeof(ULONG_PTR)];
+static int          vcomp_num_places;
 
 static RTL_CRITICAL_SECTION vcomp_section;
 static RTL_CRITICAL_SECTION_DEBUG critsect_debug =
@@ -59,6 +75,9 @@ static RTL_CRITICAL_SECTION vcomp_section = { &critsect_debug, -1, 0, 0, 0, 0 };
 #define VCOMP_DYNAMIC_FLAGS_GUIDED      0x03
 #define VCOMP_DYNAMIC_FLAGS_INCREMENT   0x40
 
+/* number of polls before a waiting thread goes to sleep, see OMP_WAIT_POLICY */
+#define VCOMP_SPIN_COUNT_DEFAULT        20000
+
 struct vcomp_thread_data
 {
     struct vcomp_team_data  *team;
@@ -67,6 +86,10 @@ struct vcomp_thread_data
     BOOL                    parallel;
     int                     fork_threads;
 
+    /* affinity, index into vcomp_places or -1 */
+    int                     place;
+    int                     bind_place;
+
     /* only used for concurrent tasks */
     struct list             entry;
     CONDITION_VARIABLE      cond;
@@ -76,12 +99,18 @@ struct vcomp_thread_data
 
     /* section */
     unsigned int            section;
+    int                     num_sections;
 
     /* dynamic */
     unsigned int            dynamic;
     unsigned int            dynamic_type;
     unsigned int            dynamic_begin;
     unsigned int            dynamic_end;
+    unsigned int            dynamic_first;
+    unsigned int            dynamic_last;
+    unsigned int            dynamic_iterations;
+    int                     dynamic_step;
+    unsigned int            dynamic_chunksize;
 };
 
 struct vcomp_team_data
@@ -98,25 +127,21 @@ struct vcomp_team_data
     /* barrier */
     unsigned int            barrier;
     int                     barrier_count;
+    int                     barrier_waiters;
+    SRWLOCK                 barrier_lock;
+    CONDITION_VARIABLE      barrier_cond;
 };
 
 struct vcomp_task_data
 {
-    /* single */
-    unsigned int            single;
+    /* section, generation in the high and next section in the low 32 bits */
+    __int64                 section;
 
-    /* section */
-    unsigned int            section;
-    int                     num_sections;
-    int                     section_index;
+    /* dynamic, generation in the high and dispatched iterations in the low 32 bits */
+    __int64                 dynamic;
 
-    /* dynamic */
-    unsigned int            dynamic;
-    unsigned int            dynamic_first;
-    unsigned int            dynamic_last;
-    unsigned int            dynamic_iterations;
-    int                     dynamic_step;
-    unsigned int            dynamic_chunksize;
+    /* single */
+    unsigned int            single;
 };
 
 #if defined(__i386__)
@@ -334,6 +359,73 @@ static short interlocked_xchg_add16(short *dest, short incr)
 
 #endif  /* __GNUC__ */
 
+static inline void spin_pause(void)
+{
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+    __asm__ __volatile__( "rep;nop" : : : "memory" );
+#elif defined(__GNUC__)
+    __asm__ __volatile__( "" : : : "memory" );
+#endif
+}
+
+static inline __int64 interlocked_read64(__int64 *dest)
+{
+#ifdef _WIN64
+    return *(volatile __int64 *)dest;
+#else
+    return interlocked_cmpxchg64(dest, 0, 0);
+#endif
+}
+
+/* Resets the task counter for a new worksharing construct, unless another thread already did. */
+static void vcomp_task_claim(__int64 *task, unsigned int generation)
+{
+    __int64 old = interlocked_read64(task), prev;
+
+    while ((int)(generation - (unsigned int)(old >> 32)) > 0)
+    {
+        if ((prev = interlocked_cmpxchg64(task, (__int64)generation << 32, old)) == old)
+            break;
+        old = prev;
+    }
+}
+
+/* Returns the place of a team thread according to the binding policy. */
+static int vcomp_get_team_place(int master_place, int thread_num, int num_threads)
+{
+    if (master_place < 0)
+        master_place = 0;
+
+    switch (vcomp_proc_bind)
+    {
+        case VCOMP_PROC_BIND_MASTER:
+            return master_place;
+
+        case VCOMP_PROC_BIND_CLOSE:
+            if (num_threads <= vcomp_num_places)
+                return (master_place + thread_num) % vcomp_num_places;
+            /* fall through */
+
+        default:
+            /* spread, or consecutive threads share a place if there are more threads than places */
+            return (master_place + (DWORD64)thread_num * vcomp_num_places / num_threads) % vcomp_num_places;
+    }
+}
+
+static void vcomp_bind_thread(struct vcomp_thread_data *thread_data)
+{
+    if (thread_data->bind_place < 0 || thread_data->bind_place == thread_data->place)
+        return;
+
+    TRACE("binding thread %d to place %d (%lx)\n", thread_data->thread_num,
+          thread_data->bind_place, vcomp_places[thread_data->bind_place]);
+
+    if (!SetThreadAffinityMask(GetCurrentThread(), vcomp_places[thread_data->bind_place]))
+        WARN("failed to set affinity %lx, error %u\n", vcomp_places[thread_data->bind_place], GetLastError());
+
+    thread_data->place = thread_data->bind_place;
+}
+
 static inline struct vcomp_thread_data *vcomp_get_thread_data(void)
 {
     return (struct vcomp_thread_data *)TlsGetValue(vcomp_context_tls);
@@ -360,9 +452,9 @@ static struct vcomp_thread_data *vcomp_init_thread_data(void)
         ExitProcess(1);
     }
 
-    data->task.single           = 0;
     data->task.section          = 0;
     data->task.dynamic          = 0;
+    data->task.single           = 0;
 
     thread_data = &data->thread;
     thread_data->team           = NULL;
@@ -370,6 +462,8 @@ static struct vcomp_thread_data *vcomp_init_thread_data(void)
     thread_data->thread_num     = 0;
     thread_data->parallel       = FALSE;
     thread_data->fork_threads   = 0;
+    thread_data->place          = -1;
+    thread_data->bind_place     = -1;
     thread_data->single         = 1;
     thread_data->section        = 1;
     thread_data->dynamic        = 1;
@@ -1009,26 +1103,42 @@ void CDECL _vcomp_flush(void)
 void CDECL _vcomp_barrier(void)
 {
     struct vcomp_team_data *team_data = vcomp_init_thread_data()->team;
+    unsigned int barrier, count;
 
     TRACE("()\n");
 
     if (!team_data)
         return;
 
-    EnterCriticalSection(&vcomp_section);
-    if (++team_data->barrier_count >= team_data->num_threads)
+    barrier = *(volatile unsigned int *)&team_data->barrier;
+    if (interlocked_xchg_add(&team_data->barrier_count, 1) + 1 >= team_data->num_threads)
     {
-        team_data->barrier++;
         team_data->barrier_count = 0;
-        WakeAllConditionVariable(&team_data->cond);
+        interlocked_xchg_add((int *)&team_data->barrier, 1);
+        if (*(volatile int *)&team_data->barrier_waiters)
+        {
+            AcquireSRWLockExclusive(&team_data->barrier_lock);
+            WakeAllConditionVariable(&team_data->barrier_cond);
+            ReleaseSRWLockExclusive(&team_data->barrier_lock);
+        }
+        return;
     }
-    else
+
+    /* spinning only makes sense if every thread of the team can run at the same time */
+    count = team_data->num_threads <= vcomp_max_threads ? vcomp_spin_count : 0;
+    for (; count; count--)
     {
-        unsigned int barrier = team_data->barrier;
-        while (team_data->barrier == barrier)
-            SleepConditionVariableCS(&team_data->cond, &vcomp_section, INFINITE);
+        if (*(volatile unsigned int *)&team_data->barrier != barrier)
+            return;
+        spin_pause();
     }
-    LeaveCriticalSection(&vcomp_section);
+
+    AcquireSRWLockExclusive(&team_data->barrier_lock);
+    interlocked_xchg_add(&team_data->barrier_waiters, 1);
+    while (*(volatile unsigned int *)&team_data->barrier == barrier)
+        SleepConditionVariableSRW(&team_data->barrier_cond, &team_data->barrier_lock, INFINITE, 0);
+    interlocked_xchg_add(&team_data->barrier_waiters, -1);
+    ReleaseSRWLockExclusive(&team_data->barrier_lock);
 }
 
 void CDECL _vcomp_set_num_threads(int num_threads)
@@ -1054,20 +1164,21 @@ int CDECL _vcomp_single_begin(int flags)
 {
     struct vcomp_thread_data *thread_data = vcomp_init_thread_data();
     struct vcomp_task_data *task_data = thread_data->task;
-    int ret = FALSE;
+    unsigned int single, prev;
 
     TRACE("(%x): semi-stub\n", flags);
 
-    EnterCriticalSection(&vcomp_section);
     thread_data->single++;
-    if ((int)(thread_data->single - task_data->single) > 0)
+    single = *(volatile unsigned int *)&task_data->single;
+    while ((int)(thread_data->single - single) > 0)
     {
-        task_data->single = thread_data->single;
-        ret = TRUE;
+        prev = interlocked_cmpxchg((int *)&task_data->single, thread_data->single, single);
+        if (prev == single)
+            return TRUE;
+        single = prev;
     }
-    LeaveCriticalSection(&vcomp_section);
 
-    return ret;
+    return FALSE;
 }
 
 void CDECL _vcomp_single_end(void)
@@ -1083,33 +1194,28 @@ void CDECL _vcomp_sections_init(int n)
 
     TRACE("(%d)\n", n);
 
-    EnterCriticalSection(&vcomp_section);
     thread_data->section++;
-    if ((int)(thread_data->section - task_data->section) > 0)
-    {
-        task_data->section       = thread_data->section;
-        task_data->num_sections  = n;
-        task_data->section_index = 0;
-    }
-    LeaveCriticalSection(&vcomp_section);
+    thread_data->num_sections = n;
+    vcomp_task_claim(&task_data->section, thread_data->section);
 }
 
 int CDECL _vcomp_sections_next(void)
 {
     struct vcomp_thread_data *thread_data = vcomp_init_thread_data();
     struct vcomp_task_data *task_data = thread_data->task;
-    int i = -1;
+    __int64 section = interlocked_read64(&task_data->section), prev;
 
     TRACE("()\n");
 
-    EnterCriticalSection(&vcomp_section);
-    if (thread_data->section == task_data->section &&
-        task_data->section_index != task_data->num_sections)
+    while ((unsigned int)(section >> 32) == thread_data->section &&
+           (int)section != thread_data->num_sections)
     {
-        i = task_data->section_index++;
+        if ((prev = interlocked_cmpxchg64(&task_data->section, section + 1, section)) == section)
+            return (int)section;
+        section = prev;
     }
-    LeaveCriticalSection(&vcomp_section);
-    return i;
+
+    return -1;
 }
 
 void CDECL _vcomp_for_static_simple_init(unsigned int first, unsigned int last, int step,
@@ -1287,19 +1393,14 @@ void CDECL _vcomp_for_dynamic_init(unsigned int flags, unsigned int first, unsig
             type = VCOMP_DYNAMIC_FLAGS_GUIDED;
         }
 
-        EnterCriticalSection(&vcomp_section);
         thread_data->dynamic++;
-        thread_data->dynamic_type = type;
-        if ((int)(thread_data->dynamic - task_data->dynamic) > 0)
-        {
-            task_data->dynamic              = thread_data->dynamic;
-            task_data->dynamic_first        = first;
-            task_data->dynamic_last         = last;
-            task_data->dynamic_iterations   = iterations;
-            task_data->dynamic_step         = step;
-            task_data->dynamic_chunksize    = chunksize;
-        }
-        LeaveCriticalSection(&vcomp_section);
+        thread_data->dynamic_type       = type;
+        thread_data->dynamic_first      = first;
+        thread_data->dynamic_last       = last;
+        thread_data->dynamic_iterations = iterations;
+        thread_data->dynamic_step       = step;
+        thread_data->dynamic_chunksize  = chunksize;
+        vcomp_task_claim(&task_data->dynamic, thread_data->dynamic);
     }
 }
 
@@ -1322,26 +1423,35 @@ int CDECL _vcomp_for_dynamic_next(unsigned int *begin, unsigned int *end)
     else if (thread_data->dynamic_type == VCOMP_DYNAMIC_FLAGS_CHUNKED ||
              thread_data->dynamic_type == VCOMP_DYNAMIC_FLAGS_GUIDED)
     {
-        unsigned int iterations = 0;
-        EnterCriticalSection(&vcomp_section);
-        if (thread_data->dynamic == task_data->dynamic &&
-            task_data->dynamic_iterations != 0)
+        __int64 dynamic = interlocked_read64(&task_data->dynamic), prev;
+        unsigned int done, remaining, iterations;
+
+        for (;;)
         {
-            iterations = min(task_data->dynamic_iterations, task_data->dynamic_chunksize);
+            if ((unsigned int)(dynamic >> 32) != thread_data->dynamic)
+                return 0;
+
+            done = (unsigned int)dynamic;
+            remaining = thread_data->dynamic_iterations - done;
+            iterations = min(remaining, thread_data->dynamic_chunksize);
             if (thread_data->dynamic_type == VCOMP_DYNAMIC_FLAGS_GUIDED &&
-                task_data->dynamic_iterations > num_threads * task_data->dynamic_chunksize)
+                remaining > num_threads * thread_data->dynamic_chunksize)
             {
-                iterations = (task_data->dynamic_iterations + num_threads - 1) / num_threads;
+                iterations = (remaining + num_threads - 1) / num_threads;
             }
-            *begin = task_data->dynamic_first;
-            *end   = task_data->dynamic_first + (iterations - 1) * task_data->dynamic_step;
-            task_data->dynamic_iterations -= iterations;
-            task_data->dynamic_first      += iterations * task_data->dynamic_step;
-            if (!task_data->dynamic_iterations)
-                *end = task_data->dynamic_last;
+            if (!iterations)
+                return 0;
+
+            if ((prev = interlocked_cmpxchg64(&task_data->dynamic, dynamic + iterations, dynamic)) == dynamic)
+                break;
+            dynamic = prev;
         }
-        LeaveCriticalSection(&vcomp_section);
-        return iterations != 0;
+
+        *begin = thread_data->dynamic_first + done * thread_data->dynamic_step;
+        *end   = *begin + (iterations - 1) * thread_data->dynamic_step;
+        if (done + iterations == thread_data->dynamic_iterations)
+            *end = thread_data->dynamic_last;
+        return 1;
     }
 
     return 0;
@@ -1367,6 +1477,7 @@ static DWORD WINAPI _vcomp_fork_worker(void *param)
         if (team != NULL)
         {
             LeaveCriticalSection(&vcomp_section);
+            vcomp_bind_thread(thread_data);
             _vcomp_fork_call_wrapper(team->wrapper, team->nargs, team->valist);
             EnterCriticalSection(&vcomp_section);
 
@@ -1422,10 +1533,13 @@ void WINAPIV _vcomp_fork(BOOL ifval, int nargs, void *wrapper, ...)
     __ms_va_start(team_data.valist, wrapper);
     team_data.barrier           = 0;
     team_data.barrier_count     = 0;
+    team_data.barrier_waiters   = 0;
+    InitializeSRWLock(&team_data.barrier_lock);
+    InitializeConditionVariable(&team_data.barrier_cond);
 
-    task_data.single            = 0;
     task_data.section           = 0;
     task_data.dynamic           = 0;
+    task_data.single            = 0;
 
     thread_data.team            = &team_data;
     thread_data.task            = &task_data;
@@ -1436,9 +1550,18 @@ void WINAPIV _vcomp_fork(BOOL ifval, int nargs, void *wrapper, ...)
     thread_data.section         = 1;
     thread_data.dynamic         = 1;
     thread_data.dynamic_type    = 0;
+    thread_data.place           = -1;
+    thread_data.bind_place      = -1;
     list_init(&thread_data.entry);
     InitializeConditionVariable(&thread_data.cond);
 
+    if (num_threads > 1 && vcomp_proc_bind != VCOMP_PROC_BIND_FALSE)
+    {
+        prev_thread_data->bind_place = max(prev_thread_data->place, 0);
+        vcomp_bind_thread(prev_thread_data);
+        thread_data.place = thread_data.bind_place = prev_thread_data->place;
+    }
+
     if (num_threads > 1)
     {
         struct list *ptr;
@@ -1457,6 +1580,9 @@ void WINAPIV _vcomp_fork(BOOL ifval, int nargs, void *wrapper, ...)
             data->section       = 1;
             data->dynamic       = 1;
             data->dynamic_type  = 0;
+            data->bind_place    = -1;
+            if (thread_data.place >= 0)
+                data->bind_place = vcomp_get_team_place(thread_data.place, data->thread_num, num_threads);
             list_remove(&data->entry);
             list_add_tail(&thread_data.entry, &data->entry);
             WakeAllConditionVariable(&data->cond);
@@ -1481,6 +1607,10 @@ void WINAPIV _vcomp_fork(BOOL ifval, int nargs, void *wrapper, ...)
             data->section       = 1;
             data->dynamic       = 1;
             data->dynamic_type  = 0;
+            data->place         = -1;
+            data->bind_place    = -1;
+            if (thread_data.place >= 0)
+                data->bind_place = vcomp_get_team_place(thread_data.place, data->thread_num, num_threads);
             InitializeConditionVariable(&data->cond);
 
             thread = CreateThread(NULL, 0, _vcomp_fork_worker, data, 0, NULL);
@@ -1621,6 +1751,185 @@ void CDECL _vcomp_leave_critsect(CRITICAL_SECTION *critsect)
     LeaveCriticalSection(critsect);
 }
 
+static void vcomp_init_wait_policy(void)
+{
+    static const WCHAR wait_policyW[] = {'O','M','P','_','W','A','I','T','_','P','O','L','I','C','Y',0};
+    static const WCHAR activeW[] = {'A','C','T','I','V','E',0};
+    static const WCHAR passiveW[] = {'P','A','S','S','I','V','E',0};
+    WCHAR buf[16];
+    DWORD len;
+
+    vcomp_spin_count = VCOMP_SPIN_COUNT_DEFAULT;
+
+    len = GetEnvironmentVariableW(wait_policyW, buf, sizeof(buf)/sizeof(buf[0]));
+    if (!len || len >= sizeof(buf)/sizeof(buf[0]))
+        return;
+
+    if (!lstrcmpiW(buf, activeW))
+        vcomp_spin_count = ~0u;
+    else if (!lstrcmpiW(buf, passiveW))
+        vcomp_spin_count = 0;
+    else
+        WARN("ignoring unknown wait policy %s\n", debugstr_w(buf));
+
+    TRACE("using spin count %u\n", vcomp_spin_count);
+}
+
+static int vcomp_init_abstract_places(LOGICAL_PROCESSOR_RELATIONSHIP relation, ULONG_PTR process_mask, int count)
+{
+    SYSTEM_LOGICAL_PROCESSOR_INFORMATION *info;
+    DWORD len = 0, i;
+    int num_places = 0;
+
+    if (relation == RelationAll)
+    {
+        /* one place per logical processor */
+        for (i = 0; i < 8 * sizeof(ULONG_PTR) && num_places < count; i++)
+            if (process_mask & ((ULONG_PTR)1 << i)) vcomp_places[num_places++] = (ULONG_PTR)1 << i;
+        return num_places;
+    }
+
+    if (GetLogicalProcessorInformation(NULL, &len) || GetLastError() != ERROR_INSUFFICIENT_BUFFER)
+        return 0;
+    if (!(info = HeapAlloc(GetProcessHeap(), 0, len)))
+        return 0;
+
+    if (GetLogicalProcessorInformation(info, &len))
+    {
+        for (i = 0; i < len / sizeof(*info) && num_places < count; i++)
+        {
+            if (info[i].Relationship != relation || !(info[i].ProcessorMask & process_mask)) continue;
+            vcomp_places[num_places++] = info[i].ProcessorMask & process_mask;
+        }
+    }
+
+    HeapFree(GetProcessHeap(), 0, info);
+    return num_places;
+}
+
+/* Parses an explicit place list like "{0,1},{2:2},{4:4:2}". */
+static int vcomp_parse_place_list(const char *str, ULONG_PTR process_mask)
+{
+    const int max_places = sizeof(vcomp_places)/sizeof(vcomp_places[0]);
+    int num_places = 0;
+    char *end;
+
+    while (*str == '{' && num_places < max_places)
+    {
+        ULONG_PTR mask = 0;
+
+        str++;
+        for (;;)
+        {
+            unsigned long first, len = 1, stride = 1;
+
+            first = strtoul(str, &end, 10);
+            if (end == str) return 0;
+            str = end;
+            if (*str == ':')
+            {
+                len = strtoul(str + 1, &end, 10);
+                str = end;
+                if (*str == ':')
+                {
+                    stride = strtoul(str + 1, &end, 10);
+                    str = end;
+                }
+            }
+            for (; len; len--, first += stride)
+                if (first < 8 * sizeof(ULONG_PTR)) mask |= (ULONG_PTR)1 << first;
+
+            if (*str != ',') break;
+            str++;
+        }
+        if (*str++ != '}') return 0;
+
+        if (mask & process_mask)
+            vcomp_places[num_places++] = mask & process_mask;
+
+        if (*str != ',') break;
+        str++;
+    }
+
+    return *str ? 0 : num_places;
+}
+
+static void vcomp_init_affinity(void)
+{
+    static const struct
+    {
+        const char *name;
+        LOGICAL_PROCESSOR_RELATIONSHIP relation;
+    }
+    abstract_places[] =
+    {
+        { "threads",      RelationAll },
+        { "cores",        RelationProcessorCore },
+        { "sockets",      RelationProcessorPackage },
+        { "numa_domains", RelationNumaNode },
+    };
+    ULONG_PTR process_mask, system_mask;
+    char bind[16], places[256];
+    DWORD bind_len, places_len;
+    int i, count;
+
+    bind_len = GetEnvironmentVariableA("OMP_PROC_BIND", bind, sizeof(bind));
+    places_len = GetEnvironmentVariableA("OMP_PLACES", places, sizeof(places));
+    if (bind_len >= sizeof(bind)) bind_len = 0;
+    if (places_len >= sizeof(places)) places_len = 0;
+
+    if (bind_len)
+    {
+        if (!strcasecmp(bind, "false"))
+            return;
+        else if (!strcasecmp(bind, "master"))
+            vcomp_proc_bind = VCOMP_PROC_BIND_MASTER;
+        else if (!strcasecmp(bind, "close"))
+            vcomp_proc_bind = VCOMP_PROC_BIND_CLOSE;
+        else if (!strcasecmp(bind, "spread") || !strcasecmp(bind, "true"))
+            vcomp_proc_bind = VCOMP_PROC_BIND_SPREAD;
+        else
+        {
+            WARN("ignoring unsupported binding policy %s\n", debugstr_a(bind));
+            return;
+        }
+    }
+    else if (places_len)
+        vcomp_proc_bind = VCOMP_PROC_BIND_SPREAD;
+    else
+        return;
+
+    if (!GetProcessAffinityMask(GetCurrentProcess(), &process_mask, &system_mask))
+        process_mask = ~(ULONG_PTR)0;
+
+    if (!places_len)
+        strcpy(places, "cores");
+
+    for (i = 0; i < sizeof(abstract_places)/sizeof(abstract_places[0]); i++)
+    {
+        size_t len = strlen(abstract_places[i].name);
+        if (strncasecmp(places, abstract_places[i].name, len)) continue;
+
+        count = sizeof(vcomp_places)/sizeof(vcomp_places[0]);
+        if (places[len] == '(')
+            count = min(count, atoi(places + len + 1));
+        vcomp_num_places = vcomp_init_abstract_places(abstract_places[i].relation, process_mask, count);
+        break;
+    }
+
+    if (i == sizeof(abstract_places)/sizeof(abstract_places[0]))
+        vcomp_num_places = vcomp_parse_place_list(places, process_mask);
+
+    if (!vcomp_num_places)
+    {
+        WARN("no usable places in %s, threads will not be bound\n", debugstr_a(places));
+        vcomp_proc_bind = VCOMP_PROC_BIND_FALSE;
+        return;
+    }
+
+    TRACE("binding policy %u, %d places\n", vcomp_proc_bind, vcomp_num_places);
+}
+
 BOOL WINAPI DllMain(HINSTANCE instance, DWORD reason, LPVOID reserved)
 {
     TRACE("(%p, %d, %p)\n", instance, reason, reserved);
@@ -1641,6 +1950,8 @@ BOOL WINAPI DllMain(HINSTANCE instance, DWORD reason, LPVOID reserved)
             vcomp_module      = instance;
             vcomp_max_threads = sysinfo.dwNumberOfProcessors;
             vcomp_num_threads = sysinfo.dwNumberOfProcessors;
+            vcomp_init_wait_policy();
+            vcomp_init_affinity();
             break;
         }
 
@@ -1367,6 +1367,37 @@ static void test_vcomp_single_begin(void)
     pomp_set_num_threads(max_threads);
 }
 
+static void CDECL barrier_cb(int rounds, LONG *count)
+{
+    int num_threads = pomp_get_num_threads();
+    int i;
+
+    for (i = 0; i < rounds; i++)
+    {
+        InterlockedIncrement(count);
+        p_vcomp_barrier();
+        ok(*count == num_threads * (i + 1), "expected count == %d, got %d\n", num_threads * (i + 1), *count);
+        p_vcomp_barrier();
+    }
+}
+
+static void test_vcomp_barrier(void)
+{
+    int max_threads = pomp_get_max_threads();
+    LONG count;
+    int i;
+
+    for (i = 1; i <= 8; i++)
+    {
+        pomp_set_num_threads(i);
+        count = 0;
+        p_vcomp_fork(TRUE, 2, barrier_cb, 100, &count);
+        ok(count == 100 * i, "expected count == %d, got %d\n", 100 * i, count);
+    }
+
+    pomp_set_num_threads(max_threads);
+}
+
 static void CDECL critsect_cb(LONG *a)
 {
     static CRITICAL_SECTION *critsect;
@@ -2172,6 +2203,120 @@ static void test_reduction_float_double(void)
     }
 }
 
+static void CDECL bench_parallel_cb(void)
+{
+}
+
+static void CDECL bench_barrier_cb(int reps)
+{
+    int i;
+
+    for (i = 0; i < reps; i++)
+        p_vcomp_barrier();
+}
+
+static void CDECL bench_single_cb(int reps, LONG *count)
+{
+    int i;
+
+    for (i = 0; i < reps; i++)
+    {
+        if (p_vcomp_single_begin(0))
+            InterlockedIncrement(count);
+        p_vcomp_single_end();
+        p_vcomp_barrier();
+    }
+}
+
+static void CDECL bench_critsect_cb(int reps, LONG *count)
+{
+    static CRITICAL_SECTION *critsect;
+    int i;
+
+    for (i = 0; i < reps; i++)
+    {
+        p_vcomp_enter_critsect(&critsect);
+        (*count)++;
+        p_vcomp_leave_critsect(critsect);
+    }
+}
+
+static void CDECL bench_schedule_cb(unsigned int flags, unsigned int iterations, unsigned int chunksize, LONG *count)
+{
+    unsigned int begin, end;
+    LONG done = 0;
+
+    p_vcomp_for_dynamic_init(flags | VCOMP_DYNAMIC_FLAGS_INCREMENT, 0, iterations - 1, 1, chunksize);
+    while (p_vcomp_for_dynamic_next(&begin, &end))
+        done += end - begin + 1;
+
+    InterlockedExchangeAdd(count, done);
+    p_vcomp_barrier();
+}
+
+/* overheads of synchronization and loop scheduling constructs, in the spirit of the EPCC benchmarks */
+static void test_benchmarks(void)
+{
+    static const unsigned int chunksizes[] = {1, 4, 16, 64, 256};
+    static const int team_sizes[] = {1, 2, 4, 8, 16};
+    int max_threads = pomp_get_max_threads();
+    const int reps = 100000, iterations = 1000000;
+    DWORD start, time;
+    unsigned int i, j;
+    LONG count;
+
+    for (i = 0; i < sizeof(team_sizes)/sizeof(team_sizes[0]); i++)
+    {
+        int num_threads = team_sizes[i];
+
+        pomp_set_num_threads(num_threads);
+
+        start = GetTickCount();
+        for (j = 0; j < reps / 100; j++)
+            p_vcomp_fork(TRUE, 0, bench_parallel_cb);
+        time = GetTickCount() - start;
+        trace("%d threads: parallel: %u ms for %u reps\n", num_threads, time, reps / 100);
+
+        start = GetTickCount();
+        p_vcomp_fork(TRUE, 1, bench_barrier_cb, reps);
+        time = GetTickCount() - start;
+        trace("%d threads: barrier: %u ms for %u reps\n", num_threads, time, reps);
+
+        count = 0;
+        start = GetTickCount();
+        p_vcomp_fork(TRUE, 2, bench_single_cb, reps, &count);
+        time = GetTickCount() - start;
+        ok(count == reps, "expected count == %d, got %d\n", reps, count);
+        trace("%d threads: single: %u ms for %u reps\n", num_threads, time, reps);
+
+        count = 0;
+        start = GetTickCount();
+        p_vcomp_fork(TRUE, 2, bench_critsect_cb, reps / 10, &count);
+        time = GetTickCount() - start;
+        ok(count == num_threads * (reps / 10), "expected count == %d, got %d\n", num_threads * (reps / 10), count);
+        trace("%d threads: critical: %u ms for %u reps\n", num_threads, time, reps / 10);
+
+        for (j = 0; j < sizeof(chunksizes)/sizeof(chunksizes[0]); j++)
+        {
+            count = 0;
+            start = GetTickCount();
+            p_vcomp_fork(TRUE, 4, bench_schedule_cb, VCOMP_DYNAMIC_FLAGS_CHUNKED, iterations, chunksizes[j], &count);
+            time = GetTickCount() - start;
+            ok(count == iterations, "expected count == %d, got %d\n", iterations, count);
+            trace("%d threads: dynamic,%u: %u ms for %u iterations\n", num_threads, chunksizes[j], time, iterations);
+
+            count = 0;
+            start = GetTickCount();
+            p_vcomp_fork(TRUE, 4, bench_schedule_cb, VCOMP_DYNAMIC_FLAGS_GUIDED, iterations, chunksizes[j], &count);
+            time = GetTickCount() - start;
+            ok(count == iterations, "expected count == %d, got %d\n", iterations, count);
+            trace("%d threads: guided,%u: %u ms for %u iterations\n", num_threads, chunksizes[j], time, iterations);
+        }
+    }
+
+    pomp_set_num_threads(max_threads);
+}
+
 START_TEST(vcomp)
 {
     if (!init_vcomp())
@@ -2186,6 +2331,7 @@ START_TEST(vcomp)
     test_vcomp_for_dynamic_init();
     test_vcomp_master_begin();
     test_vcomp_single_begin();
+    test_vcomp_barrier();
     test_vcomp_enter_critsect();
     test_vcomp_flush();
     test_omp_init_lock();
@@ -2201,6 +2347,8 @@ START_TEST(vcomp)
     test_reduction_integer32();
     test_reduction_integer64();
     test_reduction_float_double();
+    if (winetest_interactive)
+        test_benchmarks();
 
     release_vcomp();
 }
@@ -128,6 +128,11 @@
 #ifdef HAVE_SYS_POLL_H
 # include <sys/poll.h>
 #endif
+#if defined(HAVE_SYS_EPOLL_H) && defined(HAVE_EPOLL_CREATE)
+# include <sys/epoll.h>
+# include <sys/stat.h>
+# define USE_EPOLL
+#endif
 #ifdef HAVE_SYS_TIME_H
 # include <sys/time.h>
 #endif
@@ -590,6 +595,7 @@ struct per_thread_data
     int se_len;
     int pe_len;
     char ntoa_buffer[16]; /* 4*3 digits + 3 '.' + 1 '\0' */
+    struct poll_set *poll_set;
 };
 
 /* internal: routing description information */
@@ -608,6 +614,7 @@ static struct WS_hostent *WS_dup_he(const struct hostent* p_he);
 static struct WS_protoent *WS_dup_pe(const struct protoent* p_pe);
 static struct WS_servent *WS_dup_se(const struct servent* p_se);
 static int ws_protocol_info(SOCKET s, int unicode, WSAPROTOCOL_INFOW *buffer, int *size);
+static int is_fd_bound(int fd, union generic_unix_sockaddr *uaddr, socklen_t *uaddrlen);
 
 int WSAIOCTL_GetInterfaceCount(void);
 int WSAIOCTL_GetInterfaceName(int intNumber, char *intName);
@@ -1148,6 +1155,247 @@ static int _get_fd_type(int fd)
     return sock_type;
 }
 
+#ifdef USE_EPOLL
+
+/* Large select() and WSAPoll() calls are served from a per-thread epoll set
+ * that persists across calls, so that polling the same sockets over and over
+ * only costs the changes and the ready sockets.  The unix fds registered in
+ * the epoll sets are kept in a process-wide cache for as long as a set uses
+ * them, together with the socket state that select() needs.  A cached entry is
+ * trusted until closesocket() removes it; a handle closed with CloseHandle()
+ * is noticed when it gets reused for a new socket. */
+
+#define POLL_SET_MIN_COUNT  64
+#define SOCK_FD_CACHE_SIZE  4096
+#define POLL_SET_HASH_SIZE  4096
+
+struct sock_fd_entry
+{
+    struct sock_fd_entry *next;
+    SOCKET                sock;
+    int                   fd;     /* private dup of the socket fd, -1 once closed */
+    unsigned int          id;     /* unique id of this cache entry */
+    unsigned int          refs;   /* poll sets using the entry, plus the call that created it */
+    BOOL                  linked; /* whether the entry is still in the cache */
+    int                   type;
+    BOOL                  bound;  /* once bound a socket stays bound */
+    BOOL                  oobinline;
+};
+
+struct poll_set_entry
+{
+    SOCKET       sock;        /* INVALID_SOCKET if the entry is free */
+    int          next;        /* next entry in the hash chain or free list */
+    struct sock_fd_entry *reg;    /* cache entry registered in the epoll set, holds a reference */
+    unsigned int events;      /* events registered in the epoll set */
+    unsigned int serial;      /* serial of the last call using the entry */
+    struct sock_fd_entry *cache;  /* cache entry used by the current call */
+    unsigned int wanted;      /* events wanted by the current call */
+    int          first;       /* first pollfd of the current call for this socket */
+};
+
+struct poll_set
+{
+    int                    epoll_fd;
+    unsigned int           serial;
+    struct poll_set_entry *entries;
+    int                    entries_size;
+    int                    free_entry;
+    int                    hash[POLL_SET_HASH_SIZE];
+    struct pollfd         *fds;     /* pollfd array of the current call */
+    int                   *fds_next; /* next pollfd using the same socket */
+    struct sock_fd_entry **created;  /* cache entries created by the current call */
+    int                    created_count;
+    int                    fds_size;
+    struct epoll_event    *events;
+};
+
+static struct sock_fd_entry *sock_fd_cache[SOCK_FD_CACHE_SIZE];
+static unsigned int sock_fd_cache_id;
+static volatile LONG sock_fd_cache_unbound;  /* number of cached entries not bound yet */
+
+static CRITICAL_SECTION sock_fd_cache_section;
+static CRITICAL_SECTION_DEBUG sock_fd_cache_section_debug =
+{
+    0, 0, &sock_fd_cache_section,
+    { &sock_fd_cache_section_debug.ProcessLocksList, &sock_fd_cache_section_debug.ProcessLocksList },
+      0, 0, { (DWORD_PTR)(__FILE__ ": sock_fd_cache_section") }
+};
+static CRITICAL_SECTION sock_fd_cache_section = { &sock_fd_cache_section_debug, -1, 0, 0, 0, 0 };
+
+static inline unsigned int sock_hash( SOCKET s, unsigned int size )
+{
+    return (s >> 2) % size;
+}
+
+/* find a socket in the fd cache; must be called with the cache section held */
+static struct sock_fd_entry *sock_fd_cache_find( SOCKET s )
+{
+    struct sock_fd_entry *entry;
+
+    for (entry = sock_fd_cache[sock_hash( s, SOCK_FD_CACHE_SIZE )]; entry; entry = entry->next)
+        if (entry->sock == s) return entry;
+    return NULL;
+}
+
+static void sock_fd_entry_free( struct sock_fd_entry *entry )
+{
+    if (entry->linked && !entry->bound) InterlockedDecrement( &sock_fd_cache_unbound );
+    if (entry->fd != -1) release_sock_fd( entry->sock, entry->fd );
+    HeapFree( GetProcessHeap(), 0, entry );
+}
+
+/* remove an entry from the cache; it is freed once no poll set uses it anymore */
+static void sock_fd_cache_unlink( struct sock_fd_entry *entry )
+{
+    struct sock_fd_entry **next;
+
+    if (entry->linked)
+    {
+        next = &sock_fd_cache[sock_hash( entry->sock, SOCK_FD_CACHE_SIZE )];
+        while (*next != entry) next = &(*next)->next;
+        *next = entry->next;
+        entry->linked = FALSE;
+        if (!entry->bound) InterlockedDecrement( &sock_fd_cache_unbound );
+    }
+    if (!entry->refs) sock_fd_entry_free( entry );
+}
+
+static void sock_fd_cache_release( struct sock_fd_entry *entry )
+{
+    if (!--entry->refs) sock_fd_cache_unlink( entry );
+}
+
+/* find a socket in the fd cache, adding it if needed; must be called with the cache section held */
+static struct sock_fd_entry *sock_fd_cache_get( struct poll_set *set, SOCKET s )
+{
+    struct sock_fd_entry *entry;
+    unsigned int hash;
+    socklen_t len;
+    int fd;
+
+    if ((entry = sock_fd_cache_find( s ))) return entry;
+
+    if ((fd = get_sock_fd( s, 0, NULL )) == -1) return NULL;
+    if (!(entry = HeapAlloc( GetProcessHeap(), 0, sizeof(*entry) )))
+    {
+        release_sock_fd( s, fd );
+        SetLastError( ERROR_NOT_ENOUGH_MEMORY );
+        return NULL;
+    }
+    entry->sock   = s;
+    entry->fd     = fd;
+    entry->refs   = 1;  /* released at the end of the call */
+    entry->linked = TRUE;
+    entry->type   = _get_fd_type( fd );
+    /* count the entry before checking, so that a concurrent implicit bind can't be missed */
+    entry->bound  = FALSE;
+    InterlockedIncrement( &sock_fd_cache_unbound );
+    if (is_fd_bound( fd, NULL, NULL ) == 1)
+    {
+        entry->bound = TRUE;
+        InterlockedDecrement( &sock_fd_cache_unbound );
+    }
+    len = sizeof(entry->oobinline);
+    entry->oobinline = 0;
+    getsockopt( fd, SOL_SOCKET, SO_OOBINLINE, (char *)&entry->oobinline, &len );
+    if (!++sock_fd_cache_id) ++sock_fd_cache_id;
+    entry->id     = sock_fd_cache_id;
+
+    hash = sock_hash( s, SOCK_FD_CACHE_SIZE );
+    entry->next = sock_fd_cache[hash];
+    sock_fd_cache[hash] = entry;
+    set->created[set->created_count++] = entry;
+    return entry;
+}
+
+/* remove a socket from the fd cache, closing its fd */
+static void sock_fd_cache_remove( SOCKET s )
+{
+    struct sock_fd_entry *entry;
+
+    EnterCriticalSection( &sock_fd_cache_section );
+    if ((entry = sock_fd_cache_find( s )))
+    {
+        release_sock_fd( s, entry->fd );
+        entry->fd = -1;
+        sock_fd_cache_unlink( entry );
+    }
+    LeaveCriticalSection( &sock_fd_cache_section );
+}
+
+/* record that a socket got bound, explicitly or as a side effect of connect() or sendto() */
+static void sock_fd_cache_set_bound( SOCKET s )
+{
+    struct sock_fd_entry *entry;
+
+    if (!sock_fd_cache_unbound) return;
+
+    EnterCriticalSection( &sock_fd_cache_section );
+    if ((entry = sock_fd_cache_find( s )) && !entry->bound)
+    {
+        entry->bound = TRUE;
+        InterlockedDecrement( &sock_fd_cache_unbound );
+    }
+    LeaveCriticalSection( &sock_fd_cache_section );
+}
+
+static void sock_fd_cache_set_oobinline( SOCKET s, BOOL oobinline )
+{
+    struct sock_fd_entry *entry;
+
+    EnterCriticalSection( &sock_fd_cache_section );
+    if ((entry = sock_fd_cache_find( s ))) entry->oobinline = oobinline;
+    LeaveCriticalSection( &sock_fd_cache_section );
+}
+
+static void sock_fd_cache_flush(void)
+{
+    struct sock_fd_entry *entry, *next;
+    unsigned int i;
+
+    EnterCriticalSection( &sock_fd_cache_section );
+    for (i = 0; i < SOCK_FD_CACHE_SIZE; i++)
+    {
+        for (entry = sock_fd_cache[i]; entry; entry = next)
+        {
+            next = entry->next;
+            sock_fd_entry_free( entry );
+        }
+        sock_fd_cache[i] = NULL;
+    }
+    LeaveCriticalSection( &sock_fd_cache_section );
+}
+
+static void poll_set_free( struct poll_set *set )
+{
+    int i;
+
+    if (!set) return;
+    EnterCriticalSection( &sock_fd_cache_section );
+    for (i = 0; i < set->entries_size; i++)
+        if (set->entries[i].sock != INVALID_SOCKET && set->entries[i].reg)
+            sock_fd_cache_release( set->entries[i].reg );
+    LeaveCriticalSection( &sock_fd_cache_section );
+    close( set->epoll_fd );
+    HeapFree( GetProcessHeap(), 0, set->entries );
+    HeapFree( GetProcessHeap(), 0, set->fds );
+    HeapFree( GetProcessHeap(), 0, set->fds_next );
+    HeapFree( GetProcessHeap(), 0, set->created );
+    HeapFree( GetProcessHeap(), 0, set->events );
+    HeapFree( GetProcessHeap(), 0, set );
+}
+
+#else  /* USE_EPOLL */
+
+static inline void sock_fd_cache_remove( SOCKET s ) { }
+static inline void sock_fd_cache_set_bound( SOCKET s ) { }
+static inline void sock_fd_cache_set_oobinline( SOCKET s, BOOL oobinline ) { }
+static inline void sock_fd_cache_flush(void) { }
+static inline void poll_set_free( struct poll_set *set ) { }
+
+#endif  /* USE_EPOLL */
+
 static struct per_thread_data *get_per_thread_data(void)
 {
     struct per_thread_data * ptb = NtCurrentTeb()->WinSockData;
@@ -1174,6 +1422,9 @@ static void free_per_thread_data(void)
     ptb->se_buffer = NULL;
     ptb->pe_buffer = NULL;
 
+    poll_set_free( ptb->poll_set );
+    ptb->poll_set = NULL;
+
     HeapFree( GetProcessHeap(), 0, ptb );
     NtCurrentTeb()->WinSockData = NULL;
 }
@@ -1190,6 +1441,7 @@ BOOL WINAPI DllMain(HINSTANCE hInstDLL, DWORD fdwReason, LPVOID fImpLoad)
     case DLL_PROCESS_DETACH:
         if (fImpLoad) break;
         free_per_thread_data();
+        sock_fd_cache_flush();
         DeleteCriticalSection(&csWSgetXXXbyYYY);
         break;
     case DLL_THREAD_DETACH:
@@ -2340,59 +2592,75 @@ static NTSTATUS WS2_async_accept_recv( void *user, IO_STATUS_BLOCK *iosb,
 }
 
 /***********************************************************************
- *              WS2_async_accept                (INTERNAL)
+ *              WS2_accept_into_socket          (INTERNAL)
  *
- * This is the function called to satisfy the AcceptEx callback
+ * Accept a connection into the accepting socket of an AcceptEx request,
+ * and store the local and remote addresses after the data buffer.
  */
-static NTSTATUS WS2_async_accept( void *user, IO_STATUS_BLOCK *iosb,
-                                  NTSTATUS status, void **apc, void **arg )
+static NTSTATUS WS2_accept_into_socket( struct ws2_accept_async *wsa, BOOL nowait )
 {
-    struct ws2_accept_async *wsa = user;
-    int len;
+    char addrs[2 * sizeof(union generic_unix_sockaddr)];
+    union generic_unix_sockaddr uaddr;
+    data_size_t local_len = 0, size = 0;
+    NTSTATUS status;
     char *addr;
+    int len;
 
-    TRACE("status: 0x%x listen: %p, accept: %p\n", status, wsa->listen_socket, wsa->accept_socket);
-
-    if (status == STATUS_ALERTED)
+    SERVER_START_REQ( accept_into_socket )
     {
-        SERVER_START_REQ( accept_into_socket )
+        req->lhandle = wine_server_obj_handle( wsa->listen_socket );
+        req->ahandle = wine_server_obj_handle( wsa->accept_socket );
+        req->nowait  = nowait;
+        wine_server_set_reply( req, addrs, sizeof(addrs) );
+        if (!(status = wine_server_call( req )))
         {
-            req->lhandle = wine_server_obj_handle( wsa->listen_socket );
-            req->ahandle = wine_server_obj_handle( wsa->accept_socket );
-            status = wine_server_call( req );
-        }
-        SERVER_END_REQ;
-
-        if (status == STATUS_CANT_WAIT)
-            return STATUS_PENDING;
-
-        if (status == STATUS_INVALID_HANDLE)
-        {
-            FIXME("AcceptEx accepting socket closed but request was not cancelled\n");
-            status = STATUS_CANCELLED;
+            local_len = reply->local_len;
+            size = wine_server_reply_size( reply );
         }
     }
-    else if (status == STATUS_HANDLES_CLOSED)
-        status = STATUS_CANCELLED;  /* strange windows behavior */
+    SERVER_END_REQ;
 
-    if (status != STATUS_SUCCESS)
-        goto finish;
+    if (status != STATUS_SUCCESS) return status;
+
+    /* the accepting socket now uses a different unix fd */
+    sock_fd_cache_remove( HANDLE2SOCKET(wsa->accept_socket) );
 
     /* WS2 Spec says size param is extra 16 bytes long...what do we put in it? */
     addr = ((char *)wsa->buf) + wsa->data_len;
     len = wsa->local_len - sizeof(int);
-    WS_getsockname(HANDLE2SOCKET(wsa->accept_socket),
-                   (struct WS_sockaddr *)(addr + sizeof(int)), &len);
+    if (local_len && local_len < size)
+    {
+        memcpy( &uaddr, addrs, local_len );
+        ws_sockaddr_u2ws( &uaddr.addr, (struct WS_sockaddr *)(addr + sizeof(int)), &len );
+    }
+    else
+        WS_getsockname( HANDLE2SOCKET(wsa->accept_socket),
+                        (struct WS_sockaddr *)(addr + sizeof(int)), &len );
     *(int *)addr = len;
 
     addr += wsa->local_len;
     len = wsa->remote_len - sizeof(int);
-    WS_getpeername(HANDLE2SOCKET(wsa->accept_socket),
-                   (struct WS_sockaddr *)(addr + sizeof(int)), &len);
+    if (local_len && local_len < size)
+    {
+        memcpy( &uaddr, addrs + local_len, size - local_len );
+        ws_sockaddr_u2ws( &uaddr.addr, (struct WS_sockaddr *)(addr + sizeof(int)), &len );
+    }
+    else
+        WS_getpeername( HANDLE2SOCKET(wsa->accept_socket),
+                        (struct WS_sockaddr *)(addr + sizeof(int)), &len );
     *(int *)addr = len;
 
-    if (!wsa->read)
-        goto finish;
+    return STATUS_SUCCESS;
+}
+
+/***********************************************************************
+ *              WS2_register_accept_recv        (INTERNAL)
+ *
+ * Queue the read of the first block of data of an AcceptEx request.
+ */
+static NTSTATUS WS2_register_accept_recv( struct ws2_accept_async *wsa, IO_STATUS_BLOCK *iosb )
+{
+    NTSTATUS status;
 
     SERVER_START_REQ( register_async )
     {
@@ -2405,8 +2673,44 @@ static NTSTATUS WS2_async_accept( void *user, IO_STATUS_BLOCK *iosb,
         status = wine_server_call( req );
     }
     SERVER_END_REQ;
+    return status;
+}
 
-    if (status != STATUS_PENDING)
+/***********************************************************************
+ *              WS2_async_accept                (INTERNAL)
+ *
+ * This is the function called to satisfy the AcceptEx callback
+ */
+static NTSTATUS WS2_async_accept( void *user, IO_STATUS_BLOCK *iosb,
+                                  NTSTATUS status, void **apc, void **arg )
+{
+    struct ws2_accept_async *wsa = user;
+
+    TRACE("status: 0x%x listen: %p, accept: %p\n", status, wsa->listen_socket, wsa->accept_socket);
+
+    if (status == STATUS_ALERTED)
+    {
+        status = WS2_accept_into_socket( wsa, FALSE );
+
+        if (status == STATUS_CANT_WAIT)
+            return STATUS_PENDING;
+
+        if (status == STATUS_INVALID_HANDLE)
+        {
+            FIXME("AcceptEx accepting socket closed but request was not cancelled\n");
+            status = STATUS_CANCELLED;
+        }
+    }
+    else if (status == STATUS_HANDLES_CLOSED)
+        status = STATUS_CANCELLED;  /* strange windows behavior */
+
+    if (status != STATUS_SUCCESS)
+        goto finish;
+
+    if (!wsa->read)
+        goto finish;
+
+    if ((status = WS2_register_accept_recv( wsa, iosb )) != STATUS_PENDING)
         goto finish;
 
     /* The APC has finished but no completion should be sent for the operation yet, additional processing
@@ -2653,6 +2957,8 @@ SOCKET WINAPI WS_accept(SOCKET s, struct WS_sockaddr *addr, int *addrlen32)
         SERVER_END_REQ;
         if (!status)
         {
+            /* the handle may have been closed with CloseHandle() while cached */
+            sock_fd_cache_remove(as);
             if (addr && addrlen32 && WS_getpeername(as, addr, addrlen32))
             {
                 WS_closesocket(as);
@@ -2764,6 +3070,42 @@ static BOOL WINAPI WS2_AcceptEx(SOCKET listener, SOCKET acceptor, PVOID dest, DW
         wsa->read->iovec[0].iov_len  = wsa->data_len;
     }
 
+    /* If a connection is already pending, accept it right away instead of
+     * waiting for the async to be woken up. The request is still reported as
+     * pending, but it is completed by the time we return. */
+    status = WS2_accept_into_socket( wsa, TRUE );
+    if (status == STATUS_SUCCESS)
+    {
+        NTSTATUS result = STATUS_SUCCESS;
+
+        if (wsa->read)
+        {
+            result = WS2_register_accept_recv( wsa, (IO_STATUS_BLOCK *)overlapped );
+            if (result == STATUS_PENDING)
+            {
+                SetLastError( NtStatusToWSAError(result) );
+                return FALSE;
+            }
+            /* the connection is accepted anyway, so the failure to queue
+             * the read is reported through the overlapped result */
+            WARN( "failed to queue the read of the accepted connection: %08x\n", result );
+        }
+        overlapped->Internal     = result;
+        overlapped->InternalHigh = 0;
+        if (wsa->cvalue)
+            WS_AddCompletion( listener, wsa->cvalue, result, 0 );
+        if (overlapped->hEvent)
+            NtSetEvent( (HANDLE)((ULONG_PTR)overlapped->hEvent & ~1), NULL );
+        status = STATUS_PENDING;
+    }
+    if (status != STATUS_CANT_WAIT)
+    {
+        HeapFree( GetProcessHeap(), 0, wsa->read );
+        HeapFree( GetProcessHeap(), 0, wsa );
+        SetLastError( NtStatusToWSAError(status) );
+        return FALSE;
+    }
+
     SERVER_START_REQ( register_async )
     {
         req->type           = ASYNC_TYPE_READ;
@@ -3300,6 +3642,7 @@ int WINAPI WS_bind(SOCKET s, const struct WS_sockaddr* name, int namelen)
                 else
                 {
                     res=0; /* success */
+                    sock_fd_cache_set_bound(s);
                 }
             }
         }
@@ -3320,6 +3663,7 @@ int WINAPI WS_closesocket(SOCKET s)
         if (fd >= 0)
         {
             release_sock_fd(s, fd);
+            sock_fd_cache_remove(s);
             if (CloseHandle(SOCKET2HANDLE(s)))
                 res = 0;
         }
@@ -3373,6 +3717,9 @@ int WINAPI WS_connect(SOCKET s, const struct WS_sockaddr* name, int namelen)
         NTSTATUS status;
         BOOL is_blocking;
         int ret = do_connect(fd, name, namelen);
+        /* connect() binds the socket if needed */
+        if (ret == 0 || ret == WSAEINPROGRESS)
+            sock_fd_cache_set_bound(s);
         if (ret == 0)
             goto connect_success;
 
@@ -5241,9 +5588,27 @@ static void release_poll_fds( const WS_fd_set *readfds, const WS_fd_set *writefd
     }
 }
 
+/* compute the time left from the original timeout after an interrupted wait */
+static int get_timeout_left( const struct timeval *start, int timeout )
+{
+    struct timeval now;
+
+    gettimeofday( &now, 0 );
+
+    now.tv_sec  -= start->tv_sec;
+    now.tv_usec -= start->tv_usec;
+    if (now.tv_usec < 0)
+    {
+        now.tv_usec += 1000000;
+        now.tv_sec  -= 1;
+    }
+
+    return timeout - (now.tv_sec * 1000) - (now.tv_usec + 999) / 1000;
+}
+
 static int do_poll(struct pollfd *pollfds, int count, int timeout)
 {
-    struct timeval tv1, tv2;
+    struct timeval tv1;
     int ret, torig = timeout;
 
     if (timeout > 0) gettimeofday( &tv1, 0 );
@@ -5254,17 +5619,7 @@ static int do_poll(struct pollfd *pollfds, int count, int timeout)
         if (timeout < 0) continue;
         if (timeout == 0) return 0;
 
-        gettimeofday( &tv2, 0 );
-
-        tv2.tv_sec  -= tv1.tv_sec;
-        tv2.tv_usec -= tv1.tv_usec;
-        if (tv2.tv_usec < 0)
-        {
-            tv2.tv_usec += 1000000;
-            tv2.tv_sec  -= 1;
-        }
-
-        timeout = torig - (tv2.tv_sec * 1000) - (tv2.tv_usec + 999) / 1000;
+        timeout = get_timeout_left( &tv1, torig );
         if (timeout <= 0) return 0;
     }
     return ret;
@@ -5311,6 +5666,430 @@ static int get_poll_results( WS_fd_set *readfds, WS_fd_set *writefds, WS_fd_set
     return total;
 }
 
+#ifdef USE_EPOLL
+
+static struct poll_set *create_poll_set(void)
+{
+    struct poll_set *set;
+    int i;
+
+    if (!(set = HeapAlloc( GetProcessHeap(), HEAP_ZERO_MEMORY, sizeof(*set) ))) return NULL;
+    if ((set->epoll_fd = epoll_create( 128 )) == -1)
+    {
+        WARN( "epoll_create failed: %s\n", strerror(errno) );
+        HeapFree( GetProcessHeap(), 0, set );
+        return NULL;
+    }
+    fcntl( set->epoll_fd, F_SETFD, FD_CLOEXEC );
+    for (i = 0; i < POLL_SET_HASH_SIZE; i++) set->hash[i] = -1;
+    set->free_entry = -1;
+    return set;
+}
+
+/* start a new call on the thread's poll set; returns with the fd cache section held */
+static struct poll_set *poll_set_begin( int count )
+{
+    struct per_thread_data *ptb = get_per_thread_data();
+    struct poll_set *set = ptb->poll_set;
+
+    if (!set && !(set = ptb->poll_set = create_poll_set())) return NULL;
+
+    if (count > set->fds_size)
+    {
+        struct sock_fd_entry **created;
+        struct pollfd *fds;
+        int *fds_next;
+
+        fds = HeapAlloc( GetProcessHeap(), 0, count * sizeof(*fds) );
+        fds_next = HeapAlloc( GetProcessHeap(), 0, count * sizeof(*fds_next) );
+        created = HeapAlloc( GetProcessHeap(), 0, count * sizeof(*created) );
+        if (!fds || !fds_next || !created)
+        {
+            HeapFree( GetProcessHeap(), 0, fds );
+            HeapFree( GetProcessHeap(), 0, fds_next );
+            HeapFree( GetProcessHeap(), 0, created );
+            return NULL;
+        }
+        HeapFree( GetProcessHeap(), 0, set->fds );
+        HeapFree( GetProcessHeap(), 0, set->fds_next );
+        HeapFree( GetProcessHeap(), 0, set->created );
+        set->fds = fds;
+        set->fds_next = fds_next;
+        set->created = created;
+        set->fds_size = count;
+    }
+    if (!++set->serial) ++set->serial;
+    set->created_count = 0;
+
+    EnterCriticalSection( &sock_fd_cache_section );
+    return set;
+}
+
+/* get the entry of a socket in the poll set, allocating it if needed */
+static struct poll_set_entry *poll_set_get_entry( struct poll_set *set, SOCKET s )
+{
+    unsigned int hash = sock_hash( s, POLL_SET_HASH_SIZE );
+    struct poll_set_entry *entry;
+    int i;
+
+    for (i = set->hash[hash]; i != -1; i = set->entries[i].next)
+        if (set->entries[i].sock == s) return &set->entries[i];
+
+    if (set->free_entry == -1)
+    {
+        int size = max( set->entries_size * 2, 64 );
+        struct poll_set_entry *entries;
+        struct epoll_event *events;
+
+        if (set->entries)
+            entries = HeapReAlloc( GetProcessHeap(), 0, set->entries, size * sizeof(*entries) );
+        else
+            entries = HeapAlloc( GetProcessHeap(), 0, size * sizeof(*entries) );
+        if (!entries) return NULL;
+        set->entries = entries;
+
+        if (set->events)
+            events = HeapReAlloc( GetProcessHeap(), 0, set->events, size * sizeof(*events) );
+        else
+            events = HeapAlloc( GetProcessHeap(), 0, size * sizeof(*events) );
+        if (!events) return NULL;
+        set->events = events;
+
+        for (i = size - 1; i >= set->entries_size; i--)
+        {
+            entries[i].sock = INVALID_SOCKET;
+            entries[i].next = set->free_entry;
+            set->free_entry = i;
+        }
+        set->entries_size = size;
+    }
+
+    i = set->free_entry;
+    entry = &set->entries[i];
+    set->free_entry = entry->next;
+    entry->sock   = s;
+    entry->next   = set->hash[hash];
+    entry->reg    = NULL;
+    entry->events = 0;
+    entry->serial = 0;
+    set->hash[hash] = i;
+    return entry;
+}
+
+static void poll_set_free_entry( struct poll_set *set, struct poll_set_entry *entry )
+{
+    int *next = &set->hash[sock_hash( entry->sock, POLL_SET_HASH_SIZE )];
+    int index = entry - set->entries;
+
+    while (*next != index) next = &set->entries[*next].next;
+    *next = entry->next;
+    entry->sock = INVALID_SOCKET;
+    entry->next = set->free_entry;
+    set->free_entry = index;
+}
+
+/* ask for events on the socket of a cache entry for the given pollfd index */
+static BOOL poll_set_add( struct poll_set *set, int index, struct sock_fd_entry *cache, int events )
+{
+    struct poll_set_entry *entry;
+
+    if (!(entry = poll_set_get_entry( set, cache->sock ))) return FALSE;
+
+    if (entry->serial != set->serial)
+    {
+        entry->serial = set->serial;
+        entry->cache  = cache;
+        entry->wanted = 0;
+        entry->first  = -1;
+    }
+    entry->wanted |= events;
+    set->fds[index].fd      = cache->fd;
+    set->fds[index].events  = events;
+    set->fds[index].revents = 0;
+    set->fds_next[index] = entry->first;
+    entry->first = index;
+    return TRUE;
+}
+
+/* unregister the cache entry of a poll set entry and drop the reference it holds */
+static void poll_set_unregister( struct poll_set *set, struct poll_set_entry *entry )
+{
+    struct epoll_event ev;
+
+    if (!entry->reg) return;
+    /* a socket closed with closesocket() has already been removed from the set */
+    if (entry->reg->fd != -1)
+        epoll_ctl( set->epoll_fd, EPOLL_CTL_DEL, entry->reg->fd, &ev );
+    sock_fd_cache_release( entry->reg );
+    entry->reg = NULL;
+    entry->events = 0;
+}
+
+/* end the current call; releases the fd cache section */
+static void poll_set_end( struct poll_set *set )
+{
+    int i;
+
+    /* free the entries that are not used by any poll set */
+    for (i = 0; i < set->created_count; i++)
+        sock_fd_cache_release( set->created[i] );
+    set->created_count = 0;
+
+    LeaveCriticalSection( &sock_fd_cache_section );
+}
+
+/* bring the epoll set in sync with the current call; releases the fd cache section */
+static BOOL poll_set_commit( struct poll_set *set )
+{
+    struct epoll_event ev;
+    BOOL ret = TRUE;
+    int i;
+
+    for (i = 0; i < set->entries_size; i++)
+    {
+        struct poll_set_entry *entry = &set->entries[i];
+        struct sock_fd_entry *cache;
+
+        if (entry->sock == INVALID_SOCKET) continue;
+
+        if (entry->serial != set->serial)
+        {
+            poll_set_unregister( set, entry );
+            poll_set_free_entry( set, entry );
+            continue;
+        }
+
+        cache = entry->cache;
+        if (entry->reg == cache && entry->events == entry->wanted) continue;
+
+        ev.events   = entry->wanted;
+        ev.data.u64 = ((ULONGLONG)i << 32) | cache->id;
+        if (entry->reg == cache)
+        {
+            if (epoll_ctl( set->epoll_fd, EPOLL_CTL_MOD, cache->fd, &ev ) == -1) goto failed;
+        }
+        else
+        {
+            /* the socket handle now refers to another unix socket */
+            poll_set_unregister( set, entry );
+            if (epoll_ctl( set->epoll_fd, EPOLL_CTL_ADD, cache->fd, &ev ) == -1)
+            {
+                /* the fd may still be registered from a socket that used the same fd */
+                if (errno != EEXIST || epoll_ctl( set->epoll_fd, EPOLL_CTL_MOD, cache->fd, &ev ) == -1)
+                    goto failed;
+            }
+            entry->reg = cache;
+            cache->refs++;
+        }
+        entry->events = entry->wanted;
+        continue;
+
+    failed:
+        WARN( "failed to register fd %d: %s\n", cache->fd, strerror(errno) );
+        if (entry->reg == cache) poll_set_unregister( set, entry );
+        ret = FALSE;
+    }
+
+    poll_set_end( set );
+    return ret;
+}
+
+static void poll_set_abort( struct poll_set *set )
+{
+    poll_set_end( set );
+}
+
+/* wait on the poll set and store the results in the pollfd array of the current call */
+static int poll_set_wait( struct poll_set *set, int timeout )
+{
+    struct timeval tv1;
+    int i, j, ret, count, torig = timeout;
+
+    if (timeout > 0) gettimeofday( &tv1, 0 );
+
+    while ((ret = epoll_wait( set->epoll_fd, set->events, set->entries_size, timeout )) < 0)
+    {
+        if (errno != EINTR) return -1;
+        if (timeout < 0) continue;
+        if (timeout == 0) return 0;
+
+        timeout = get_timeout_left( &tv1, torig );
+        if (timeout <= 0) return 0;
+    }
+
+    count = 0;
+    for (i = 0; i < ret; i++)
+    {
+        unsigned int index = set->events[i].data.u64 >> 32;
+        unsigned int id = (unsigned int)set->events[i].data.u64;
+        struct poll_set_entry *entry;
+
+        if (index >= (unsigned int)set->entries_size) continue;
+        entry = &set->entries[index];
+        /* ignore events from a stale registration */
+        if (entry->sock == INVALID_SOCKET || !entry->reg || entry->reg->id != id ||
+            entry->serial != set->serial) continue;
+
+        for (j = entry->first; j != -1; j = set->fds_next[j])
+        {
+            short revents = set->events[i].events & (set->fds[j].events | POLLERR | POLLHUP);
+            if (revents && !set->fds[j].revents) count++;
+            set->fds[j].revents |= revents;
+        }
+    }
+    return count;
+}
+
+/* select() implementation for large fd sets through the thread's poll set */
+static BOOL select_poll_set( WS_fd_set *readfds, WS_fd_set *writefds, WS_fd_set *exceptfds,
+                             int timeout, int *ret )
+{
+    struct sock_fd_entry *cache;
+    struct poll_set *set;
+    struct pollfd *fds;
+    unsigned int i, j = 0, count = 0;
+
+    if (readfds) count += readfds->fd_count;
+    if (writefds) count += writefds->fd_count;
+    if (exceptfds) count += exceptfds->fd_count;
+    if (count < POLL_SET_MIN_COUNT) return FALSE;
+
+    if (!(set = poll_set_begin( count ))) return FALSE;
+    fds = set->fds;
+
+    if (readfds)
+        for (i = 0; i < readfds->fd_count; i++, j++)
+        {
+            if (!(cache = sock_fd_cache_get( set, readfds->fd_array[i] ))) goto failed;
+            fds[j].fd = -1;
+            fds[j].revents = 0;
+            if (cache->bound && !poll_set_add( set, j, cache, POLLIN )) goto fallback;
+        }
+    if (writefds)
+        for (i = 0; i < writefds->fd_count; i++, j++)
+        {
+            if (!(cache = sock_fd_cache_get( set, writefds->fd_array[i] ))) goto failed;
+            fds[j].fd = -1;
+            fds[j].revents = 0;
+            if ((cache->bound || cache->type == SOCK_DGRAM) && !poll_set_add( set, j, cache, POLLOUT ))
+                goto fallback;
+        }
+    if (exceptfds)
+        for (i = 0; i < exceptfds->fd_count; i++, j++)
+        {
+            if (!(cache = sock_fd_cache_get( set, exceptfds->fd_array[i] ))) goto failed;
+            fds[j].fd = -1;
+            fds[j].revents = 0;
+            /* urgent data is only reported separately if it isn't inlined */
+            if (cache->bound && !poll_set_add( set, j, cache, cache->oobinline ? POLLHUP : POLLHUP | POLLPRI ))
+                goto fallback;
+        }
+
+    if (!poll_set_commit( set )) return FALSE;
+
+    if ((*ret = poll_set_wait( set, timeout )) == -1)
+    {
+        SetLastError( wsaErrno() );
+        return TRUE;
+    }
+
+    if (exceptfds)
+    {
+        for (i = 0, j = count - exceptfds->fd_count; i < exceptfds->fd_count; i++, j++)
+        {
+            if (fds[j].fd != -1 && (fds[j].revents & POLLHUP))
+            {
+                /* Check if the socket still exists */
+                int fd = get_sock_fd( exceptfds->fd_array[i], 0, NULL );
+                if (fd != -1)
+                    release_sock_fd( exceptfds->fd_array[i], fd );
+                else
+                    fds[j].revents = 0;
+            }
+        }
+    }
+    *ret = get_poll_results( readfds, writefds, exceptfds, fds );
+    return TRUE;
+
+failed:
+    poll_set_abort( set );
+    *ret = SOCKET_ERROR;
+    return TRUE;
+
+fallback:
+    poll_set_abort( set );
+    return FALSE;
+}
+
+/* WSAPoll() implementation for large arrays through the thread's poll set */
+static BOOL wsapoll_poll_set( WSAPOLLFD *wfds, ULONG count, int timeout, int *ret )
+{
+    struct sock_fd_entry *cache;
+    struct poll_set *set;
+    struct pollfd *fds;
+    ULONG i;
+
+    if (count < POLL_SET_MIN_COUNT) return FALSE;
+
+    if (!(set = poll_set_begin( count ))) return FALSE;
+    fds = set->fds;
+
+    for (i = 0; i < count; i++)
+    {
+        fds[i].fd = -1;
+        fds[i].revents = 0;
+        if (!(cache = sock_fd_cache_get( set, wfds[i].fd ))) continue;
+        if (!poll_set_add( set, i, cache, convert_poll_w2u( wfds[i].events ) ))
+        {
+            poll_set_abort( set );
+            return FALSE;
+        }
+    }
+
+    if (!poll_set_commit( set )) return FALSE;
+
+    *ret = poll_set_wait( set, timeout );
+
+    for (i = 0; i < count; i++)
+    {
+        if (fds[i].fd != -1)
+        {
+            if (fds[i].revents & POLLHUP)
+            {
+                /* Check if the socket still exists */
+                int fd = get_sock_fd( wfds[i].fd, 0, NULL );
+                if (fd != -1)
+                {
+                    wfds[i].revents = WS_POLLHUP;
+                    release_sock_fd( wfds[i].fd, fd );
+                }
+                else
+                    wfds[i].revents = WS_POLLNVAL;
+            }
+            else
+                wfds[i].revents = convert_poll_u2w( fds[i].revents );
+        }
+        else
+            wfds[i].revents = WS_POLLNVAL;
+    }
+    return TRUE;
+}
+
+#else  /* USE_EPOLL */
+
+static inline BOOL select_poll_set( WS_fd_set *readfds, WS_fd_set *writefds, WS_fd_set *exceptfds,
+                                    int timeout, int *ret )
+{
+    return FALSE;
+}
+
+static inline BOOL wsapoll_poll_set( WSAPOLLFD *wfds, ULONG count, int timeout, int *ret )
+{
+    return FALSE;
+}
+
+#endif  /* USE_EPOLL */
+
 /***********************************************************************
  *		select			(WS2_32.18)
  */
@@ -5324,12 +6103,15 @@ int WINAPI WS_select(int nfds, WS_fd_set *ws_readfds,
     TRACE("read %p, write %p, excp %p timeout %p\n",
           ws_readfds, ws_writefds, ws_exceptfds, ws_timeout);
 
-    if (!(pollfds = fd_sets_to_poll( ws_readfds, ws_writefds, ws_exceptfds, &count )))
-        return SOCKET_ERROR;
-
     if (ws_timeout)
         timeout = (ws_timeout->tv_sec * 1000) + (ws_timeout->tv_usec + 999) / 1000;
 
+    if (select_poll_set( ws_readfds, ws_writefds, ws_exceptfds, timeout, &ret ))
+        return ret;
+
+    if (!(pollfds = fd_sets_to_poll( ws_readfds, ws_writefds, ws_exceptfds, &count )))
+        return SOCKET_ERROR;
+
     ret = do_poll(pollfds, count, timeout);
     release_poll_fds( ws_readfds, ws_writefds, ws_exceptfds, pollfds );
 
@@ -5358,6 +6140,9 @@ int WINAPI WSAPoll(WSAPOLLFD *wfds, ULONG count, int timeout)
         return SOCKET_ERROR;
     }
 
+    if (wsapoll_poll_set(wfds, count, timeout, &ret))
+        return ret;
+
     if (!(ufds = HeapAlloc(GetProcessHeap(), 0, count * sizeof(ufds[0]))))
     {
         SetLastError(WSAENOBUFS);
@@ -5518,6 +6303,8 @@ static int WS2_sendto( SOCKET s, LPWSABUF lpBuffers, DWORD dwBufferCount,
         err = wsaErrno();
         goto error;
     }
+    /* sending to an address binds the socket if needed */
+    if (to) sock_fd_cache_set_bound( s );
 
     if (overlapped)
     {
@@ -5950,6 +6737,8 @@ int WINAPI WS_setsockopt(SOCKET s, int level, int optname,
 
     if (setsockopt(fd, level, optname, optval, optlen) == 0)
     {
+        if (level == SOL_SOCKET && optname == SO_OOBINLINE)
+            sock_fd_cache_set_oobinline( s, optval && *(const int *)optval );
 #ifdef __APPLE__
         if (level == SOL_SOCKET && optname == SO_REUSEADDR &&
             setsockopt(fd, level, SO_REUSEPORT, optval, optlen) != 0)
@@ -7222,6 +8011,8 @@ SOCKET WINAPI WSASocketW(int af, int type, int protocol,
     if (ret)
     {
         TRACE("\tcreated %04lx\n", ret );
+        /* the handle may have been closed with CloseHandle() while cached */
+        sock_fd_cache_remove(ret);
         if (ipxptype > 0)
             set_ipx_packettype(ret, ipxptype);
        return ret;
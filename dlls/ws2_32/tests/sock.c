@@ -6534,6 +6534,201 @@ static BOOL poll_isset(WSAPOLLFD *fds, int max, SOCKET s, int rev)
     return FALSE;
 }
 
+struct large_fd_set
+{
+    u_int  fd_count;
+    SOCKET fd_array[4096];
+};
+
+static void select_large_set(int count, SOCKET *socks, int iterations)
+{
+    static char buffer[16];
+    struct large_fd_set *readfds, *writefds;
+    struct timeval select_timeout, peer_timeout;
+    struct sockaddr_in addr;
+    SOCKET sender, peer;
+    fd_set peer_set;
+    DWORD ticks;
+    int i, j, ret, len;
+
+    readfds = HeapAlloc(GetProcessHeap(), 0, sizeof(*readfds));
+    writefds = HeapAlloc(GetProcessHeap(), 0, sizeof(*writefds));
+
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = inet_addr("127.0.0.1");
+    for (i = 0; i < count; i++)
+    {
+        socks[i] = socket(AF_INET, SOCK_DGRAM, 0);
+        ok(socks[i] != INVALID_SOCKET, "socket failed: %d\n", WSAGetLastError());
+        addr.sin_port = 0;
+        ret = bind(socks[i], (struct sockaddr *)&addr, sizeof(addr));
+        ok(!ret, "bind failed: %d\n", WSAGetLastError());
+    }
+    sender = socket(AF_INET, SOCK_DGRAM, 0);
+    ok(sender != INVALID_SOCKET, "socket failed: %d\n", WSAGetLastError());
+
+    select_timeout.tv_sec = 0;
+    select_timeout.tv_usec = 0;
+
+    /* idle sockets are not readable, but all of them are writable */
+    for (i = 0; i < 3; i++)
+    {
+        readfds->fd_count = count;
+        memcpy(readfds->fd_array, socks, count * sizeof(SOCKET));
+        ret = select(0, (fd_set *)readfds, NULL, NULL, &select_timeout);
+        ok(ret == 0, "expected 0, got %d\n", ret);
+        ok(readfds->fd_count == 0, "expected 0, got %u\n", readfds->fd_count);
+    }
+    writefds->fd_count = count;
+    memcpy(writefds->fd_array, socks, count * sizeof(SOCKET));
+    ret = select(0, NULL, (fd_set *)writefds, NULL, &select_timeout);
+    ok(ret == count, "expected %d, got %d\n", count, ret);
+
+    /* the same set is polled several times while data is pending */
+    len = sizeof(addr);
+    ret = getsockname(socks[count / 2], (struct sockaddr *)&addr, &len);
+    ok(!ret, "getsockname failed: %d\n", WSAGetLastError());
+    ret = sendto(sender, "x", 1, 0, (struct sockaddr *)&addr, sizeof(addr));
+    ok(ret == 1, "sendto failed: %d\n", WSAGetLastError());
+    for (i = 0; i < 3; i++)
+    {
+        readfds->fd_count = count;
+        memcpy(readfds->fd_array, socks, count * sizeof(SOCKET));
+        ret = select(0, (fd_set *)readfds, NULL, NULL, &select_timeout);
+        ok(ret == 1, "expected 1, got %d\n", ret);
+        ok(readfds->fd_count == 1 && readfds->fd_array[0] == socks[count / 2],
+           "wrong socket returned\n");
+    }
+    ret = recv(socks[count / 2], buffer, sizeof(buffer), 0);
+    ok(ret == 1, "recv failed: %d\n", WSAGetLastError());
+    readfds->fd_count = count;
+    memcpy(readfds->fd_array, socks, count * sizeof(SOCKET));
+    ret = select(0, (fd_set *)readfds, NULL, NULL, &select_timeout);
+    ok(ret == 0, "expected 0, got %d\n", ret);
+
+    /* replace a socket of the set by a new one, which may reuse its handle */
+    closesocket(socks[0]);
+    socks[0] = socket(AF_INET, SOCK_DGRAM, 0);
+    ok(socks[0] != INVALID_SOCKET, "socket failed: %d\n", WSAGetLastError());
+    addr.sin_port = 0;
+    ret = bind(socks[0], (struct sockaddr *)&addr, sizeof(addr));
+    ok(!ret, "bind failed: %d\n", WSAGetLastError());
+    len = sizeof(addr);
+    ret = getsockname(socks[0], (struct sockaddr *)&addr, &len);
+    ok(!ret, "getsockname failed: %d\n", WSAGetLastError());
+    ret = sendto(sender, "x", 1, 0, (struct sockaddr *)&addr, sizeof(addr));
+    ok(ret == 1, "sendto failed: %d\n", WSAGetLastError());
+    readfds->fd_count = count;
+    memcpy(readfds->fd_array, socks, count * sizeof(SOCKET));
+    ret = select(0, (fd_set *)readfds, NULL, NULL, &select_timeout);
+    ok(ret == 1, "expected 1, got %d\n", ret);
+    ok(readfds->fd_count == 1 && readfds->fd_array[0] == socks[0], "wrong socket returned\n");
+    ret = recv(socks[0], buffer, sizeof(buffer), 0);
+    ok(ret == 1, "recv failed: %d\n", WSAGetLastError());
+
+    /* close a socket of the set with CloseHandle(), and replace it by a new one
+     * which may reuse its handle */
+    closesocket(socks[1]);
+    ret = tcp_socketpair(&peer, &socks[1]);
+    ok(!ret, "failed to create socket pair\n");
+    readfds->fd_count = count;
+    memcpy(readfds->fd_array, socks, count * sizeof(SOCKET));
+    ret = select(0, (fd_set *)readfds, NULL, NULL, &select_timeout);
+    ok(ret == 0, "expected 0, got %d\n", ret);
+    ret = CloseHandle((HANDLE)socks[1]);
+    ok(ret, "CloseHandle failed: %u\n", GetLastError());
+    socks[1] = socket(AF_INET, SOCK_DGRAM, 0);
+    ok(socks[1] != INVALID_SOCKET, "socket failed: %d\n", WSAGetLastError());
+    addr.sin_port = 0;
+    ret = bind(socks[1], (struct sockaddr *)&addr, sizeof(addr));
+    ok(!ret, "bind failed: %d\n", WSAGetLastError());
+    len = sizeof(addr);
+    ret = getsockname(socks[1], (struct sockaddr *)&addr, &len);
+    ok(!ret, "getsockname failed: %d\n", WSAGetLastError());
+    ret = sendto(sender, "x", 1, 0, (struct sockaddr *)&addr, sizeof(addr));
+    ok(ret == 1, "sendto failed: %d\n", WSAGetLastError());
+    readfds->fd_count = count;
+    memcpy(readfds->fd_array, socks, count * sizeof(SOCKET));
+    ret = select(0, (fd_set *)readfds, NULL, NULL, &select_timeout);
+    ok(ret == 1, "expected 1, got %d\n", ret);
+    ok(readfds->fd_count == 1 && readfds->fd_array[0] == socks[1], "wrong socket returned\n");
+    ret = recv(socks[1], buffer, sizeof(buffer), 0);
+    ok(ret == 1, "recv failed: %d\n", WSAGetLastError());
+
+    /* the peer of the closed socket sees the connection closed */
+    FD_ZERO(&peer_set);
+    FD_SET(peer, &peer_set);
+    peer_timeout.tv_sec = 5;
+    peer_timeout.tv_usec = 0;
+    ret = select(0, &peer_set, NULL, NULL, &peer_timeout);
+    ok(ret == 1, "expected 1, got %d\n", ret);
+    ret = recv(peer, buffer, sizeof(buffer), 0);
+    ok(ret == 0, "expected 0, got %d\n", ret);
+    closesocket(peer);
+
+    ticks = GetTickCount();
+    for (i = 0; i < iterations; i++)
+    {
+        readfds->fd_count = count - 1;
+        memcpy(readfds->fd_array, socks + 1, (count - 1) * sizeof(SOCKET));
+        ret = select(0, (fd_set *)readfds, NULL, NULL, &select_timeout);
+        if (ret) break;
+    }
+    ok(ret == 0, "expected 0, got %d\n", ret);
+    ticks = GetTickCount() - ticks;
+    trace("select on %d idle sockets: %u calls in %u ms\n", count - 1, i, ticks);
+
+    if (pWSAPoll)
+    {
+        WSAPOLLFD *fds = HeapAlloc(GetProcessHeap(), 0, count * sizeof(*fds));
+
+        for (i = 0; i < count; i++)
+        {
+            fds[i].fd = socks[i];
+            fds[i].events = POLLRDNORM;
+            fds[i].revents = 0xdead;
+        }
+        ret = pWSAPoll(fds, count, 0);
+        ok(ret == 1, "expected 1, got %d\n", ret);
+        ok(fds[0].revents == POLLRDNORM, "got %x\n", fds[0].revents);
+        for (i = 1, j = 0; i < count; i++) if (fds[i].revents) j++;
+        ok(!j, "%d idle sockets returned events\n", j);
+
+        ticks = GetTickCount();
+        for (i = 0; i < iterations; i++)
+        {
+            ret = pWSAPoll(fds + 1, count - 1, 0);
+            if (ret) break;
+        }
+        ok(ret == 0, "expected 0, got %d\n", ret);
+        ticks = GetTickCount() - ticks;
+        trace("WSAPoll on %d idle sockets: %u calls in %u ms\n", count - 1, i, ticks);
+        HeapFree(GetProcessHeap(), 0, fds);
+    }
+
+    for (i = 0; i < count; i++) closesocket(socks[i]);
+    closesocket(sender);
+    HeapFree(GetProcessHeap(), 0, readfds);
+    HeapFree(GetProcessHeap(), 0, writefds);
+}
+
+static void test_select_large_set(void)
+{
+    static const int counts[] = { 256, 1024, 4096 };
+    SOCKET *socks;
+    int i;
+
+    socks = HeapAlloc(GetProcessHeap(), 0, 4096 * sizeof(*socks));
+    for (i = 0; i < sizeof(counts) / sizeof(counts[0]); i++)
+    {
+        /* the larger sets are only timed in interactive mode */
+        if (counts[i] > 256 && !winetest_interactive) break;
+        select_large_set(counts[i], socks, 100);
+    }
+    HeapFree(GetProcessHeap(), 0, socks);
+}
+
 static void test_WSAPoll(void)
 {
     int ix, ret, err, poll_timeout;
@@ -7843,6 +8038,117 @@ end:
         closesocket(connector2);
 }
 
+static void test_AcceptEx_backlog(void)
+{
+    GUID acceptExGuid = WSAID_ACCEPTEX, getAcceptExGuid = WSAID_GETACCEPTEXSOCKADDRS;
+    LPFN_ACCEPTEX pAcceptEx = NULL;
+    LPFN_GETACCEPTEXSOCKADDRS pGetAcceptExSockaddrs = NULL;
+    SOCKET listener, acceptors[64], connectors[64];
+    struct sockaddr_in addr, peer, *local_addr, *remote_addr;
+    char buffers[64][2 * (sizeof(struct sockaddr_in) + 16)];
+    OVERLAPPED overlapped[64], *ovl;
+    int count, i, iret, len, local_len, remote_len;
+    DWORD size, ticks;
+    ULONG_PTR key;
+    HANDLE port;
+    BOOL bret;
+
+    count = winetest_interactive ? 64 : 16;
+
+    listener = socket(AF_INET, SOCK_STREAM, 0);
+    ok(listener != INVALID_SOCKET, "socket failed: %d\n", WSAGetLastError());
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = inet_addr("127.0.0.1");
+    iret = bind(listener, (struct sockaddr *)&addr, sizeof(addr));
+    ok(!iret, "bind failed: %d\n", WSAGetLastError());
+    len = sizeof(addr);
+    iret = getsockname(listener, (struct sockaddr *)&addr, &len);
+    ok(!iret, "getsockname failed: %d\n", WSAGetLastError());
+    iret = listen(listener, SOMAXCONN);
+    ok(!iret, "listen failed: %d\n", WSAGetLastError());
+
+    iret = WSAIoctl(listener, SIO_GET_EXTENSION_FUNCTION_POINTER, &acceptExGuid, sizeof(acceptExGuid),
+                    &pAcceptEx, sizeof(pAcceptEx), &size, NULL, NULL);
+    if (!iret)
+        iret = WSAIoctl(listener, SIO_GET_EXTENSION_FUNCTION_POINTER, &getAcceptExGuid,
+                        sizeof(getAcceptExGuid), &pGetAcceptExSockaddrs, sizeof(pGetAcceptExSockaddrs),
+                        &size, NULL, NULL);
+    if (iret)
+    {
+        skip("AcceptEx not supported\n");
+        closesocket(listener);
+        return;
+    }
+
+    port = CreateIoCompletionPort((HANDLE)listener, NULL, 125, 0);
+    ok(port != NULL, "failed to create completion port %u\n", GetLastError());
+
+    /* queue the connections before any AcceptEx() call is made */
+    for (i = 0; i < count; i++)
+    {
+        connectors[i] = socket(AF_INET, SOCK_STREAM, 0);
+        ok(connectors[i] != INVALID_SOCKET, "socket failed: %d\n", WSAGetLastError());
+        iret = connect(connectors[i], (struct sockaddr *)&addr, sizeof(addr));
+        ok(!iret, "connect failed: %d\n", WSAGetLastError());
+        acceptors[i] = socket(AF_INET, SOCK_STREAM, 0);
+        ok(acceptors[i] != INVALID_SOCKET, "socket failed: %d\n", WSAGetLastError());
+    }
+
+    ticks = GetTickCount();
+    for (i = 0; i < count; i++)
+    {
+        memset(&overlapped[i], 0, sizeof(overlapped[i]));
+        bret = pAcceptEx(listener, acceptors[i], buffers[i], 0,
+                         sizeof(struct sockaddr_in) + 16, sizeof(struct sockaddr_in) + 16,
+                         &size, &overlapped[i]);
+        ok(!bret && WSAGetLastError() == ERROR_IO_PENDING, "AcceptEx returned %d + errno %d\n",
+           bret, WSAGetLastError());
+    }
+
+    for (i = 0; i < count; i++)
+    {
+        ovl = NULL;
+        key = 0;
+        bret = GetQueuedCompletionStatus(port, &size, &key, &ovl, 1000);
+        ok(bret, "GetQueuedCompletionStatus failed: %u\n", GetLastError());
+        if (!bret) break;
+        ok(key == 125, "got key %lx\n", key);
+        ok(!size, "got size %u\n", size);
+        ok(ovl == &overlapped[i], "got overlapped %p, expected %p\n", ovl, &overlapped[i]);
+    }
+    ticks = GetTickCount() - ticks;
+    trace("AcceptEx of %d queued connections: %u ms\n", count, ticks);
+
+    for (i = 0; i < count; i++)
+    {
+        local_len = remote_len = 0;
+        pGetAcceptExSockaddrs(buffers[i], 0, sizeof(struct sockaddr_in) + 16,
+                              sizeof(struct sockaddr_in) + 16, (struct sockaddr **)&local_addr,
+                              &local_len, (struct sockaddr **)&remote_addr, &remote_len);
+        len = sizeof(peer);
+        iret = getsockname(connectors[i], (struct sockaddr *)&peer, &len);
+        ok(!iret, "getsockname failed: %d\n", WSAGetLastError());
+        ok(local_len == sizeof(struct sockaddr_in), "got local length %d\n", local_len);
+        ok(local_addr->sin_port == addr.sin_port, "got local port %d, expected %d\n",
+           ntohs(local_addr->sin_port), ntohs(addr.sin_port));
+        ok(remote_len == sizeof(struct sockaddr_in), "got remote length %d\n", remote_len);
+        ok(remote_addr->sin_port == peer.sin_port, "%d: got remote port %d, expected %d\n",
+           i, ntohs(remote_addr->sin_port), ntohs(peer.sin_port));
+
+        iret = send(connectors[i], "x", 1, 0);
+        ok(iret == 1, "send failed: %d\n", WSAGetLastError());
+        iret = recv(acceptors[i], buffers[i], 1, 0);
+        ok(iret == 1, "recv failed: %d\n", WSAGetLastError());
+
+        closesocket(acceptors[i]);
+        closesocket(connectors[i]);
+    }
+
+    closesocket(listener);
+    CloseHandle(port);
+}
+
 static void test_DisconnectEx(void)
 {
     SOCKET listener, acceptor, connector;
@@ -9873,6 +10179,7 @@ START_TEST( sock )
     test_WSASendTo();
     test_WSARecv();
     test_WSAPoll();
+    test_select_large_set();
 
     test_events(0);
     test_events(1);
@@ -9882,6 +10189,7 @@ START_TEST( sock )
     test_GetAddrInfoW();
     test_getaddrinfo();
     test_AcceptEx();
+    test_AcceptEx_backlog();
     test_ConnectEx();
     test_DisconnectEx();
 
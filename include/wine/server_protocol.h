@@ -1595,11 +1595,14 @@ struct accept_into_socket_request
     struct request_header __header;
     obj_handle_t lhandle;
     obj_handle_t ahandle;
-    char __pad_20[4];
+    int          nowait;
 };
 struct accept_into_socket_reply
 {
     struct reply_header __header;
+    data_size_t  local_len;
+    /* VARARG(addrs,bytes); */
+    char __pad_12[4];
 };
 
 
@@ -3353,6 +3356,8 @@ struct get_named_pipe_info_reply
     unsigned int   instances;
     unsigned int   outsize;
     unsigned int   insize;
+    process_id_t   client_pid;
+    process_id_t   server_pid;
 };
 
 
@@ -6365,6 +6370,6 @@ union generic_reply
     struct terminate_job_reply terminate_job_reply;
 };
 
-#define SERVER_PROTOCOL_VERSION 517
+#define SERVER_PROTOCOL_VERSION 519
 
 #endif /* __WINE_WINE_SERVER_PROTOCOL_H */
@@ -2355,6 +2355,17 @@ extern struct _TEB * WINAPI NtCurrentTeb(void);
 #endif
 #define GetFiberData()     (*(void **)GetCurrentFiber())
 
+static FORCEINLINE void YieldProcessor(void)
+{
+#ifdef __GNUC__
+#if defined(__i386__) || defined(__x86_64__)
+    __asm__ __volatile__( "rep; nop" : : : "memory" );
+#else
+    __asm__ __volatile__( "" : : : "memory" );
+#endif
+#endif
+}
+
 #define TLS_MINIMUM_AVAILABLE 64
 
 /*
@@ -43,6 +43,74 @@ static const unsigned char utf8_mask[4] = { 0x7f, 0x1f, 0x0f, 0x07 };
 /* minimum Unicode value depending on UTF-8 sequence length */
 static const unsigned int utf8_minval[4] = { 0x0, 0x80, 0x800, 0x10000 };
 
+/* length of the leading run of 7-bit ASCII chars, in blocks of 8 chars */
+static inline unsigned int ascii_run_mbs( const char *src, unsigned int srclen )
+{
+    unsigned int len, block[2];
+
+    for (len = 0; len + 8 <= srclen; len += 8)
+    {
+        memcpy( block, src + len, sizeof(block) );
+        if ((block[0] | block[1]) & 0x80808080) break;
+    }
+    return len;
+}
+
+/* length of the leading run of 7-bit ASCII WCHARs, in blocks of 8 WCHARs */
+static inline unsigned int ascii_run_wcs( const WCHAR *src, unsigned int srclen )
+{
+    unsigned int len, block[4];
+
+    for (len = 0; len + 8 <= srclen; len += 8)
+    {
+        memcpy( block, src + len, sizeof(block) );
+        if ((block[0] | block[1] | block[2] | block[3]) & 0xff80ff80) break;
+    }
+    return len;
+}
+
+/* convert the leading run of 7-bit ASCII chars to WCHARs, in blocks of 8 chars */
+static inline unsigned int copy_ascii_mbs( WCHAR *dst, const char *str, unsigned int len )
+{
+    const unsigned char *src = (const unsigned char *)str;
+    unsigned int run, block[2];
+
+    for (run = 0; run + 8 <= len; run += 8, src += 8, dst += 8)
+    {
+        memcpy( block, src, sizeof(block) );
+        if ((block[0] | block[1]) & 0x80808080) break;
+        dst[0] = src[0];
+        dst[1] = src[1];
+        dst[2] = src[2];
+        dst[3] = src[3];
+        dst[4] = src[4];
+        dst[5] = src[5];
+        dst[6] = src[6];
+        dst[7] = src[7];
+    }
+    return run;
+}
+
+/* convert the leading run of 7-bit ASCII WCHARs to chars, in blocks of 8 WCHARs */
+static inline unsigned int copy_ascii_wcs( char *dst, const WCHAR *src, unsigned int len )
+{
+    unsigned int run, block[4];
+
+    for (run = 0; run + 8 <= len; run += 8, src += 8, dst += 8)
+    {
+        memcpy( block, src, sizeof(block) );
+        if ((block[0] | block[1] | block[2] | block[3]) & 0xff80ff80) break;
+        dst[0] = src[0];
+        dst[1] = src[1];
+        dst[2] = src[2];
+        dst[3] = src[3];
+        dst[4] = src[4];
+        dst[5] = src[5];
+        dst[6] = src[6];
+        dst[7] = src[7];
+    }
+    return run;
+}
 
 /* get the next char value taking surrogates into account */
 static inline unsigned int get_surrogate_value( const WCHAR *src, unsigned int srclen )
@@ -68,7 +136,10 @@ static inline int get_length_wcs_utf8( int flags, const WCHAR *src, unsigned int
     {
         if (*src < 0x80)  /* 0x00-0x7f: 1 byte */
         {
-            len++;
+            unsigned int run = ascii_run_wcs( src + 1, srclen - 1 );
+            len += run + 1;
+            src += run;
+            srclen -= run;
             continue;
         }
         if (*src < 0x800)  /* 0x80-0x7ff: 2 bytes */
@@ -108,8 +179,15 @@ int wine_utf8_wcstombs( int flags, const WCHAR *src, int srclen, char *dst, int
 
         if (ch < 0x80)  /* 0x00-0x7f: 1 byte */
         {
+            unsigned int run;
+
             if (!len--) return -1;  /* overflow */
             *dst++ = ch;
+            run = copy_ascii_wcs( dst, src + 1, min( srclen - 1, len ));
+            dst += run;
+            src += run;
+            srclen -= run;
+            len -= run;
             continue;
         }
 
@@ -285,7 +363,9 @@ static inline int get_length_mbs_utf8( int flags, const char *src, int srclen )
         unsigned char ch = *src++;
         if (ch < 0x80)  /* special fast case for 7-bit ASCII */
         {
-            ret++;
+            unsigned int run = ascii_run_mbs( src, srcend - src );
+            ret += run + 1;
+            src += run;
             continue;
         }
         if ((res = decode_utf8_char( ch, &src, srcend )) <= 0x10ffff)
@@ -316,7 +396,12 @@ int wine_utf8_mbstowcs( int flags, const char *src, int srclen, WCHAR *dst, int
         unsigned char ch = *src++;
         if (ch < 0x80)  /* special fast case for 7-bit ASCII */
         {
+            unsigned int run;
+
             *dst++ = ch;
+            run = copy_ascii_mbs( dst, src, min( srcend - src, dstend - dst ));
+            dst += run;
+            src += run;
             continue;
         }
         if ((res = decode_utf8_char( ch, &src, srcend )) <= 0xffff)
@@ -93,6 +93,7 @@ struct inotify_event {
 #define IN_CREATE        0x00000100
 #define IN_DELETE        0x00000200
 #define IN_DELETE_SELF   0x00000400
+#define IN_Q_OVERFLOW    0x00004000
 
 #define IN_ISDIR         0x40000000
 
@@ -139,6 +140,8 @@ struct dir
     int            want_data; /* return change data */
     int            subtree;  /* do we want to watch subdirectories? */
     struct list    change_records;   /* data for the change */
+    unsigned int   record_count;     /* number of queued change records */
+    int            overflow; /* too many changes were queued */
     struct list    in_entry; /* entry in the inode dirs list */
     struct inode  *inode;    /* inode of the associated directory */
     struct process *client_process;  /* client process that has a cache for this directory */
@@ -465,6 +468,7 @@ static struct change_record *get_first_change_record( struct dir *dir )
     struct list *ptr = list_head( &dir->change_records );
     if (!ptr) return NULL;
     list_remove( ptr );
+    dir->record_count--;
     return LIST_ENTRY( ptr, struct change_record, entry );
 }
 
@@ -521,7 +525,11 @@ static enum server_fd_type dir_get_fd_type( struct fd *fd )
 
 #ifdef USE_INOTIFY
 
-#define HASH_SIZE 31
+#define HASH_SIZE 1021
+
+/* maximum number of change records queued on a directory before we give up
+ * and tell the client to rescan it */
+#define MAX_CHANGE_RECORDS 4096
 
 struct inode {
     struct list ch_entry;    /* entry in the children list */
@@ -714,22 +722,43 @@ static void inotify_do_change_notify( struct dir *dir, unsigned int action,
                                       unsigned int cookie, const char *relpath )
 {
     struct change_record *record;
+    struct list *ptr;
 
     assert( dir->obj.ops == &dir_ops );
 
-    if (dir->want_data)
+    if (dir->want_data && !dir->overflow)
     {
         size_t len = strlen(relpath);
-        record = malloc( offsetof(struct change_record, event.name[len]) );
-        if (!record)
-            return;
 
-        record->cookie = cookie;
-        record->event.action = action;
-        memcpy( record->event.name, relpath, len );
-        record->event.len = len;
+        /* coalesce repeated modifications of the same file */
+        if (action == FILE_ACTION_MODIFIED && (ptr = list_tail( &dir->change_records )))
+        {
+            record = LIST_ENTRY( ptr, struct change_record, entry );
+            if (record->event.action == action && record->event.len == len &&
+                !memcmp( record->event.name, relpath, len ))
+                return;
+        }
+
+        if (dir->record_count >= MAX_CHANGE_RECORDS)
+        {
+            /* drop everything, the client will have to enumerate the directory */
+            while ((record = get_first_change_record( dir ))) free( record );
+            dir->overflow = 1;
+        }
+        else
+        {
+            record = malloc( offsetof(struct change_record, event.name[len]) );
+            if (!record)
+                return;
 
-        list_add_tail( &dir->change_records, &record->entry );
+            record->cookie = cookie;
+            record->event.action = action;
+            memcpy( record->event.name, relpath, len );
+            record->event.len = len;
+
+            list_add_tail( &dir->change_records, &record->entry );
+            dir->record_count++;
+        }
     }
 
     fd_async_wake_up( dir->fd, ASYNC_TYPE_WAIT, STATUS_ALERTED );
@@ -872,6 +901,23 @@ static int prepend( char **path, const char *segment )
     return 1;
 }
 
+/* the kernel queue overflowed, all the watches may have missed events */
+static void inotify_notify_overflow(void)
+{
+    struct change_record *record;
+    struct dir *dir;
+
+    LIST_FOR_EACH_ENTRY( dir, &change_list, struct dir, entry )
+    {
+        if (dir->want_data)
+        {
+            while ((record = get_first_change_record( dir ))) free( record );
+            dir->overflow = 1;
+        }
+        fd_async_wake_up( dir->fd, ASYNC_TYPE_WAIT, STATUS_ALERTED );
+    }
+}
+
 static void inotify_notify_all( struct inotify_event *ie )
 {
     unsigned int filter, action;
@@ -935,7 +981,7 @@ static void inotify_notify_all( struct inotify_event *ie )
 static void inotify_poll_event( struct fd *fd, int event )
 {
     int r, ofs, unix_fd;
-    char buffer[0x1000];
+    char buffer[0x4000];
     struct inotify_event *ie;
 
     unix_fd = get_unix_fd( fd );
@@ -946,14 +992,15 @@ static void inotify_poll_event( struct fd *fd, int event )
         return;
     }
 
-    for( ofs = 0; ofs < r - offsetof(struct inotify_event, name); )
+    for( ofs = 0; ofs + offsetof(struct inotify_event, name) <= r; )
     {
         ie = (struct inotify_event*) &buffer[ofs];
-        if (!ie->len)
-            break;
         ofs += offsetof( struct inotify_event, name[ie->len] );
         if (ofs > r) break;
-        inotify_notify_all( ie );
+        if (ie->mask & IN_Q_OVERFLOW)
+            inotify_notify_overflow();
+        else if (ie->len)  /* events on the watched directory itself carry no name */
+            inotify_notify_all( ie );
     }
 }
 
@@ -1189,6 +1236,8 @@ struct object *create_dir_obj( struct fd *fd, unsigned int access, mode_t mode )
         return NULL;
 
     list_init( &dir->change_records );
+    dir->record_count = 0;
+    dir->overflow = 0;
     dir->filter = 0;
     dir->notified = 0;
     dir->want_data = 0;
@@ -1281,7 +1330,7 @@ DECL_HANDLER(read_change)
     struct dir *dir;
     struct list events;
     char *data, *event;
-    int size = 0;
+    int size = 0, overflow;
 
     dir = get_dir_obj( current->process, req->handle, 0 );
     if (!dir)
@@ -1289,8 +1338,17 @@ DECL_HANDLER(read_change)
 
     list_init( &events );
     list_move_tail( &events, &dir->change_records );
+    dir->record_count = 0;
+    overflow = dir->overflow;
+    dir->overflow = 0;
     release_object( dir );
 
+    if (overflow)
+    {
+        set_error( STATUS_NOTIFY_ENUM_DIR );
+        return;
+    }
+
     if (list_empty( &events ))
     {
         set_error( STATUS_NO_DATA_DETECTED );
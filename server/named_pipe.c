@@ -50,6 +50,7 @@
 
 #include "file.h"
 #include "handle.h"
+#include "process.h"
 #include "thread.h"
 #include "request.h"
 #include "security.h"
@@ -78,6 +79,7 @@ struct pipe_server
     struct timeout_user *flush_poll;
     unsigned int         options;    /* pipe options */
     unsigned int         pipe_flags;
+    process_id_t         process_id; /* process that created the server */
 };
 
 struct pipe_client
@@ -87,6 +89,7 @@ struct pipe_client
     struct pipe_server  *server;     /* server that this client is connected to */
     unsigned int         flags;      /* file flags */
     unsigned int         pipe_flags;
+    process_id_t         process_id; /* process that opened the client */
 };
 
 struct named_pipe
@@ -693,6 +696,7 @@ static struct pipe_server *create_pipe_server( struct named_pipe *pipe, unsigned
     server->flush_poll = NULL;
     server->options = options;
     server->pipe_flags = pipe_flags;
+    server->process_id = get_process_id( current->process );
 
     list_add_head( &pipe->servers, &server->entry );
     grab_object( pipe );
@@ -717,6 +721,7 @@ static struct pipe_client *create_pipe_client( unsigned int flags, unsigned int
     client->server = NULL;
     client->flags = flags;
     client->pipe_flags = pipe_flags;
+    client->process_id = get_process_id( current->process );
 
     return client;
 }
@@ -992,7 +997,10 @@ DECL_HANDLER(get_named_pipe_info)
         reply->instances    = server->pipe->instances;
         reply->insize       = server->pipe->insize;
         reply->outsize      = server->pipe->outsize;
+        reply->server_pid   = server->process_id;
+        if (server->client) reply->client_pid = server->client->process_id;
     }
+    if (client) reply->client_pid = client->process_id;
 
     if (client)
         release_object(client);
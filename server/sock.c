@@ -1256,10 +1256,37 @@ DECL_HANDLER(accept_into_socket)
         return;
     }
 
+    /* leave pending connections to the asyncs that are already waiting for them */
+    if (req->nowait && async_queued( sock->read_q ))
+    {
+        set_error( STATUS_CANT_WAIT );
+        release_object( acceptsock );
+        release_object( sock );
+        return;
+    }
+
     if (accept_into_socket( sock, acceptsock ))
     {
+        struct sockaddr_storage local, remote;
+        socklen_t local_len = sizeof(local), remote_len = sizeof(remote);
+        int unix_fd = get_unix_fd( acceptsock->fd );
+
         acceptsock->wparam = req->ahandle;  /* wparam for message is the socket handle */
         sock_reselect( acceptsock );
+
+        /* return the addresses right away to save the client a round trip for each */
+        if (!getsockname( unix_fd, (struct sockaddr *)&local, &local_len ) &&
+            !getpeername( unix_fd, (struct sockaddr *)&remote, &remote_len ) &&
+            local_len + remote_len <= get_reply_max_size())
+        {
+            char *ptr = set_reply_data_size( local_len + remote_len );
+            if (ptr)
+            {
+                memcpy( ptr, &local, local_len );
+                memcpy( ptr + local_len, &remote, remote_len );
+                reply->local_len = local_len;
+            }
+        }
     }
     release_object( acceptsock );
     release_object( sock );
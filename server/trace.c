@@ -1841,6 +1841,13 @@ static void dump_accept_into_socket_request( const struct accept_into_socket_req
 {
     fprintf( stderr, " lhandle=%04x", req->lhandle );
     fprintf( stderr, ", ahandle=%04x", req->ahandle );
+    fprintf( stderr, ", nowait=%d", req->nowait );
+}
+
+static void dump_accept_into_socket_reply( const struct accept_into_socket_reply *req )
+{
+    fprintf( stderr, " local_len=%u", req->local_len );
+    dump_varargs_bytes( ", addrs=", cur_size );
 }
 
 static void dump_set_socket_event_request( const struct set_socket_event_request *req )
@@ -2966,6 +2973,8 @@ static void dump_get_named_pipe_info_reply( const struct get_named_pipe_info_rep
     fprintf( stderr, ", instances=%08x", req->instances );
     fprintf( stderr, ", outsize=%08x", req->outsize );
     fprintf( stderr, ", insize=%08x", req->insize );
+    fprintf( stderr, ", client_pid=%04x", req->client_pid );
+    fprintf( stderr, ", server_pid=%04x", req->server_pid );
 }
 
 static void dump_set_named_pipe_info_request( const struct set_named_pipe_info_request *req )
@@ -4762,7 +4771,7 @@ static const dump_func reply_dumpers[REQ_NB_REQUESTS] = {
     NULL,
     (dump_func)dump_create_socket_reply,
     (dump_func)dump_accept_socket_reply,
-    NULL,
+    (dump_func)dump_accept_into_socket_reply,
     NULL,
     (dump_func)dump_get_socket_event_reply,
     (dump_func)dump_get_socket_info_reply,
@@ -5349,6 +5358,7 @@ static const struct
     { "NAME_TOO_LONG",               STATUS_NAME_TOO_LONG },
     { "NETWORK_BUSY",                STATUS_NETWORK_BUSY },
     { "NETWORK_UNREACHABLE",         STATUS_NETWORK_UNREACHABLE },
+    { "NOTIFY_ENUM_DIR",             STATUS_NOTIFY_ENUM_DIR },
     { "NOT_ALL_ASSIGNED",            STATUS_NOT_ALL_ASSIGNED },
     { "NOT_A_DIRECTORY",             STATUS_NOT_A_DIRECTORY },
     { "NOT_FOUND",                   STATUS_NOT_FOUND },